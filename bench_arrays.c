@@ -0,0 +1,212 @@
+#include "runtime.h"
+
+long long static_data();
+
+int main() {
+	goto start;
+	void* ret1;		// Return address of getbool
+	bool lv2;		// getbool bb
+	long long lv2_address;
+getbool:
+	lv2 = getBool();
+	goto *ret1;
+	void* ret3;		// Return address of getinteger
+	int lv4;		// getinteger ii
+	long long lv4_address;
+getinteger:
+	lv4 = getInteger();
+	goto *ret3;
+	void* ret5;		// Return address of getfloat
+	double lv6;		// getfloat ff
+	long long lv6_address;
+getfloat:
+	lv6 = getFloat();
+	goto *ret5;
+	void* ret7;		// Return address of getstring
+	long long lv8;		// getstring ss
+	long long lv8_address;
+getstring:
+	lv8 = (long long)getString();
+	goto *ret7;
+	void* ret9;		// Return address of putbool
+	bool lv10;		// putbool b
+putbool:
+	putBool(lv10);
+	goto *ret9;
+	void* ret11;		// Return address of putinteger
+	int lv12;		// putinteger i
+putinteger:
+	putInteger(lv12);
+	goto *ret11;
+	void* ret13;		// Return address of putfloat
+	double lv14;		// putfloat f
+putfloat:
+	putFloat(lv14);
+	goto *ret13;
+	void* ret15;		// Return address of putstring
+	long long lv16;		// putstring s
+putstring:
+	putString((char*)lv16);
+	goto *ret15;
+	static int v17;		// n
+	static int v18;		// i
+	static int v19;		// j
+	static int v20;		// pass
+	static int v21;		// primes
+	static int v22;		// total
+start:
+	init(static_data());		// Static memory is only known once the whole program is parsed
+	Reg[SP] = Reg[FP] - 1600168;		// Allocate the frame
+	v17 = 400000;		// assign local variable
+	v20 = 0;		// assign local variable
+	{		// Loop invariants
+	long long iv23;
+	long long inv26;
+	long long inv36;
+	long long inv39;
+	iv23 = v20;		// Induction variable
+	inv26 = (((Reg[FP] - 399993) & -64));		// Loop invariant
+	inv36 = (((Reg[FP] - 800049) & -64));		// Loop invariant
+	inv39 = (((Reg[FP] - 1600105) & -64));		// Loop invariant
+	if (iv23 < 25) {
+	do {
+	v18 = 0;		// assign local variable
+	{		// Loop invariants
+	long long iv24;
+	long long ptr25;
+	iv24 = v18;		// Induction variable
+	Reg[0] = inv26 + iv24;		// expression = operand1 op operand2
+	ptr25 = Reg[0];		// Address stepped by the loop
+	if (iv24 < (long long)v17) {
+	do {
+	MEM(bool, ptr25) = false;		// composite + offset = expression
+	Reg[0] = iv24 + 1;		// expression = operand1 op operand2
+	iv24 = Reg[0];		// assign local variable
+	ptr25 = ptr25 + 1;
+	} while (iv24 < (long long)v17);
+	}
+	v18 = iv24;
+	}
+	v18 = 2;		// assign local variable
+	{		// Loop invariants
+	long long iv27;
+	long long ptr29;
+	iv27 = v18;		// Induction variable
+	Reg[0] = inv26 + iv27;		// expression = operand1 op operand2
+	ptr29 = Reg[0];		// Address stepped by the loop
+	Reg[0] = iv27 * iv27;		// expression = operand1 op operand2
+	if (Reg[0] < (long long)v17) {
+	do {
+	Reg[0] = ptr29;		// operand
+	Reg[0] = MEM(bool, Reg[0]);		// Get array operand
+	if ((Reg[0])) goto else1;
+	Reg[0] = iv27 * iv27;		// expression = operand1 op operand2
+	v19 = Reg[0];		// assign local variable
+	if ((long long)v19 < (long long)v17) {
+	do {
+	Reg[0] = inv26 + (long long)v19;		// expression = operand1 op operand2
+	MEM(bool, Reg[0]) = true;		// composite + offset = expression
+	Reg[0] = (long long)v19 + iv27;		// expression = operand1 op operand2
+	v19 = Reg[0];		// assign local variable
+	} while ((long long)v19 < (long long)v17);
+	}
+else1:
+	Reg[0] = iv27 + 1;		// expression = operand1 op operand2
+	iv27 = Reg[0];		// assign local variable
+	ptr29 = ptr29 + 1;
+	Reg[0] = iv27 * iv27;		// expression = operand1 op operand2
+	} while (Reg[0] < (long long)v17);
+	}
+	v18 = iv27;
+	}
+	v18 = 0;		// assign local variable
+	{		// Loop invariants
+	long long iv34;
+	long long ptr35;
+	long long ptr38;
+	iv34 = v18;		// Induction variable
+	Reg[0] = inv36 + iv34;		// expression = operand1 op operand2
+	ptr35 = Reg[0];		// Address stepped by the loop
+	Reg[0] = iv34 * 2;		// expression = operand1 op operand2
+	Reg[0] = inv39 + Reg[0];		// expression = operand1 op operand2
+	ptr38 = Reg[0];		// Address stepped by the loop
+	if (iv34 < (long long)v17) {
+	do {
+	Reg[0] = iv34 * 7;		// expression = operand1 op operand2
+	MEM(signed char, ptr35) = Reg[0];		// residues + offset = expression
+	Reg[0] = ptr38;		// operand
+	Reg[0] = MEM(short, Reg[0]);		// Get array operand
+	Reg[1] = ptr35;		// operand
+	Reg[1] = MEM(signed char, Reg[1]);		// Get array operand
+	Reg[0] = Reg[0] + Reg[1];		// expression = operand1 op operand2
+	MEM(short, ptr38) = Reg[0];		// counts + offset = expression
+	Reg[0] = iv34 + 1;		// expression = operand1 op operand2
+	iv34 = Reg[0];		// assign local variable
+	ptr35 = ptr35 + 1;
+	ptr38 = ptr38 + 2;
+	} while (iv34 < (long long)v17);
+	}
+	v18 = iv34;
+	}
+	Reg[0] = iv23 + 1;		// expression = operand1 op operand2
+	iv23 = Reg[0];		// assign local variable
+	} while (iv23 < 25);
+	}
+	v20 = iv23;
+	}
+	v21 = 0;		// assign local variable
+	v22 = 0;		// assign local variable
+	v18 = 2;		// assign local variable
+	{		// Loop invariants
+	long long iv43;
+	long long ptr44;
+	long long ptr47;
+	iv43 = v18;		// Induction variable
+	Reg[0] = (((Reg[FP] - 399993) & -64)) + iv43;		// expression = operand1 op operand2
+	ptr44 = Reg[0];		// Address stepped by the loop
+	Reg[0] = iv43 * 2;		// expression = operand1 op operand2
+	Reg[0] = (((Reg[FP] - 1600105) & -64)) + Reg[0];		// expression = operand1 op operand2
+	ptr47 = Reg[0];		// Address stepped by the loop
+	if (iv43 < (long long)v17) {
+	do {
+	Reg[0] = ptr44;		// operand
+	Reg[0] = MEM(bool, Reg[0]);		// Get array operand
+	if ((Reg[0])) goto else2;
+	Reg[0] = (long long)v21 + 1;		// expression = operand1 op operand2
+	v21 = Reg[0];		// assign local variable
+else2:
+	Reg[0] = ptr47;		// operand
+	Reg[0] = MEM(short, Reg[0]);		// Get array operand
+	Reg[0] = (long long)v22 + Reg[0];		// expression = operand1 op operand2
+	v22 = Reg[0];		// assign local variable
+	Reg[0] = iv43 + 1;		// expression = operand1 op operand2
+	iv43 = Reg[0];		// assign local variable
+	ptr44 = ptr44 + 1;
+	ptr47 = ptr47 + 2;
+	} while (iv43 < (long long)v17);
+	}
+	v18 = iv43;
+	}
+	Reg[0] = (long long)v21;		// operand
+	lv12 = Reg[0];		// Pass argument
+	ret11 = &&postputinteger3;
+	goto putinteger;		// jump to leaf procedure
+postputinteger3:
+	Reg[0] = (long long)&MEM(char, 0);		// operand
+	lv16 = Reg[0];		// Pass argument
+	ret15 = &&postputstring4;
+	goto putstring;		// jump to leaf procedure
+postputstring4:
+	Reg[0] = (long long)v22;		// operand
+	lv12 = Reg[0];		// Pass argument
+	ret11 = &&postputinteger5;
+	goto putinteger;		// jump to leaf procedure
+postputinteger5:
+	return 0;
+}
+
+long long static_data()
+{
+	strcpy(&MEM(char, 0), " ");
+	return 2;
+}
@@ -0,0 +1,369 @@
+#include "runtime.h"
+
+long long static_data();
+
+int main() {
+	goto start;
+	void* ret1;		// Return address of getbool
+	bool lv2;		// getbool bb
+	long long lv2_address;
+getbool:
+	lv2 = getBool();
+	goto *ret1;
+	void* ret3;		// Return address of getinteger
+	int lv4;		// getinteger ii
+	long long lv4_address;
+getinteger:
+	lv4 = getInteger();
+	goto *ret3;
+	void* ret5;		// Return address of getfloat
+	double lv6;		// getfloat ff
+	long long lv6_address;
+getfloat:
+	lv6 = getFloat();
+	goto *ret5;
+	void* ret7;		// Return address of getstring
+	long long lv8;		// getstring ss
+	long long lv8_address;
+getstring:
+	lv8 = (long long)getString();
+	goto *ret7;
+	void* ret9;		// Return address of putbool
+	bool lv10;		// putbool b
+putbool:
+	putBool(lv10);
+	goto *ret9;
+	void* ret11;		// Return address of putinteger
+	int lv12;		// putinteger i
+putinteger:
+	putInteger(lv12);
+	goto *ret11;
+	void* ret13;		// Return address of putfloat
+	double lv14;		// putfloat f
+putfloat:
+	putFloat(lv14);
+	goto *ret13;
+	void* ret15;		// Return address of putstring
+	long long lv16;		// putstring s
+putstring:
+	putString((char*)lv16);
+	goto *ret15;
+	static int v17;		// n
+	static int v18;		// i
+	static int v19;		// seed
+	static int v20;		// start
+	static int v21;		// last
+	static int v22;		// temp
+	long long cse28;
+	long long cse34;
+	long long cse37;
+	long long cse33;
+	long long cse36;
+sift:
+	Reg[SP] = Reg[FP] - 16;		// Allocate the frame
+	Reg[0] = (long long)MEM(int, Reg[FP] + 24) * 2;		// expression = operand1 op operand2
+	Reg[0] = Reg[0] + 1;		// expression = operand1 op operand2
+	MEM(int, Reg[FP] - 8) = Reg[0];		// assign local variable
+	if (!((long long)MEM(int, Reg[FP] - 8) <= (long long)MEM(int, Reg[FP] + 32))) goto else1;
+	if (!((long long)MEM(int, Reg[FP] - 8) < (long long)MEM(int, Reg[FP] + 32))) goto else2;
+	Reg[0] = (long long)MEM(int, Reg[FP] - 8) * 4;		// expression = operand1 op operand2
+	Reg[0] = (MEM(long long, Reg[FP] + 16)) + Reg[0];		// expression = operand1 op operand2
+	Reg[0] = MEM(int, Reg[0]);		// Get array operand
+	Reg[1] = (long long)MEM(int, Reg[FP] - 8) + 1;		// expression = operand1 op operand2
+	cse28 = Reg[1];		// Value used again
+	Reg[1] = Reg[1] * 4;		// expression = operand1 op operand2
+	Reg[1] = (MEM(long long, Reg[FP] + 16)) + Reg[1];		// expression = operand1 op operand2
+	Reg[1] = MEM(int, Reg[1]);		// Get array operand
+	if (!(Reg[0] < Reg[1])) goto else3;
+	MEM(int, Reg[FP] - 8) = cse28;		// assign local variable
+else3:
+else2:
+	Reg[0] = (long long)MEM(int, Reg[FP] + 24) * 4;		// expression = operand1 op operand2
+	Reg[0] = (MEM(long long, Reg[FP] + 16)) + Reg[0];		// expression = operand1 op operand2
+	cse33 = Reg[0];		// Value used again
+	Reg[0] = MEM(int, Reg[0]);		// Get array operand
+	cse34 = Reg[0];		// Value used again
+	Reg[1] = (long long)MEM(int, Reg[FP] - 8) * 4;		// expression = operand1 op operand2
+	Reg[1] = (MEM(long long, Reg[FP] + 16)) + Reg[1];		// expression = operand1 op operand2
+	cse36 = Reg[1];		// Value used again
+	Reg[1] = MEM(int, Reg[1]);		// Get array operand
+	cse37 = Reg[1];		// Value used again
+	if (!(Reg[0] < Reg[1])) goto else4;
+	MEM(int, Reg[FP] - 16) = cse34;		// assign local variable
+	MEM(int, cse33) = cse37;		// list + offset = expression
+	MEM(int, cse36) = (long long)MEM(int, Reg[FP] - 16);		// list + offset = expression
+	Reg[0] = (MEM(long long, Reg[FP] + 16));		// operand
+	Reg[1] = (long long)MEM(int, Reg[FP] - 8);		// operand
+	Reg[2] = (long long)MEM(int, Reg[FP] + 32);		// operand
+	MEM(int, Reg[FP] + 24) = Reg[1];		// Overwrite parameter in own frame
+	Reg[SP] = Reg[FP];		// Free local variables
+	goto sift;		// Tail call, reuse frame
+else4:
+else1:
+	Reg[SP] = Reg[FP];		// Free local variables
+	Reg[FP] = MEM(long long, Reg[FP]);		// Restore Frame pointer
+	Reg[SP] = Reg[SP] + 8;		// Free space for FP
+	Reg[0] = MEM(long long, Reg[SP]);		// Pop return address off the stack
+	Reg[SP] = Reg[SP] + 8;		// Free return address space
+	goto *(void*)Reg[0];		// Return
+	long long cse45;
+heap_sort:
+	Reg[0] = (long long)MEM(int, Reg[FP] + 24) / 2;		// expression = operand1 op operand2
+	Reg[0] = Reg[0] - 1;		// expression = operand1 op operand2
+	v20 = Reg[0];		// assign local variable
+	{		// Loop invariants
+	long long iv40;
+	long long inv41;
+	iv40 = v20;		// Induction variable
+	Reg[0] = (long long)MEM(int, Reg[FP] + 24) - 1;		// expression = operand1 op operand2
+	inv41 = Reg[0];		// Loop invariant
+	if (iv40 >= 0) {
+	do {
+	Reg[0] = (MEM(long long, Reg[FP] + 16));		// operand
+	Reg[1] = iv40;		// operand
+	Reg[2] = inv41;		// operand
+	v20 = iv40;
+	Reg[SP] = Reg[SP] - 8;		// Make space on stack for argument
+	MEM(int, Reg[SP]) = Reg[2];		// Move argument to stack
+	Reg[SP] = Reg[SP] - 8;		// Make space on stack for argument
+	MEM(int, Reg[SP]) = Reg[1];		// Move argument to stack
+	Reg[SP] = Reg[SP] - 8;
+	MEM(long long, Reg[SP]) = Reg[0];		// Pass array by reference
+	Reg[SP] = Reg[SP] - 8;		// Allocate space for return address
+	Reg[0] = (long long)&&postsift6;
+	MEM(long long, Reg[SP]) = Reg[0];		// save return address
+	Reg[SP] = Reg[SP] - 8;		// Allocate space for FP
+	MEM(long long, Reg[SP]) = Reg[FP];		// Save frame pointer
+	Reg[FP] = Reg[SP];		// Move frame pointer to new position
+	goto sift;		// jump to procedure
+postsift6:
+	Reg[SP] = Reg[SP] + 8;		// Free array reference
+	Reg[SP] = Reg[SP] + 8;		// Free input parameter
+	Reg[SP] = Reg[SP] + 8;		// Free input parameter
+	iv40 = v20;		// Induction variable
+	Reg[0] = (long long)MEM(int, Reg[FP] + 24) - 1;		// expression = operand1 op operand2
+	inv41 = Reg[0];		// Loop invariant
+	Reg[0] = iv40 - 1;		// expression = operand1 op operand2
+	iv40 = Reg[0];		// assign local variable
+	} while (iv40 >= 0);
+	}
+	v20 = iv40;
+	}
+	Reg[0] = (long long)MEM(int, Reg[FP] + 24) - 1;		// expression = operand1 op operand2
+	v21 = Reg[0];		// assign local variable
+	{		// Loop invariants
+	long long iv43;
+	long long inv44;
+	long long ptr47;
+	iv43 = v21;		// Induction variable
+	Reg[0] = 0 * 4;		// expression = operand1 op operand2
+	inv44 = Reg[0];		// Loop invariant
+	Reg[0] = iv43 * 4;		// expression = operand1 op operand2
+	Reg[0] = (MEM(long long, Reg[FP] + 16)) + Reg[0];		// expression = operand1 op operand2
+	ptr47 = Reg[0];		// Address stepped by the loop
+	if (iv43 > 0) {
+	do {
+	Reg[0] = (MEM(long long, Reg[FP] + 16)) + inv44;		// expression = operand1 op operand2
+	cse45 = Reg[0];		// Value used again
+	Reg[0] = MEM(int, Reg[0]);		// Get array operand
+	v22 = Reg[0];		// assign local variable
+	Reg[0] = ptr47;		// operand
+	Reg[0] = MEM(int, Reg[0]);		// Get array operand
+	MEM(int, cse45) = Reg[0];		// list + offset = expression
+	MEM(int, ptr47) = (long long)v22;		// list + offset = expression
+	Reg[0] = (MEM(long long, Reg[FP] + 16));		// operand
+	Reg[1] = 0;		// operand
+	Reg[2] = iv43 - 1;		// expression = operand1 op operand2
+	v21 = iv43;
+	Reg[SP] = Reg[SP] - 8;		// Make space on stack for argument
+	MEM(int, Reg[SP]) = Reg[2];		// Move argument to stack
+	Reg[SP] = Reg[SP] - 8;		// Make space on stack for argument
+	MEM(int, Reg[SP]) = Reg[1];		// Move argument to stack
+	Reg[SP] = Reg[SP] - 8;
+	MEM(long long, Reg[SP]) = Reg[0];		// Pass array by reference
+	Reg[SP] = Reg[SP] - 8;		// Allocate space for return address
+	Reg[0] = (long long)&&postsift7;
+	MEM(long long, Reg[SP]) = Reg[0];		// save return address
+	Reg[SP] = Reg[SP] - 8;		// Allocate space for FP
+	MEM(long long, Reg[SP]) = Reg[FP];		// Save frame pointer
+	Reg[FP] = Reg[SP];		// Move frame pointer to new position
+	goto sift;		// jump to procedure
+postsift7:
+	Reg[SP] = Reg[SP] + 8;		// Free array reference
+	Reg[SP] = Reg[SP] + 8;		// Free input parameter
+	Reg[SP] = Reg[SP] + 8;		// Free input parameter
+	iv43 = v21;		// Induction variable
+	Reg[0] = 0 * 4;		// expression = operand1 op operand2
+	inv44 = Reg[0];		// Loop invariant
+	Reg[0] = iv43 * 4;		// expression = operand1 op operand2
+	Reg[0] = (MEM(long long, Reg[FP] + 16)) + Reg[0];		// expression = operand1 op operand2
+	ptr47 = Reg[0];		// Address stepped by the loop
+	Reg[0] = iv43 - 1;		// expression = operand1 op operand2
+	iv43 = Reg[0];		// assign local variable
+	ptr47 = ptr47 - 4;
+	} while (iv43 > 0);
+	}
+	v21 = iv43;
+	}
+	Reg[SP] = Reg[FP];		// Free local variables
+	Reg[FP] = MEM(long long, Reg[FP]);		// Restore Frame pointer
+	Reg[SP] = Reg[SP] + 8;		// Free space for FP
+	Reg[0] = MEM(long long, Reg[SP]);		// Pop return address off the stack
+	Reg[SP] = Reg[SP] + 8;		// Free return address space
+	goto *(void*)Reg[0];		// Return
+	void* ret50;		// Return address of count_unsorted
+	long long lv51;		// count_unsorted list
+	int lv52;		// count_unsorted size
+	int lv53;		// count_unsorted count
+	long long lv53_address;
+	int lv54;		// count_unsorted i
+count_unsorted:
+	lv53 = 0;		// assign parameter
+	lv54 = 1;		// assign local variable
+	{		// Loop invariants
+	long long iv55;
+	long long ptr56;
+	long long inv57;
+	iv55 = lv54;		// Induction variable
+	Reg[0] = iv55 * 4;		// expression = operand1 op operand2
+	Reg[0] = (lv51) + Reg[0];		// expression = operand1 op operand2
+	ptr56 = Reg[0];		// Address stepped by the loop
+	inv57 = (lv51);		// Loop invariant
+	if (iv55 < (long long)lv52) {
+	do {
+	Reg[0] = ptr56;		// operand
+	Reg[0] = MEM(int, Reg[0]);		// Get array operand
+	Reg[1] = iv55 - 1;		// expression = operand1 op operand2
+	Reg[1] = Reg[1] * 4;		// expression = operand1 op operand2
+	Reg[1] = inv57 + Reg[1];		// expression = operand1 op operand2
+	Reg[1] = MEM(int, Reg[1]);		// Get array operand
+	if (!(Reg[0] < Reg[1])) goto else8;
+	Reg[0] = (long long)lv53 + 1;		// expression = operand1 op operand2
+	lv53 = Reg[0];		// assign parameter
+else8:
+	Reg[0] = iv55 + 1;		// expression = operand1 op operand2
+	iv55 = Reg[0];		// assign local variable
+	ptr56 = ptr56 + 4;
+	} while (iv55 < (long long)lv52);
+	}
+	lv54 = iv55;
+	}
+	goto *ret50;		// Return from leaf
+start:
+	init(static_data());		// Static memory is only known once the whole program is parsed
+	Reg[SP] = Reg[FP] - 400064;		// Allocate the frame
+	v17 = 100000;		// assign local variable
+	v19 = 12345;		// assign local variable
+	v18 = 0;		// assign local variable
+	{		// Loop invariants
+	long long iv64;
+	long long ptr67;
+	iv64 = v18;		// Induction variable
+	Reg[0] = iv64 * 4;		// expression = operand1 op operand2
+	Reg[0] = (((Reg[FP] - 399993) & -64)) + Reg[0];		// expression = operand1 op operand2
+	ptr67 = Reg[0];		// Address stepped by the loop
+	if (iv64 < (long long)v17) {
+	do {
+	Reg[0] = (long long)v19 * 1103515245;		// expression = operand1 op operand2
+	Reg[0] = Reg[0] + 12345;		// expression = operand1 op operand2
+	v19 = Reg[0];		// assign local variable
+	Reg[0] = (long long)v19 / 65536;		// expression = operand1 op operand2
+	Reg[1] = (long long)v19 / 16777216;		// expression = operand1 op operand2
+	Reg[1] = Reg[1] * 256;		// expression = operand1 op operand2
+	Reg[0] = Reg[0] - Reg[1];		// expression = operand1 op operand2
+	MEM(int, ptr67) = Reg[0];		// values + offset = expression
+	Reg[0] = iv64 + 1;		// expression = operand1 op operand2
+	iv64 = Reg[0];		// assign local variable
+	ptr67 = ptr67 + 4;
+	} while (iv64 < (long long)v17);
+	}
+	v18 = iv64;
+	}
+	Reg[0] = (((Reg[FP] - 399993) & -64));		// operand
+	Reg[1] = (long long)v17;		// operand
+	Reg[2] = (Reg[FP] - 400064);		// operand
+	Reg[3] = MEM(int, Reg[2]);		// Value of out argument
+	lv53 = Reg[3];		// Pass argument
+	lv53_address = Reg[2];
+	lv52 = Reg[1];		// Pass argument
+	lv51 = Reg[0];		// Pass array by reference
+	ret50 = &&postcount_unsorted9;
+	goto count_unsorted;		// jump to leaf procedure
+postcount_unsorted9:
+	MEM(int, lv53_address) = lv53;		// Store out argument
+	Reg[0] = (long long)MEM(int, Reg[FP] - 400064);		// operand
+	lv12 = Reg[0];		// Pass argument
+	ret11 = &&postputinteger10;
+	goto putinteger;		// jump to leaf procedure
+postputinteger10:
+	Reg[0] = (long long)&MEM(char, 0);		// operand
+	lv16 = Reg[0];		// Pass argument
+	ret15 = &&postputstring11;
+	goto putstring;		// jump to leaf procedure
+postputstring11:
+	Reg[0] = (((Reg[FP] - 399993) & -64));		// operand
+	Reg[1] = (long long)v17;		// operand
+	Reg[SP] = Reg[SP] - 8;		// Make space on stack for argument
+	MEM(int, Reg[SP]) = Reg[1];		// Move argument to stack
+	Reg[SP] = Reg[SP] - 8;
+	MEM(long long, Reg[SP]) = Reg[0];		// Pass array by reference
+	Reg[SP] = Reg[SP] - 8;		// Allocate space for return address
+	Reg[0] = (long long)&&postheap_sort12;
+	MEM(long long, Reg[SP]) = Reg[0];		// save return address
+	Reg[SP] = Reg[SP] - 8;		// Allocate space for FP
+	MEM(long long, Reg[SP]) = Reg[FP];		// Save frame pointer
+	Reg[FP] = Reg[SP];		// Move frame pointer to new position
+	goto heap_sort;		// jump to procedure
+postheap_sort12:
+	Reg[SP] = Reg[SP] + 8;		// Free array reference
+	Reg[SP] = Reg[SP] + 8;		// Free input parameter
+	Reg[0] = (((Reg[FP] - 399993) & -64));		// operand
+	Reg[1] = (long long)v17;		// operand
+	Reg[2] = (Reg[FP] - 400064);		// operand
+	Reg[3] = MEM(int, Reg[2]);		// Value of out argument
+	lv53 = Reg[3];		// Pass argument
+	lv53_address = Reg[2];
+	lv52 = Reg[1];		// Pass argument
+	lv51 = Reg[0];		// Pass array by reference
+	ret50 = &&postcount_unsorted13;
+	goto count_unsorted;		// jump to leaf procedure
+postcount_unsorted13:
+	MEM(int, lv53_address) = lv53;		// Store out argument
+	Reg[0] = (long long)MEM(int, Reg[FP] - 400064);		// operand
+	lv12 = Reg[0];		// Pass argument
+	ret11 = &&postputinteger14;
+	goto putinteger;		// jump to leaf procedure
+postputinteger14:
+	Reg[0] = (long long)&MEM(char, 0);		// operand
+	lv16 = Reg[0];		// Pass argument
+	ret15 = &&postputstring15;
+	goto putstring;		// jump to leaf procedure
+postputstring15:
+	Reg[0] = 0 * 4;		// expression = operand1 op operand2
+	Reg[0] = (((Reg[FP] - 399993) & -64)) + Reg[0];		// expression = operand1 op operand2
+	Reg[0] = MEM(int, Reg[0]);		// Get array operand
+	lv12 = Reg[0];		// Pass argument
+	ret11 = &&postputinteger16;
+	goto putinteger;		// jump to leaf procedure
+postputinteger16:
+	Reg[0] = (long long)&MEM(char, 0);		// operand
+	lv16 = Reg[0];		// Pass argument
+	ret15 = &&postputstring17;
+	goto putstring;		// jump to leaf procedure
+postputstring17:
+	Reg[0] = (long long)v17 - 1;		// expression = operand1 op operand2
+	Reg[0] = Reg[0] * 4;		// expression = operand1 op operand2
+	Reg[0] = (((Reg[FP] - 399993) & -64)) + Reg[0];		// expression = operand1 op operand2
+	Reg[0] = MEM(int, Reg[0]);		// Get array operand
+	lv12 = Reg[0];		// Pass argument
+	ret11 = &&postputinteger18;
+	goto putinteger;		// jump to leaf procedure
+postputinteger18:
+	return 0;
+}
+
+long long static_data()
+{
+	strcpy(&MEM(char, 0), " ");
+	return 2;
+}
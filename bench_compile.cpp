@@ -0,0 +1,68 @@
+// Bench_compile.cpp
+// Compiles a program from memory again and again through the library and reports the latency of one compilation
+#include <iostream>
+#include <fstream>
+#include <sstream>
+#include <algorithm>
+#include <chrono>
+#include <cstdlib>
+#include <cstring>
+#include "compiler.h"
+
+int main(int argc, char** argv)
+{
+  char* filename = NULL;
+  int iterations = 1000;
+  Compile_options options;
+
+  for (int i = 1; i < argc; i++) {
+    if (!strcmp(argv[i], "-no-inline"))
+      options.inline_procedures = false;
+    else if (!strcmp(argv[i], "-lean"))
+      options.lean = true;
+    else if (!strcmp(argv[i], "-n") && i + 1 < argc)
+      iterations = atoi(argv[++i]);
+    else
+      filename = argv[i];
+  }
+
+  if (filename == NULL || iterations < 1) {
+    std::cout << "Usage: bench_compile [-no-inline] [-lean] [-n iterations] filename" << std::endl;
+    exit(1);
+  }
+
+  // The file is read once, only the compilations are timed
+  std::ifstream ifs(filename);
+  std::stringstream buffer;
+  buffer << ifs.rdbuf();
+  std::string source = buffer.str();
+
+  Compile_result result = compile_source(source, options); // Warm up
+  if (!result.success) {
+    for (unsigned int i = 0; i < result.diagnostics.size(); i++)
+      std::cout << "Line " << result.diagnostics[i].line << ": " << result.diagnostics[i].message << "\n";
+    std::cout << filename << " has " << result.num_errors << " errors\n";
+    exit(1);
+  }
+
+  std::vector<double> times;
+  for (int i = 0; i < iterations; i++) {
+    std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+    result = compile_source(source, options);
+    std::chrono::steady_clock::time_point end = std::chrono::steady_clock::now();
+    times.push_back(std::chrono::duration<double, std::micro>(end - start).count());
+  }
+
+  std::sort(times.begin(), times.end());
+  double total = 0;
+  for (unsigned int i = 0; i < times.size(); i++)
+    total += times[i];
+
+  std::cout << filename << ": " << source.size() << " bytes of source, " << result.code.size() << " bytes of C\n";
+  std::cout << iterations << " compilations, microseconds per compilation:\n";
+  std::cout << "\tmin " << times[0] << "\tp50 " << times[times.size() / 2] << "\tp99 " << times[times.size() * 99 / 100];
+  std::cout << "\tmax " << times.back() << "\tmean " << total / times.size() << "\n";
+  std::cout << 1e6 * times.size() / total << " compilations per second, " << result.code.size() / times[times.size() / 2] << " MB of C per second\n";
+
+  return 0;
+}
@@ -0,0 +1,153 @@
+// Bench_emit.cpp
+// Writes the C of a program again and again, as the generator emits it, and reports the throughput of the
+// output buffers against the stringstreams they replaced. The C is compiled once, then replayed as text and
+// integer fragments into one buffer per procedure, spliced into the file and written out
+#include <iostream>
+#include <fstream>
+#include <sstream>
+#include <algorithm>
+#include <chrono>
+#include <cstdlib>
+#include <cstring>
+#include <cctype>
+#include "compiler.h"
+#include "code_buffer.h"
+
+// A line of C split into text and the integers in it
+struct Fragment {
+  std::string text;
+  long long value;
+  bool number;
+};
+
+// Digits that are a number, not the end of a name such as R1
+static bool number_at(const std::string& line, size_t i)
+{
+  return isdigit(line[i]) && (i == 0 || (!isalnum(line[i-1]) && line[i-1] != '_'));
+}
+
+// A procedure ends where it returns through its return address, each is written to its own buffer
+static std::vector<std::vector<Fragment> > procedures(const std::string& code)
+{
+  std::vector<std::vector<Fragment> > result(1);
+  std::istringstream lines(code);
+  std::string line;
+  while (std::getline(lines, line)) {
+    line += "\n";
+    size_t i = 0;
+    while (i < line.size()) {
+      Fragment fragment;
+      size_t start = i;
+      fragment.number = number_at(line, i);
+      if (fragment.number) {
+        while (i < line.size() && isdigit(line[i]))
+          i++;
+        fragment.value = atoll(line.substr(start, i - start).c_str());
+      }
+      else {
+        i++;
+        while (i < line.size() && !number_at(line, i))
+          i++;
+        fragment.text = line.substr(start, i - start);
+      }
+      result.back().push_back(fragment);
+    }
+    if (line.find("goto *") != std::string::npos)
+      result.push_back(std::vector<Fragment>());
+  }
+  return result;
+}
+
+static double stringstreams(std::vector<std::vector<Fragment> > &code, const char* path)
+{
+  std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+  std::ofstream file(path, std::ios_base::out | std::ios_base::trunc);
+  for (unsigned int i = 0; i < code.size(); i++) {
+    std::stringstream* procedure = new std::stringstream;
+    for (const Fragment* fragment = code[i].data(), *end = fragment + code[i].size(); fragment < end; fragment++) {
+      if (fragment->number)
+        *procedure << fragment->value;
+      else
+        *procedure << fragment->text;
+    }
+    if (procedure->rdbuf()->in_avail())
+      file << procedure->rdbuf();
+    delete procedure;
+  }
+  file.close();
+  std::chrono::steady_clock::time_point end = std::chrono::steady_clock::now();
+  return std::chrono::duration<double>(end - start).count();
+}
+
+static double buffers(std::vector<std::vector<Fragment> > &code, const char* path, bool lean)
+{
+  std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+  Code_buffer file(lean);
+  for (unsigned int i = 0; i < code.size(); i++) {
+    Code_buffer* procedure = new Code_buffer(lean);
+    for (const Fragment* fragment = code[i].data(), *end = fragment + code[i].size(); fragment < end; fragment++) {
+      if (fragment->number)
+        *procedure << fragment->value;
+      else
+        *procedure << fragment->text;
+    }
+    file.append(*procedure);
+    delete procedure;
+  }
+  file.write_file(path);
+  std::chrono::steady_clock::time_point end = std::chrono::steady_clock::now();
+  return std::chrono::duration<double>(end - start).count();
+}
+
+static void report(const char* name, std::vector<double> &times, size_t bytes)
+{
+  std::sort(times.begin(), times.end());
+  double p50 = times[times.size() / 2];
+  std::cout << "\t" << name << "\tp50 " << p50 * 1e6 << " us\t" << bytes / p50 / 1e6 << " MB/s\n";
+}
+
+int main(int argc, char** argv)
+{
+  char* filename = NULL;
+  const char* path = "/tmp/bench_emit.c";
+  int iterations = 100;
+
+  for (int i = 1; i < argc; i++) {
+    if (!strcmp(argv[i], "-n") && i + 1 < argc)
+      iterations = atoi(argv[++i]);
+    else if (!strcmp(argv[i], "-o") && i + 1 < argc)
+      path = argv[++i];
+    else
+      filename = argv[i];
+  }
+
+  if (filename == NULL || iterations < 1) {
+    std::cout << "Usage: bench_emit [-n iterations] [-o output] filename" << std::endl;
+    exit(1);
+  }
+
+  std::ifstream ifs(filename);
+  std::stringstream buffer;
+  buffer << ifs.rdbuf();
+  Compile_result result = compile_source(buffer.str());
+  if (!result.success) {
+    std::cout << filename << " has " << result.num_errors << " errors\n";
+    exit(1);
+  }
+  std::vector<std::vector<Fragment> > code = procedures(result.code);
+
+  // The lean C is shorter, its throughput is of the C as generated before the comments are left out
+  std::vector<double> streams, chunks, lean;
+  for (int i = 0; i < iterations; i++) {
+    streams.push_back(stringstreams(code, path));
+    chunks.push_back(buffers(code, path, false));
+    lean.push_back(buffers(code, path, true));
+  }
+  remove(path);
+
+  std::cout << filename << ": " << result.code.size() << " bytes of C in " << code.size() << " procedures, " << iterations << " times\n";
+  report("stringstream", streams, result.code.size());
+  report("Code_buffer", chunks, result.code.size());
+  report("lean", lean, result.code.size());
+  return 0;
+}
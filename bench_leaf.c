@@ -0,0 +1,175 @@
+#include "runtime.h"
+
+long long static_data();
+
+int main() {
+	goto start;
+	void* ret1;		// Return address of getbool
+	bool lv2;		// getbool bb
+	long long lv2_address;
+getbool:
+	lv2 = getBool();
+	goto *ret1;
+	void* ret3;		// Return address of getinteger
+	int lv4;		// getinteger ii
+	long long lv4_address;
+getinteger:
+	lv4 = getInteger();
+	goto *ret3;
+	void* ret5;		// Return address of getfloat
+	double lv6;		// getfloat ff
+	long long lv6_address;
+getfloat:
+	lv6 = getFloat();
+	goto *ret5;
+	void* ret7;		// Return address of getstring
+	long long lv8;		// getstring ss
+	long long lv8_address;
+getstring:
+	lv8 = (long long)getString();
+	goto *ret7;
+	void* ret9;		// Return address of putbool
+	bool lv10;		// putbool b
+putbool:
+	putBool(lv10);
+	goto *ret9;
+	void* ret11;		// Return address of putinteger
+	int lv12;		// putinteger i
+putinteger:
+	putInteger(lv12);
+	goto *ret11;
+	void* ret13;		// Return address of putfloat
+	double lv14;		// putfloat f
+putfloat:
+	putFloat(lv14);
+	goto *ret13;
+	void* ret15;		// Return address of putstring
+	long long lv16;		// putstring s
+putstring:
+	putString((char*)lv16);
+	goto *ret15;
+	static int v17;		// i
+	static int v18;		// total
+	static int v19;		// wins
+	void* ret20;		// Return address of mix
+	int lv21;		// mix value
+	int lv22;		// mix seed
+	int lv23;		// mix result
+	long long lv23_address;
+	bool lv24;		// mix odd
+	long long lv24_address;
+	int lv25;		// mix x
+	int lv26;		// mix half
+mix:
+	Reg[0] = (long long)lv21 * 31;		// expression = operand1 op operand2
+	Reg[0] = Reg[0] + (long long)lv22;		// expression = operand1 op operand2
+	lv25 = Reg[0];		// assign local variable
+	Reg[0] = (long long)lv25 / 65536;		// expression = operand1 op operand2
+	Reg[0] = Reg[0] * 65536;		// expression = operand1 op operand2
+	Reg[0] = (long long)lv25 - Reg[0];		// expression = operand1 op operand2
+	lv25 = Reg[0];		// assign local variable
+	Reg[0] = (long long)lv25 / 2;		// expression = operand1 op operand2
+	lv26 = Reg[0];		// assign local variable
+	Reg[0] = (long long)lv26 * 2;		// expression = operand1 op operand2
+	if (!(Reg[0] == (long long)lv25)) goto else1;
+	lv24 = false;		// assign parameter
+	Reg[0] = (long long)lv22 / 3;		// expression = operand1 op operand2
+	Reg[0] = (long long)lv26 + Reg[0];		// expression = operand1 op operand2
+	lv23 = Reg[0];		// assign parameter
+	goto next2;
+else1:
+	lv24 = true;		// assign parameter
+	Reg[0] = (long long)lv25 * 3;		// expression = operand1 op operand2
+	Reg[0] = Reg[0] + 1;		// expression = operand1 op operand2
+	lv23 = Reg[0];		// assign parameter
+next2:
+	Reg[0] = (long long)lv23 / 1000;		// expression = operand1 op operand2
+	Reg[0] = Reg[0] * 1000;		// expression = operand1 op operand2
+	Reg[0] = (long long)lv23 - Reg[0];		// expression = operand1 op operand2
+	lv23 = Reg[0];		// assign parameter
+	goto *ret20;		// Return from leaf
+start:
+	init(static_data());		// Static memory is only known once the whole program is parsed
+	Reg[SP] = Reg[FP] - 16;		// Allocate the frame
+	v18 = 0;		// assign local variable
+	v19 = 0;		// assign local variable
+	MEM(int, Reg[FP] - 8) = 7;		// assign local variable
+	v17 = 0;		// assign local variable
+	{		// Loop invariants
+	long long iv41;
+	long long inv42;
+	long long inv43;
+	iv41 = v17;		// Induction variable
+	inv42 = (Reg[FP] - 8);		// Loop invariant
+	inv43 = (Reg[FP] - 16);		// Loop invariant
+	if (iv41 < 20000000) {
+	do {
+	Reg[0] = iv41;		// operand
+	Reg[1] = (long long)MEM(int, Reg[FP] - 8);		// operand
+	Reg[2] = inv42;		// operand
+	Reg[3] = MEM(int, Reg[2]);		// Value of out argument
+	Reg[4] = inv43;		// operand
+	Reg[5] = MEM(bool, Reg[4]);		// Value of out argument
+	lv24 = Reg[5];		// Pass argument
+	lv24_address = Reg[4];
+	lv23 = Reg[3];		// Pass argument
+	lv23_address = Reg[2];
+	lv22 = Reg[1];		// Pass argument
+	lv21 = Reg[0];		// Pass argument
+	ret20 = &&postmix3;
+	goto mix;		// jump to leaf procedure
+postmix3:
+	MEM(int, lv23_address) = lv23;		// Store out argument
+	MEM(bool, lv24_address) = lv24;		// Store out argument
+	Reg[0] = (long long)v18 + (long long)MEM(int, Reg[FP] - 8);		// expression = operand1 op operand2
+	v18 = Reg[0];		// assign local variable
+	Reg[0] = (long long)MEM(int, Reg[FP] - 8);		// operand
+	Reg[1] = iv41;		// operand
+	Reg[2] = inv42;		// operand
+	Reg[3] = MEM(int, Reg[2]);		// Value of out argument
+	Reg[4] = inv43;		// operand
+	Reg[5] = MEM(bool, Reg[4]);		// Value of out argument
+	lv24 = Reg[5];		// Pass argument
+	lv24_address = Reg[4];
+	lv23 = Reg[3];		// Pass argument
+	lv23_address = Reg[2];
+	lv22 = Reg[1];		// Pass argument
+	lv21 = Reg[0];		// Pass argument
+	ret20 = &&postmix4;
+	goto mix;		// jump to leaf procedure
+postmix4:
+	MEM(int, lv23_address) = lv23;		// Store out argument
+	MEM(bool, lv24_address) = lv24;		// Store out argument
+	if (!(MEM(bool, Reg[FP] - 16))) goto else5;
+	Reg[0] = (long long)v19 + 1;		// expression = operand1 op operand2
+	v19 = Reg[0];		// assign local variable
+else5:
+	Reg[0] = iv41 + 1;		// expression = operand1 op operand2
+	iv41 = Reg[0];		// assign local variable
+	} while (iv41 < 20000000);
+	}
+	v17 = iv41;
+	}
+	Reg[0] = (long long)v18;		// operand
+	lv12 = Reg[0];		// Pass argument
+	ret11 = &&postputinteger6;
+	goto putinteger;		// jump to leaf procedure
+postputinteger6:
+	Reg[0] = (long long)&MEM(char, 0);		// operand
+	lv16 = Reg[0];		// Pass argument
+	ret15 = &&postputstring7;
+	goto putstring;		// jump to leaf procedure
+postputstring7:
+	Reg[0] = (long long)v19;		// operand
+	lv12 = Reg[0];		// Pass argument
+	ret11 = &&postputinteger8;
+	goto putinteger;		// jump to leaf procedure
+postputinteger8:
+	return 0;
+}
+
+long long static_data()
+{
+	strcpy(&MEM(char, 0), " ");
+	return 2;
+}
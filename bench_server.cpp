@@ -0,0 +1,107 @@
+// Bench_server.cpp
+// Load generator for the compile server, clients send the same program over their own connection and time each answer
+#include <iostream>
+#include <fstream>
+#include <sstream>
+#include <algorithm>
+#include <chrono>
+#include <vector>
+#include <thread>
+#include <cstdlib>
+#include <cstring>
+#include <cerrno>
+#include <sys/socket.h>
+#include <sys/un.h>
+#include <unistd.h>
+#include "protocol.h"
+
+static std::string path = SERVER_SOCKET;
+static std::string source;
+static int requests = 1000;
+static bool unique = false;
+
+// Round trips of one client in microseconds
+static void client(int number, std::vector<double>* times, bool* failed)
+{
+  struct sockaddr_un address;
+  memset(&address, 0, sizeof(address));
+  address.sun_family = AF_UNIX;
+  strncpy(address.sun_path, path.c_str(), sizeof(address.sun_path) - 1);
+  int fd = socket(AF_UNIX, SOCK_STREAM, 0);
+  if (fd < 0 || connect(fd, (struct sockaddr*)&address, sizeof(address)) < 0) {
+    *failed = true;
+    return;
+  }
+
+  Compile_options options;
+  Compile_result result;
+  for (int i = 0; i < requests; i++) {
+    // A comment that differs in every request keeps the server from answering out of its cache
+    std::string text = unique ? source + "\n// " + std::to_string(number) + " " + std::to_string(i) + "\n" : source;
+    std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+    if (!send_request(fd, text, options) || !receive_result(fd, result) || !result.success) {
+      *failed = true;
+      break;
+    }
+    std::chrono::steady_clock::time_point end = std::chrono::steady_clock::now();
+    times->push_back(std::chrono::duration<double, std::micro>(end - start).count());
+  }
+  close(fd);
+}
+
+int main(int argc, char** argv)
+{
+  char* filename = NULL;
+  int clients = 4;
+
+  for (int i = 1; i < argc; i++) {
+    if (!strcmp(argv[i], "-socket") && i + 1 < argc)
+      path = argv[++i];
+    else if (!strcmp(argv[i], "-c") && i + 1 < argc)
+      clients = atoi(argv[++i]);
+    else if (!strcmp(argv[i], "-n") && i + 1 < argc)
+      requests = atoi(argv[++i]);
+    else if (!strcmp(argv[i], "-unique"))
+      unique = true;
+    else
+      filename = argv[i];
+  }
+
+  if (filename == NULL || clients < 1 || requests < 1) {
+    std::cout << "Usage: bench_server [-socket path] [-c clients] [-n requests per client] [-unique] filename" << std::endl;
+    exit(1);
+  }
+
+  std::ifstream ifs(filename);
+  std::stringstream buffer;
+  buffer << ifs.rdbuf();
+  source = buffer.str();
+
+  std::vector<std::vector<double> > times(clients);
+  std::vector<std::thread> threads;
+  bool* failed = new bool[clients]();
+  std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+  for (int c = 0; c < clients; c++)
+    threads.push_back(std::thread(client, c, &times[c], &failed[c]));
+  for (int c = 0; c < clients; c++)
+    threads[c].join();
+  double elapsed = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+
+  std::vector<double> all;
+  for (int c = 0; c < clients; c++) {
+    if (failed[c]) {
+      std::cout << "Client " << c << " failed, is the compile server running on " << path << "?" << std::endl;
+      exit(1);
+    }
+    all.insert(all.end(), times[c].begin(), times[c].end());
+  }
+  delete [] failed;
+  std::sort(all.begin(), all.end());
+
+  std::cout << filename << ": " << clients << " clients, " << all.size() << " requests" << (unique ? " all different" : "") << "\n";
+  std::cout << "microseconds per request:\n";
+  std::cout << "\tp50 " << all[all.size() / 2] << "\tp99 " << all[all.size() * 99 / 100] << "\tmax " << all.back() << "\n";
+  std::cout << all.size() / elapsed << " requests per second\n";
+
+  return 0;
+}
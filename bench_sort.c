@@ -0,0 +1,195 @@
+#include "runtime.h"
+
+long long static_data();
+
+int main() {
+	goto start;
+	void* ret1;		// Return address of getbool
+	bool lv2;		// getbool bb
+	long long lv2_address;
+getbool:
+	lv2 = getBool();
+	goto *ret1;
+	void* ret3;		// Return address of getinteger
+	int lv4;		// getinteger ii
+	long long lv4_address;
+getinteger:
+	lv4 = getInteger();
+	goto *ret3;
+	void* ret5;		// Return address of getfloat
+	double lv6;		// getfloat ff
+	long long lv6_address;
+getfloat:
+	lv6 = getFloat();
+	goto *ret5;
+	void* ret7;		// Return address of getstring
+	long long lv8;		// getstring ss
+	long long lv8_address;
+getstring:
+	lv8 = (long long)getString();
+	goto *ret7;
+	void* ret9;		// Return address of putbool
+	bool lv10;		// putbool b
+putbool:
+	putBool(lv10);
+	goto *ret9;
+	void* ret11;		// Return address of putinteger
+	int lv12;		// putinteger i
+putinteger:
+	putInteger(lv12);
+	goto *ret11;
+	void* ret13;		// Return address of putfloat
+	double lv14;		// putfloat f
+putfloat:
+	putFloat(lv14);
+	goto *ret13;
+	void* ret15;		// Return address of putstring
+	long long lv16;		// putstring s
+putstring:
+	putString((char*)lv16);
+	goto *ret15;
+	static int v17;		// seed
+	static int v18;		// i
+	static int v19;		// j
+	static int v20;		// n
+	static int v21;		// checksum
+	void* ret22;		// Return address of swap
+	int lv23;		// swap a
+	long long lv23_address;
+	int lv24;		// swap b
+	long long lv24_address;
+	int lv25;		// swap t
+swap:
+	lv25 = (long long)lv23;		// assign local variable
+	lv23 = (long long)lv24;		// assign parameter
+	lv24 = (long long)lv25;		// assign parameter
+	goto *ret22;		// Return from leaf
+start:
+	init(static_data());		// Static memory is only known once the whole program is parsed
+	long long cse38;
+	long long cse41;
+	long long cse42;
+	Reg[SP] = Reg[FP] - 65592;		// Allocate the frame
+	v17 = 12345;		// assign local variable
+	v18 = 0;		// assign local variable
+	{		// Loop invariants
+	long long iv26;
+	long long ptr30;
+	iv26 = v18;		// Induction variable
+	Reg[0] = iv26 * 4;		// expression = operand1 op operand2
+	Reg[0] = (((Reg[FP] - 65529) & -64)) + Reg[0];		// expression = operand1 op operand2
+	ptr30 = Reg[0];		// Address stepped by the loop
+	if (iv26 < 16384) {
+	do {
+	Reg[0] = (long long)v17 * 1103515245;		// expression = operand1 op operand2
+	Reg[0] = Reg[0] + 12345;		// expression = operand1 op operand2
+	Reg[0] = Reg[0] & 2147483647;		// expression = operand1 op operand2
+	v17 = Reg[0];		// assign local variable
+	Reg[0] = (long long)v17 / 1000;		// expression = operand1 op operand2
+	Reg[0] = Reg[0] * 1000;		// expression = operand1 op operand2
+	Reg[0] = (long long)v17 - Reg[0];		// expression = operand1 op operand2
+	MEM(int, ptr30) = Reg[0];		// list + offset = expression
+	Reg[0] = iv26 + 1;		// expression = operand1 op operand2
+	iv26 = Reg[0];		// assign local variable
+	ptr30 = ptr30 + 4;
+	} while (iv26 < 16384);
+	}
+	v18 = iv26;
+	}
+	v20 = 16383;		// assign local variable
+	{		// Loop invariants
+	long long iv34;
+	long long inv37;
+	iv34 = v20;		// Induction variable
+	inv37 = (((Reg[FP] - 65529) & -64));		// Loop invariant
+	if (iv34 > 0) {
+	do {
+	v19 = 0;		// assign local variable
+	{		// Loop invariants
+	long long iv35;
+	long long ptr36;
+	iv35 = v19;		// Induction variable
+	Reg[0] = iv35 * 4;		// expression = operand1 op operand2
+	Reg[0] = inv37 + Reg[0];		// expression = operand1 op operand2
+	ptr36 = Reg[0];		// Address stepped by the loop
+	if (iv35 < iv34) {
+	do {
+	Reg[0] = ptr36;		// operand
+	Reg[0] = MEM(int, Reg[0]);		// Get array operand
+	cse38 = Reg[0];		// Value used again
+	Reg[1] = iv35 + 1;		// expression = operand1 op operand2
+	Reg[1] = Reg[1] * 4;		// expression = operand1 op operand2
+	Reg[1] = inv37 + Reg[1];		// expression = operand1 op operand2
+	cse41 = Reg[1];		// Value used again
+	Reg[1] = MEM(int, Reg[1]);		// Get array operand
+	cse42 = Reg[1];		// Value used again
+	if (!(Reg[0] > Reg[1])) goto else1;
+	Reg[0] = ptr36;		// operand
+	Reg[1] = cse38;		// Value of out argument
+	Reg[2] = cse41;		// operand
+	Reg[3] = cse42;		// Value of out argument
+	lv24 = Reg[3];		// Pass argument
+	lv24_address = Reg[2];
+	lv23 = Reg[1];		// Pass argument
+	lv23_address = Reg[0];
+	ret22 = &&postswap2;
+	goto swap;		// jump to leaf procedure
+postswap2:
+	MEM(int, lv23_address) = lv23;		// Store out argument
+	MEM(int, lv24_address) = lv24;		// Store out argument
+else1:
+	Reg[0] = iv35 + 1;		// expression = operand1 op operand2
+	iv35 = Reg[0];		// assign local variable
+	ptr36 = ptr36 + 4;
+	} while (iv35 < iv34);
+	}
+	v19 = iv35;
+	}
+	Reg[0] = iv34 - 1;		// expression = operand1 op operand2
+	iv34 = Reg[0];		// assign local variable
+	} while (iv34 > 0);
+	}
+	v20 = iv34;
+	}
+	v21 = 0;		// assign local variable
+	v18 = 0;		// assign local variable
+	{		// Loop invariants
+	long long iv45;
+	long long ptr46;
+	iv45 = v18;		// Induction variable
+	Reg[0] = iv45 * 4;		// expression = operand1 op operand2
+	Reg[0] = (((Reg[FP] - 65529) & -64)) + Reg[0];		// expression = operand1 op operand2
+	ptr46 = Reg[0];		// Address stepped by the loop
+	if (iv45 < 16384) {
+	do {
+	Reg[0] = (long long)v21 * 31;		// expression = operand1 op operand2
+	Reg[1] = ptr46;		// operand
+	Reg[1] = MEM(int, Reg[1]);		// Get array operand
+	Reg[0] = Reg[0] + Reg[1];		// expression = operand1 op operand2
+	Reg[0] = Reg[0] & 1048575;		// expression = operand1 op operand2
+	v21 = Reg[0];		// assign local variable
+	Reg[0] = iv45 + 1;		// expression = operand1 op operand2
+	iv45 = Reg[0];		// assign local variable
+	ptr46 = ptr46 + 4;
+	} while (iv45 < 16384);
+	}
+	v18 = iv45;
+	}
+	Reg[0] = (long long)v21;		// operand
+	lv12 = Reg[0];		// Pass argument
+	ret11 = &&postputinteger3;
+	goto putinteger;		// jump to leaf procedure
+postputinteger3:
+	Reg[0] = (long long)&MEM(char, 0);		// operand
+	lv16 = Reg[0];		// Pass argument
+	ret15 = &&postputstring4;
+	goto putstring;		// jump to leaf procedure
+postputstring4:
+	return 0;
+}
+
+long long static_data()
+{
+	strcpy(&MEM(char, 0), "\n");
+	return 3;
+}
@@ -0,0 +1,246 @@
+#include <algorithm>
+#include <cerrno>
+#include <climits>
+#include <cstring>
+#include <fcntl.h>
+#include <sys/uio.h>
+#include <unistd.h>
+#include "code_buffer.h"
+
+#ifndef IOV_MAX
+#define IOV_MAX 1024
+#endif
+
+Code_buffer::Code_buffer(bool lean_code)
+{
+  tail_data = NULL;
+  last = NULL;
+  tail_used = 0;
+  tail_size = 0;
+  growing = false;
+  length = 0;
+  lean = lean_code;
+  comment = false;
+}
+
+Code_buffer& Code_buffer::operator<<(const char* text)
+{
+  write(text, strlen(text));
+  return *this;
+}
+
+Code_buffer& Code_buffer::operator<<(const std::string& text)
+{
+  write(text.data(), text.size());
+  return *this;
+}
+
+Code_buffer& Code_buffer::operator<<(char c)
+{
+  write(&c, 1);
+  return *this;
+}
+
+Code_buffer& Code_buffer::operator<<(int value)
+{
+  integer(value < 0 ? 0ULL - value : value, value < 0);
+  return *this;
+}
+
+Code_buffer& Code_buffer::operator<<(unsigned int value)
+{
+  integer(value, false);
+  return *this;
+}
+
+Code_buffer& Code_buffer::operator<<(long value)
+{
+  integer(value < 0 ? 0ULL - value : value, value < 0);
+  return *this;
+}
+
+Code_buffer& Code_buffer::operator<<(unsigned long value)
+{
+  integer(value, false);
+  return *this;
+}
+
+Code_buffer& Code_buffer::operator<<(long long value)
+{
+  integer(value < 0 ? 0ULL - value : value, value < 0);
+  return *this;
+}
+
+Code_buffer& Code_buffer::operator<<(unsigned long long value)
+{
+  integer(value, false);
+  return *this;
+}
+
+// Digits are written from the end of a small array, the same text an ostream writes
+void Code_buffer::integer(unsigned long long value, bool negative)
+{
+  char digits[24];
+  char* first = digits + sizeof(digits);
+  do {
+    *--first = '0' + value % 10;
+    value /= 10;
+  } while (value);
+  if (negative)
+    *--first = '-';
+  write(first, digits + sizeof(digits) - first);
+}
+
+void Code_buffer::write(const char* text, size_t size)
+{
+  if (!lean) { // Appended to the open piece without another call, most code is written in small parts
+    if (growing && tail_size - tail_used >= size) {
+      memcpy(tail_data + tail_used, text, size);
+      last->size += size;
+      tail_used += size;
+      length += size;
+    }
+    else
+      copy(text, size);
+    return;
+  }
+
+  // Generated comments run from // to the end of the line, strings of the source can't hold a /
+  while (size) {
+    if (comment) {
+      const char* end = (const char*)memchr(text, '\n', size);
+      if (!end)
+        return;
+      comment = false;
+      size -= end - text;
+      text = end;
+      continue;
+    }
+    const char* start = text;
+    const char* slash = NULL;
+    while ((slash = (const char*)memchr(start, '/', size - (start - text))) && slash + 1 < text + size && slash[1] != '/')
+      start = slash + 1;
+    if (!slash || slash + 1 == text + size) {
+      copy(text, size);
+      return;
+    }
+    const char* code_end = slash;
+    while (code_end > text && (code_end[-1] == '\t' || code_end[-1] == ' '))
+      code_end--;
+    copy(text, code_end - text);
+    comment = true;
+    size -= slash + 2 - text;
+    text = slash + 2;
+  }
+}
+
+void Code_buffer::copy(const char* text, size_t size)
+{
+  if (!size)
+    return;
+  if (tail_size - tail_used < size) {
+    tail_size = std::max(tail_data ? std::min(2 * tail_size, (size_t)CODE_BLOCK_MAX) : (size_t)CODE_BLOCK_MIN, size);
+    tail_data = new char[tail_size];
+    tail.reset(tail_data, std::default_delete<char[]>());
+    tail_used = 0;
+    growing = false;
+  }
+  memcpy(tail_data + tail_used, text, size);
+  if (growing)
+    last->size += size;
+  else {
+    Piece piece = {tail, tail_used, size};
+    pieces.push_back(piece);
+    last = &pieces.back();
+    growing = true;
+  }
+  tail_used += size;
+  length += size;
+}
+
+void Code_buffer::append(Code_buffer& other)
+{
+  if (pieces.empty())
+    pieces.swap(other.pieces);
+  else
+    pieces.insert(pieces.end(), other.pieces.begin(), other.pieces.end());
+  length += other.length;
+  growing = false;
+  other.clear();
+}
+
+void Code_buffer::append(const Code_buffer& other, size_t begin, size_t end)
+{
+  size_t position = 0;
+  for (unsigned int i = 0; i < other.pieces.size() && position < end; i++) {
+    const Piece& piece = other.pieces[i];
+    size_t first = std::max(begin, position);
+    size_t last = std::min(end, position + piece.size);
+    position += piece.size;
+    if (first >= last)
+      continue;
+    Piece part = {piece.block, piece.offset + first - (position - piece.size), last - first};
+    if (!pieces.empty() && pieces.back().block == part.block && pieces.back().offset + pieces.back().size == part.offset)
+      pieces.back().size += part.size;
+    else
+      pieces.push_back(part);
+    length += part.size;
+    growing = false;
+  }
+}
+
+std::string Code_buffer::str() const
+{
+  std::string text;
+  text.reserve(length);
+  for (unsigned int i = 0; i < pieces.size(); i++)
+    text.append(pieces[i].block.get() + pieces[i].offset, pieces[i].size);
+  return text;
+}
+
+void Code_buffer::clear()
+{
+  pieces.clear();
+  length = 0;
+  growing = false;
+  comment = false;
+}
+
+// The pieces are written where they are, by one writev unless there are more than it takes
+bool Code_buffer::write_file(std::string path) const
+{
+  int fd = open(path.c_str(), O_WRONLY | O_CREAT | O_TRUNC, 0666);
+  if (fd < 0)
+    return false;
+  std::vector<struct iovec> vectors(pieces.size());
+  for (unsigned int i = 0; i < pieces.size(); i++) {
+    vectors[i].iov_base = pieces[i].block.get() + pieces[i].offset;
+    vectors[i].iov_len = pieces[i].size;
+  }
+
+  bool written = true;
+  size_t next = 0;
+  while (next < vectors.size()) {
+    ssize_t done = writev(fd, &vectors[next], std::min(vectors.size() - next, (size_t)IOV_MAX));
+    if (done < 0 && errno == EINTR)
+      continue;
+    if (done < 0) {
+      written = false;
+      break;
+    }
+    // A short write goes on from inside a piece
+    for (; next < vectors.size() && (size_t)done >= vectors[next].iov_len; next++)
+      done -= vectors[next].iov_len;
+    if (done) {
+      vectors[next].iov_base = (char*)vectors[next].iov_base + done;
+      vectors[next].iov_len -= done;
+    }
+  }
+  return close(fd) == 0 && written;
+}
+
+void Code_buffer::write_to(std::ostream& out) const
+{
+  for (unsigned int i = 0; i < pieces.size(); i++)
+    out.write(pieces[i].block.get() + pieces[i].offset, pieces[i].size);
+}
@@ -0,0 +1,61 @@
+#ifndef CODE_BUFFER_H
+#define CODE_BUFFER_H
+
+#include <string>
+#include <vector>
+#include <memory>
+#include <ostream>
+
+#define CODE_BLOCK_MIN 256     // Bytes of the first block of a buffer, each next one is twice as large
+#define CODE_BLOCK_MAX 65536
+
+// Generated code, appended to blocks that are never moved once written.
+// A buffer is a list of pieces of blocks, so buffers are moved into one another and spliced without copying
+// their text, and a whole file is written from the pieces with writev
+class Code_buffer {
+  public:
+    Code_buffer(bool lean_code = false);
+
+    Code_buffer& operator<<(const char* text);
+    Code_buffer& operator<<(const std::string& text);
+    Code_buffer& operator<<(char c);
+    Code_buffer& operator<<(int value);
+    Code_buffer& operator<<(unsigned int value);
+    Code_buffer& operator<<(long value);
+    Code_buffer& operator<<(unsigned long value);
+    Code_buffer& operator<<(long long value);
+    Code_buffer& operator<<(unsigned long long value);
+
+    void write(const char* text, size_t size);
+    void append(Code_buffer& other);                                  // Moves all of other's text, other is left empty
+    void append(const Code_buffer& other, size_t begin, size_t end);  // Shares part of other's text
+    size_t size() const { return length; }
+    std::string str() const;
+    void clear();
+
+    bool write_file(std::string path) const;
+    void write_to(std::ostream& out) const;
+
+  private:
+    struct Piece {
+      std::shared_ptr<char> block;
+      size_t offset;
+      size_t size;
+    };
+
+    void copy(const char* text, size_t size);
+    void integer(unsigned long long value, bool negative);
+
+    std::vector<Piece> pieces;
+    std::shared_ptr<char> tail;  // Block this buffer writes to, others may share what was written before
+    char* tail_data;
+    size_t tail_used;
+    size_t tail_size;
+    Piece* last;
+    bool growing;                // The last piece ends where the tail is written next, so it grows with it
+    size_t length;
+    bool lean;                   // Comments are left out, from // to the end of the line
+    bool comment;                // In a comment being left out
+};
+
+#endif
@@ -1,24 +1,231 @@
+#include <algorithm>
+#include <sys/stat.h>
+#include <unistd.h>
+#include <thread>
 #include "codegenerator.h"
+#include "interface.h"
 #include "parser.h"
 
-Code_generator::Code_generator(std::string filename)
+Expression::Expression(expression_t k, type_t t)
+{
+  kind = k;
+  type = t;
+  sym = NULL;
+  relop = IS_EQUAL;
+  int_value = 0;
+  float_value = 0;
+  left = NULL;
+  right = NULL;
+}
+
+Expression::~Expression()
+{
+  delete left;
+  delete right;
+}
+
+// Address of an array element, the array base plus the index scaled by the element size
+static Expression* element_of(Symbol* sym, Expression* index)
+{
+  if (sym->symbol_type.size() > 1) {
+    Expression* offset = new Expression(EXP_OPERATION, TYPE_INT);
+    offset->op = "*";
+    offset->left = index;
+    offset->right = new Expression(EXP_CONSTANT, TYPE_INT);
+    offset->right->int_value = sym->symbol_type.size();
+    index = offset;
+  }
+  Expression* e = new Expression(EXP_OPERATION, TYPE_INT);
+  e->op = "+";
+  e->left = new Expression(EXP_ADDRESS, TYPE_INT);
+  e->left->sym = sym;
+  e->right = index;
+  return e;
+}
+
+// Values known on both of two paths, held in the same variable on each
+static std::vector<Value> intersection(const std::vector<Value>& a, const std::vector<Value>& b)
+{
+  std::vector<Value> both;
+  for (unsigned int i = 0; i < a.size(); i++) {
+    for (unsigned int j = 0; j < b.size(); j++) {
+      if (a[i].name == b[j].name) {
+        both.push_back(a[i]);
+        break;
+      }
+    }
+  }
+  return both;
+}
+
+// Stack slots are whole 8 byte words so every value on the stack stays aligned
+static int slot(int width)
+{
+  return (width + 7) / 8 * 8;
+}
+
+// Array locals of a cache line or more start on a line, the frame reserves room to round the address up
+static bool line_aligned(Symbol* sym)
+{
+  return sym->symbol_type.array() && !sym->reference && !sym->is_global && sym->width >= CACHE_LINE;
+}
+
+// Bytes a local takes in the frame
+static int frame_bytes(Symbol* sym)
+{
+  if (sym->reference)
+    return 8;
+  if (line_aligned(sym))
+    return slot(sym->width) + CACHE_LINE - 8;
+  return slot(sym->width);
+}
+
+// Identifies a native build by a hash of its command and the contents of every file that goes into it
+static std::string build_key(std::string command, std::vector<std::string> &inputs)
+{
+  std::stringstream text;
+  text << command << "\n";
+  for (unsigned int i = 0; i < inputs.size(); i++) {
+    std::ifstream ifs(inputs[i].c_str(), std::ios_base::in | std::ios_base::binary);
+    text << inputs[i] << "\n";
+    if (ifs && ifs.peek() != EOF)
+      text << ifs.rdbuf();
+    text << "\n";
+  }
+
+  std::string bytes = text.str();
+  std::stringstream key;
+  key << std::hex << hash_bytes(bytes) << " " << bytes.size();
+  return key.str();
+}
+
+// C type a value is stored as in memory
+static std::string c_type(type_t type, unsigned int size)
+{
+  if (type == TYPE_BOOL)
+    return "bool";
+  if (type == TYPE_FLOAT)
+    return "double";
+  switch (size) {
+    case 1:
+      return "signed char";
+    case 2:
+      return "short";
+    case 4:
+      return "int";
+    default:
+      return "long long";
+  }
+}
+
+Code_generator::Code_generator(Compilation& compilation) : context(compilation), file_code(compilation.lean), runtime_code(compilation.lean)
 {
   reg = 0;
+  stacked = 0;
+  stacked_from = 0;
   static_address = 0;
   label_num = 0;
+  rel_fp_address = 0;
+  temporary_num = 0;
+  reachable = true;
   
   // Strip off extension of input file and append .c for output file
-  int lastindex = filename.find_last_of("."); 
-  rawname = filename.substr(0, lastindex); 
-  output_file.open(rawname+".c", std::ios_base::out | std::ios_base::trunc);
+  int lastindex = context.filename.find_last_of("."); 
+  rawname = context.filename.substr(0, lastindex); 
+  output = &file_code;
+  
+  // Split C is only written to files
+  shard = -1;
+  shards = context.code ? 0 : context.shards;
+  shard_code = shards ? new Code_buffer[shards] : NULL;
+  for (int i = 0; i < shards; i++)
+    shard_code[i] = Code_buffer(context.lean);
+  shard_entries.resize(shards);
 }
 
 Code_generator::~Code_generator()
 {
-  output_file.close();
-  std::string command = "gcc -g -o "+rawname+" "+rawname+".c";
-  if (!Scanner::num_errors)
-    system(command.c_str()); // Compile C to native code
+  delete [] shard_code;
+  if (context.code) {
+    file_code.write_to(*context.code);
+    return;
+  }
+  if (!file_code.write_file(rawname+".c")) {
+    context.errors << "Cannot write " << rawname << ".c\n";
+    return;
+  }
+  if (context.num_errors)
+    return;
+  
+  // Generated code puns doubles through the long long registers and relies on wrapping arithmetic.
+  // The runtime is compiled once into a library, with link time optimization its helpers can still be inlined
+  std::string runtime = RUNTIME_DIR;
+  std::string library = runtime+(context.lto ? "/libruntime_lto.a" : "/libruntime.a");
+  std::string compile = "gcc -g -O2 -fno-strict-aliasing -fwrapv"+std::string(context.lto ? " -flto" : "")+" -I\""+runtime+"\"";
+  std::vector<std::string> inputs(1, rawname+".c");
+  inputs.push_back(runtime+"/runtime.h");
+  
+  // A module becomes an object linked into the programs that import it
+  if (!module_name.empty()) {
+    build(compile+" -c -o "+rawname+".o "+rawname+".c", rawname+".o", inputs);
+    return;
+  }
+  if (objects.empty() && !shards) {
+    inputs.push_back(library);
+    build(compile+" -o "+rawname+" "+rawname+".c \""+library+"\"", rawname, inputs);
+    return;
+  }
+  
+  // The program's own C files are compiled at once, then linked with the objects of the modules it uses
+  std::vector<std::string> units(1, rawname);
+  for (int i = 1; i <= shards; i++)
+    units.push_back(rawname+"_"+std::to_string(i));
+  std::vector<char> built(units.size(), false);
+  std::vector<std::thread> jobs;
+  for (unsigned int i = 0; i < units.size(); i++) {
+    jobs.push_back(std::thread([&, i]() {
+      std::vector<std::string> source(1, units[i]+".c");
+      source.push_back(runtime+"/runtime.h");
+      if (shards)
+        source.push_back(rawname+".h");
+      built[i] = build(compile+" -c -o "+units[i]+".o "+units[i]+".c", units[i]+".o", source);
+    }));
+  }
+  for (unsigned int i = 0; i < jobs.size(); i++)
+    jobs[i].join();
+  
+  std::string command = "gcc -g"+std::string(context.lto ? " -flto -O2" : "")+" -o "+rawname;
+  inputs.clear();
+  for (unsigned int i = 0; i < units.size(); i++) {
+    if (!built[i])
+      return;
+    command += " "+units[i]+".o";
+    inputs.push_back(units[i]+".o");
+  }
+  for (unsigned int i = 0; i < objects.size(); i++) {
+    command += " \""+objects[i]+"\"";
+    inputs.push_back(objects[i]);
+  }
+  inputs.push_back(library);
+  build(command+" \""+library+"\"", rawname, inputs);
+}
+
+// Runs a gcc command unless the stamp of its target shows it was already run on the same inputs
+bool Code_generator::build(std::string command, std::string target, std::vector<std::string> &inputs)
+{
+  std::string stamp = target+".build";
+  std::string key = build_key(command, inputs);
+  std::ifstream previous(stamp.c_str());
+  std::string built;
+  std::getline(previous, built);
+  if (built == key && access(target.c_str(), F_OK) == 0)
+    return true;
+  remove(stamp.c_str());
+  if (system(command.c_str()) != 0)
+    return false;
+  std::ofstream record(stamp.c_str(), std::ios_base::out | std::ios_base::trunc);
+  record << key << "\n";
+  return true;
 }
 
 int Code_generator::next_label()
@@ -26,266 +233,925 @@ int Code_generator::next_label()
   return ++label_num;
 }
 
-void Code_generator::main_runtime()
+void Code_generator::main_runtime(std::vector<Symbol*> &runtime)
 {
-  output_file << "#include \"runtime.c\"\n\n";
-  output_file << "int main() {\n";
-  output_file << "\tgoto start;\n";
+  // Split C shares its declarations through a header
+  Code_buffer header(context.lean);
+  Code_buffer& declarations = shards ? header : *output;
+  if (shards)
+    *output << "#include \"" << rawname.substr(rawname.find_last_of('/') + 1) << ".h\"\n\n";
+  declarations << "#include \"runtime.h\"\n\n";
+  for (unsigned int i = 0; i < imports.size(); i++) {
+    declarations << "extern long long " << imports[i] << "_data;\n";
+    declarations << "void " << imports[i] << "(int entry);\n";
+    declarations << "void " << imports[i] << "_init();\n\n";
+  }
+  for (int i = 1; i <= shards; i++)
+    declarations << "void shard_" << i << "(int entry);\n";
+  if (shards && !header.write_file(rawname+".h"))
+    context.errors << "Cannot write " << rawname << ".h\n";
+  
+  if (module_name.empty()) {
+    *output << "long long static_data();\n\n";
+    *output << "int main() {\n";
+    *output << "\tgoto start;\n";
+  }
+  else { // Procedures of a module are labels of one function, entered by the number of the procedure
+    *output << "long long " << module_name << "_data;\t\t// Start of the module's static memory\n\n";
+    *output << "void " << module_name << "(int entry) {\n";
+    *output << "\tgoto enter_function;\n";
+  }
 
+  // Runtime procedures are leaves, their parameters are C variables. Every function of split C has its own copy
+  Code_buffer* file = output;
+  output = &runtime_code;
   Symbol* sym;
 
   sym = new Symbol("getbool", true);
   sym->params = new Symbol("bb", false, TYPE_BOOL, 1);
-  sym->params->address = 3;
   sym->params->direction = DIRECTION_OUT;
-  Parser::add_to_symbol_table(sym);
-  output_file << "getbool:\n";
-  output_file << "\tMM[Reg[FP]+3] = getBool();\n";
-  callee_return(true);
+  leaf_procedure(sym);
+  leaf_variable(sym, sym->params);
+  runtime.push_back(sym);
+  *output << "getbool:\n";
+  *output << "\t" << sym->params->variable << " = getBool();\n";
+  *output << "\tgoto *" << sym->variable << ";\n";
 
   sym = new Symbol("getinteger", true);
   sym->params = new Symbol("ii", false, TYPE_INT, 1);
-  sym->params->address = 3;
   sym->params->direction = DIRECTION_OUT;
-  Parser::add_to_symbol_table(sym);
-  output_file << "getinteger:\n";
-  output_file << "\tMM[Reg[FP]+3] = getInteger();\n";
-  callee_return(true);
+  leaf_procedure(sym);
+  leaf_variable(sym, sym->params);
+  runtime.push_back(sym);
+  *output << "getinteger:\n";
+  *output << "\t" << sym->params->variable << " = getInteger();\n";
+  *output << "\tgoto *" << sym->variable << ";\n";
 
   sym = new Symbol("getfloat", true);
   sym->params = new Symbol("ff", false, TYPE_FLOAT, 1);
-  sym->params->address = 3;
   sym->params->direction = DIRECTION_OUT;
-  Parser::add_to_symbol_table(sym);
-  output_file << "getfloat:\n";
-  output_file << "\t*((double*)&MM[Reg[FP]+3]) = getFloat();\n";
-  callee_return(true);
+  leaf_procedure(sym);
+  leaf_variable(sym, sym->params);
+  runtime.push_back(sym);
+  *output << "getfloat:\n";
+  *output << "\t" << sym->params->variable << " = getFloat();\n";
+  *output << "\tgoto *" << sym->variable << ";\n";
 
   sym = new Symbol("getstring", true);
   sym->params = new Symbol("ss", false, TYPE_STRING, 1);
-  sym->params->address = 3;
   sym->params->direction = DIRECTION_OUT;
-  Parser::add_to_symbol_table(sym);
-  output_file << "getstring:\n";
-  output_file << "\tMM[Reg[FP]+3] = (long long)getString();\n";
-  callee_return(true);
+  leaf_procedure(sym);
+  leaf_variable(sym, sym->params);
+  runtime.push_back(sym);
+  *output << "getstring:\n";
+  *output << "\t" << sym->params->variable << " = (long long)getString();\n";
+  *output << "\tgoto *" << sym->variable << ";\n";
 
   sym = new Symbol("putbool", true);
   sym->params = new Symbol("b", false, TYPE_BOOL, 1);
-  sym->params->address = 2;
   sym->params->direction = DIRECTION_IN;
-  Parser::add_to_symbol_table(sym);
-  output_file << "putbool:\n";
-  output_file << "\tputBool(MM[Reg[FP]+2]);\n";
-  callee_return(true);
+  leaf_procedure(sym);
+  leaf_variable(sym, sym->params);
+  runtime.push_back(sym);
+  *output << "putbool:\n";
+  *output << "\tputBool(" << sym->params->variable << ");\n";
+  *output << "\tgoto *" << sym->variable << ";\n";
 
   sym = new Symbol("putinteger", true);
   sym->params = new Symbol("i", false, TYPE_INT, 1);
-  sym->params->address = 2;
   sym->params->direction = DIRECTION_IN;
-  Parser::add_to_symbol_table(sym);
-  output_file << "putinteger:\n";
-  output_file << "\tputInteger(MM[Reg[FP]+2]);\n";
-  callee_return(true);
+  leaf_procedure(sym);
+  leaf_variable(sym, sym->params);
+  runtime.push_back(sym);
+  *output << "putinteger:\n";
+  *output << "\tputInteger(" << sym->params->variable << ");\n";
+  *output << "\tgoto *" << sym->variable << ";\n";
 
   sym = new Symbol("putfloat", true);
   sym->params = new Symbol("f", false, TYPE_FLOAT, 1);
-  sym->params->address = 2;
   sym->params->direction = DIRECTION_IN;
-  Parser::add_to_symbol_table(sym);
-  output_file << "putfloat:\n";
-  output_file << "\tputFloat(*((double*)&MM[Reg[FP]+2]));\n";
-  callee_return(true);
+  leaf_procedure(sym);
+  leaf_variable(sym, sym->params);
+  runtime.push_back(sym);
+  *output << "putfloat:\n";
+  *output << "\tputFloat(" << sym->params->variable << ");\n";
+  *output << "\tgoto *" << sym->variable << ";\n";
 
   sym = new Symbol("putstring", true);
   sym->params = new Symbol("s", false, TYPE_STRING, 1);
-  sym->params->address = 2;
   sym->params->direction = DIRECTION_IN;
-  Parser::add_to_symbol_table(sym);
-  output_file << "putstring:\n";
-  output_file << "\tReg[0] = MM[Reg[FP]+2];\n";
-  output_file << "\tputString((char*)Reg[0]);\n";
-  callee_return(true);
+  leaf_procedure(sym);
+  leaf_variable(sym, sym->params);
+  runtime.push_back(sym);
+  *output << "putstring:\n";
+  *output << "\tputString((char*)" << sym->params->variable << ");\n";
+  *output << "\tgoto *" << sym->variable << ";\n";
+  
+  output = file;
+  output->append(runtime_code, 0, runtime_code.size());
 }
 
 void Code_generator::start()
 {
-  output_file << "start:\n";
-  output_file << "\tinit(" << static_address << ");\n";
+  *output << "start:\n";
+  *output << "\tinit(static_data());\t\t// Static memory is only known once the whole program is parsed\n";
+  for (unsigned int i = 0; i < imports.size(); i++)
+    *output << "\t" << imports[i] << "_init();\n";
 }
 
 void Code_generator::exit()
 {
-  output_file << "\treturn 0;\n}\n";
+  if (!module_name.empty()) {
+    exit_module();
+    return;
+  }
+  *output << "\treturn 0;\n}\n";
+  
+  // Each string constant is copied into static memory once, the returned size is where the heap starts
+  *output << "\nlong long static_data()\n{\n";
+  for (std::map<std::string, int>::iterator it = strings.begin(); it != strings.end(); it++)
+    *output << "\tstrcpy(&MEM(char, " << it->second << "), \"" << it->first << "\");\n";
+  *output << "\treturn " << static_address << ";\n}\n";
+  
+  // Each shard is a function holding its procedures, entered like a module
+  for (int i = 1; i <= shards; i++) {
+    Code_buffer shard_file(context.lean);
+    shard_file << "#include \"" << rawname.substr(rawname.find_last_of('/') + 1) << ".h\"\n\n";
+    shard_file << "void shard_" << i << "(int entry) {\n";
+    shard_file << "\tgoto enter_function;\n";
+    shard_file.append(runtime_code, 0, runtime_code.size());
+    shard_file.append(shard_code[i-1]);
+    entry_points(shard_file, shard_entries[i-1]);
+    if (!shard_file.write_file(rawname+"_"+std::to_string(i)+".c"))
+      context.errors << "Cannot write " << rawname << "_" << i << ".c\n";
+  }
+}
+
+// A call from another function has pushed the arguments, the return into the caller's function is a C return
+void Code_generator::entry_points(Code_buffer& out, std::vector<Symbol*> &procedures)
+{
+  out << "enter_function:\n";
+  out << "\tReg[SP] = Reg[SP] - 8;\t\t// Allocate space for return address\n";
+  out << "\tMEM(long long, Reg[SP]) = (long long)&&leave_function;\t\t// save return address\n";
+  out << "\tReg[SP] = Reg[SP] - 8;\t\t// Allocate space for FP\n";
+  out << "\tMEM(long long, Reg[SP]) = Reg[FP];\t\t// Save frame pointer\n";
+  out << "\tReg[FP] = Reg[SP];\t\t// Move frame pointer to new position\n";
+  out << "\tswitch (entry) {\n";
+  for (unsigned int i = 0; i < procedures.size(); i++)
+    out << "\t\tcase " << i << ": goto " << procedures[i]->name << ";\n";
+  out << "\t}\n";
+  out << "leave_function:\n";
+  out << "\treturn;\n}\n";
+}
+
+void Code_generator::exit_module()
+{
+  entry_points(*output, exports);
+  
+  // The module's static memory is placed on the heap when the program starts
+  *output << "\nvoid " << module_name << "_init()\n{\n";
+  *output << "\t" << module_name << "_data = (heapAlloc(" << static_address << " + 7) + 7) & -8;\n";
+  for (std::map<std::string, int>::iterator it = strings.begin(); it != strings.end(); it++)
+    *output << "\tstrcpy(&MEM(char, " << module_name << "_data + " << it->second << "), \"" << it->first << "\");\n";
+  *output << "}\n";
+}
+
+void Code_generator::module(std::string name)
+{
+  module_name = "module_" + name;
+}
+
+void Code_generator::import(std::string name, std::string object)
+{
+  imports.push_back("module_" + name);
+  objects.push_back(object);
+}
+
+// An exported procedure is numbered by the order it is declared in
+void Code_generator::export_procedure(Symbol* procedure)
+{
+  procedure->address = exports.size();
+  exports.push_back(procedure);
+}
+
+// Procedures of a program split into shards are spread over them, each goes to the one with the least code so far
+bool Code_generator::shard_procedure(Symbol* procedure)
+{
+  if (!shards || !module_name.empty())
+    return false;
+  shard = 0;
+  for (int i = 1; i < shards; i++) {
+    if (shard_code[i].size() < shard_code[shard].size())
+      shard = i;
+  }
+  procedure->module = "shard_" + std::to_string(shard + 1);
+  procedure->address = shard_entries[shard].size();
+  shard_entries[shard].push_back(procedure);
+  output = &shard_code[shard];
+  return true;
+}
+
+// Back to the main function once a procedure placed in a shard is complete
+void Code_generator::leave_shard()
+{
+  if (shard < 0)
+    return;
+  shard = -1;
+  output = &file_code;
+}
+
+bool Code_generator::sharded()
+{
+  return shards > 0;
+}
+
+// Whether a procedure is in another C function, so it must be called through it
+bool Code_generator::external(Symbol* procedure)
+{
+  return !procedure->module.empty() && (shard < 0 || procedure->module != "shard_" + std::to_string(shard + 1));
+}
+
+void Code_generator::module_call(Symbol* procedure)
+{
+  *procedure_code.top() << "\t" << procedure->module << "(" << procedure->address << ");\t\t// call " << procedure->name << " in another function\n";
 }
 
 void Code_generator::enter_procedure()
 {
-  std::stringstream* sstream = new std::stringstream;
-  procedure_code.push(sstream);
+  Code_buffer* code = new Code_buffer(context.lean);
+  procedure_code.push(code);
+  insertions.push(std::vector<Insertion>());
+  tail_calls.push(std::vector<Tail_call>());
+  bodies.push(code);
+  forget();
+  pending.clear();
+  reachable = true;
 }
 
 void Code_generator::emit_procedure()
 {
-  if (procedure_code.top()->rdbuf()->in_avail()) // Needed to add this in case of empty buffer which screws up output_file
-    output_file << procedure_code.top()->rdbuf();
-  if (!procedure_code.empty())
-    delete procedure_code.top();
+  splice(*output, procedure_code.top(), insertions.top());
+  delete procedure_code.top();
   procedure_code.pop();
+  insertions.pop();
+  tail_calls.pop();
+  bodies.pop();
+  forget();
+  pending.clear();
+  reachable = true;
 }
 
-void Code_generator::arithmetic_operation(type_t type, const char* op)
+// Adds a procedure's code with the code only known after its position was passed spliced in.
+// Only the insertions are copied, the procedure's text is shared
+void Code_generator::splice(Code_buffer& out, Code_buffer* code, std::vector<Insertion> &positions)
 {
-  int reg1 = reg_num_stack.top() - 1;
-  if (type != TYPE_FLOAT)
-    *procedure_code.top() << "\tReg[" << reg1 << "] = " << "Reg[" << reg1 << "] " << op << " Reg[" << reg_num_stack.top() << "];\t// expression = operand1 & operand2\n";
-  else
-    *procedure_code.top() << "\t*((double*)&Reg[" << reg1 << "] = " << "*((double*)&Reg[" << reg1 << "]) " << op << " *((double*)&Reg[" << reg_num_stack.top() << "]);\t// expression = operand1 & operand2\n";
-  reg_num_stack.pop();
-  reg--;
+  size_t last = 0;
+  for (unsigned int i = 0; i < positions.size(); i++) {
+    out.append(*code, last, positions[i].position);
+    out << positions[i].code;
+    last = positions[i].position;
+  }
+  out.append(*code, last, code->size());
 }
 
-void Code_generator::relation_operation(relative_op_t relop)
+int Code_generator::insertion_point()
 {
-  int reg1 = reg_num_stack.top() - 1;
+  Insertion insertion;
+  insertion.position = procedure_code.top()->size();
+  insertions.top().push_back(insertion);
+  return insertions.top().size() - 1;
+}
 
-  *procedure_code.top() << "\tReg[" << reg1 << "] = " << "Reg[" << reg1 << "] ";
-  output_relop(relop);
-  *procedure_code.top() << " Reg[" << reg_num_stack.top() << "];\t// relation = operand1 relop operand2\n";
+Expression* Code_generator::pop()
+{
+  if (expressions.empty()) // Only after a syntax error, when no code is written
+    return new Expression(EXP_CONSTANT, TYPE_INT);
+  Expression* e = expressions.back();
+  expressions.pop_back();
+  return e;
+}
 
-  reg_num_stack.pop();
-  reg--;
+// Called once an expression is complete, before any of it is emitted
+Expression* Code_generator::optimize(Expression* e)
+{
+  return hoist(checked(e), loops.size());
 }
 
-void Code_generator::invert()
+// Drop the checks of integers compared to bools that can only be 0 or 1
+Expression* Code_generator::checked(Expression* e)
 {
-  *procedure_code.top() << "\tReg[" << reg_num_stack.top() << "] = ~Reg[" << reg_num_stack.top() << "];\t\t//\n";
+  if (e == NULL)
+    return e;
+  e->left = checked(e->left);
+  e->right = checked(e->right);
+  long long low, high;
+  if (e->kind == EXP_CHECK && bounds(e->left, low, high) && low >= 0 && high <= 1) {
+    Expression* value = e->left;
+    e->left = NULL;
+    delete e;
+    return value;
+  }
+  return e;
 }
 
-void Code_generator::change_sign(type_t type)
+// Range an integer expression's value lies in, false if nothing is known about it
+bool Code_generator::bounds(Expression* e, long long& low, long long& high)
 {
-  if (type == TYPE_INT)
-    *procedure_code.top() << "\tReg[" << reg_num_stack.top() << "] = - Reg[" << reg_num_stack.top() << "];\t\t//\n";
+  const long long limit = 1LL << 31; // Products of values below this can't overflow
+  long long left_low, left_high, right_low, right_high;
+  if (e->type == TYPE_BOOL) {
+    low = 0;
+    high = 1;
+    return true;
+  }
+  if (e->type != TYPE_INT)
+    return false;
+  
+  switch (e->kind) {
+    case EXP_CONSTANT:
+      low = high = e->int_value;
+      return true;
+    case EXP_VALUE: {
+      std::map<Symbol*, std::pair<long long, long long> >::iterator found = ranges.find(e->sym);
+      if (found == ranges.end())
+        return false;
+      low = found->second.first;
+      high = found->second.second;
+      return true;
+    }
+    case EXP_CHECK:
+      return bounds(e->left, low, high);
+    case EXP_NEGATE:
+      if (!bounds(e->left, left_low, left_high) || left_low <= -limit || left_high >= limit)
+        return false;
+      low = -left_high;
+      high = -left_low;
+      return true;
+    case EXP_OPERATION:
+      break;
+    default:
+      return false;
+  }
+  
+  bool left = bounds(e->left, left_low, left_high) && left_low > -limit && left_high < limit;
+  bool right = bounds(e->right, right_low, right_high) && right_low > -limit && right_high < limit;
+  if (e->op == "&") { // Masking with a value that isn't negative bounds the result by it
+    if (left && left_low >= 0 && (!right || right_low < 0 || left_high <= right_high)) {
+      low = 0;
+      high = left_high;
+      return true;
+    }
+    if (right && right_low >= 0) {
+      low = 0;
+      high = right_high;
+      return true;
+    }
+    return false;
+  }
+  if (!left || !right)
+    return false;
+  if (e->op == "+") {
+    low = left_low + right_low;
+    high = left_high + right_high;
+  }
+  else if (e->op == "-") {
+    low = left_low - right_high;
+    high = left_high - right_low;
+  }
+  else if (e->op == "*") {
+    long long products[] = { left_low * right_low, left_low * right_high, left_high * right_low, left_high * right_high };
+    low = *std::min_element(products, products + 4);
+    high = *std::max_element(products, products + 4);
+  }
+  else if (e->op == "/" && right_low == right_high && right_low > 0) { // Truncation keeps the order
+    low = left_low / right_low;
+    high = left_high / right_low;
+  }
+  else if (e->op == "|" && left_low >= 0 && right_low >= 0) { // No bit above the highest set in either
+    low = std::max(left_low, right_low);
+    for (high = 1; high < std::max(left_high, right_high); high = high * 2 + 1)
+      ;
+    high = std::max(high, std::max(left_high, right_high));
+  }
   else
-    *procedure_code.top() << "\t*((double*)Reg[" << reg_num_stack.top() << "]) = - *((double*)Reg[" << reg_num_stack.top() << "]);\t\t//\n";
+    return false;
+  return true;
 }
 
-void Code_generator::calculate_address(Symbol *sym)
+// C text for a value that needs no code of its own, empty if it must be evaluated into a register
+std::string Code_generator::operand(Expression* e)
+{
+  std::stringstream text;
+  switch (e->kind) {
+    case EXP_CONSTANT:
+      if (e->type == TYPE_BOOL)
+        text << (e->int_value ? "true" : "false");
+      else if (e->type == TYPE_FLOAT)
+        text << e->float_value;
+      else
+        text << e->int_value;
+      break;
+    case EXP_TEMPORARY:
+      text << e->name;
+      break;
+    case EXP_STRING:
+      if (module_name.empty())
+        text << "(long long)&MEM(char, " << e->int_value << ")";
+      else
+        text << "(long long)&MEM(char, " << module_name << "_data + " << e->int_value << ")";
+      break;
+    case EXP_ADDRESS:
+      if (e->sym->is_global)
+        text << address(e->sym);
+      else
+        text << "(" << address(e->sym) << ")";
+      break;
+    case EXP_VALUE:
+      if (!induction_variable(e->sym).empty())
+        text << induction_variable(e->sym);
+      else if (e->type == TYPE_INT && e->sym->symbol_type.size() < 8) // Arithmetic is done at register width
+        text << "(long long)" << lvalue(e->sym);
+      else
+        text << lvalue(e->sym);
+      break;
+    case EXP_LOAD:
+    case EXP_OPERATION:
+    case EXP_RELATION:
+    case EXP_INVERT:
+    case EXP_NEGATE:
+    case EXP_CAST:
+      text << recall(e);
+      break;
+    default:
+      break;
+  }
+  return text.str();
+}
+
+// Operand text, or the register it was evaluated into. The register is free again for the next expression.
+std::string Code_generator::value(Expression* e)
 {
-  reg_num_stack.push(reg++);
-  if (sym->is_global)
-    *procedure_code.top() << "\tReg[" << reg_num_stack.top() << "] = " << sym->address <<";\t\t// Get address of array\n";
+  std::string text = operand(e);
+  if (text.empty()) {
+    int r = evaluate(e);
+    reg--;
+    text = register_value(r, e->type);
+  }
+  return text;
+}
+
+// C condition for a branch, relations are compared in place instead of going through a register
+std::string Code_generator::test(Expression* e)
+{
+  if (e->kind != EXP_RELATION)
+    return value(e);
+  
+  // A spilled operand could not be popped on the branch, so such a relation is evaluated into a register first
+  if (reg + need(e) > NUM_REGISTERS)
+    return value(e);
+  
+  int saved_reg = reg;
+  std::string left, right;
+  operands(e->left, e->right, left, right);
+  reg = saved_reg;
+  return left + " " + relop_string(e->relop) + " " + right;
+}
+
+std::string Code_generator::register_value(int r, type_t type)
+{
+  if (type == TYPE_FLOAT)
+    return "*((double*)&Reg[" + std::to_string(r) + "])";
+  return "Reg[" + std::to_string(r) + "]";
+}
+
+// Address of a symbol's storage, arrays passed by reference are reached through their slot
+std::string Code_generator::address(Symbol* sym)
+{
+  if (sym->reference && !sym->variable.empty())
+    return sym->variable;
+  if (sym->reference)
+    return "MEM(long long, " + location(sym) + ")";
+  return location(sym);
+}
+
+// Address of a symbol's own static or frame slot
+std::string Code_generator::location(Symbol* sym)
+{
+  if (sym->is_global && !sym->module.empty())
+    return "(" + sym->module + "_data + " + std::to_string(sym->address) + ")";
+  else if (sym->is_global)
+    return std::to_string(sym->address);
+  else if (sym->id_type == ID_VARIABLE && line_aligned(sym))
+    return "((Reg[FP] - " + std::to_string(sym->address - CACHE_LINE + 1) + ") & -" + std::to_string(CACHE_LINE) + ")";
   else if (sym->id_type == ID_VARIABLE)
-    *procedure_code.top() << "\tReg[" << reg_num_stack.top() << "] = Reg[FP] - " << sym->address <<";\t\t// Get address of array\n";
+    return "Reg[FP] - " + std::to_string(sym->address);
   else
-    *procedure_code.top() << "\tReg[" << reg_num_stack.top() << "] = Reg[FP] + " << sym->address <<";\t\t// Get address of array\n";
+    return "Reg[FP] + " + std::to_string(sym->address);
 }
 
-void Code_generator::calculate_array_element_address(Symbol* sym, bool top, bool addr_already, bool copy_index)
+// Where a scalar is read and written, its C variable or its memory
+std::string Code_generator::lvalue(Symbol* sym)
 {
+  if (!sym->variable.empty())
+    return sym->variable;
+  return memory(address(sym), sym);
+}
 
-  if (copy_index) {
-    int reg1 = reg++;
-    *procedure_code.top() << "\tReg[" << reg1 << "] = Reg[" << reg_num_stack.top() << "];\n";
-  }
-    
-  if (addr_already) {
-    reg_num_stack.push(reg-1);
+// Value of the symbol's type stored at an address
+std::string Code_generator::memory(std::string address, Symbol* sym)
+{
+  return "MEM(" + c_type(sym->symbol_type.type(), sym->symbol_type.size()) + ", " + address + ")";
+}
+
+// Emit code for an expression into the first free register, which is returned and stays allocated
+int Code_generator::evaluate(Expression* e)
+{
+  int r;
+  std::string text = operand(e);
+  if (!text.empty()) {
+    r = reg++;
+    *procedure_code.top() << "\t" << register_value(r, e->type) << " = " << text << ";\t\t// operand\n";
+    return r;
   }
   
-  if (top) {
-    if (sym->is_global)
-      *procedure_code.top() << "\tReg[" << reg_num_stack.top() << "] = " << sym->address <<" + Reg[" << reg_num_stack.top() << "];\t\t// Address of " << sym->name << " + offset\n";
-    else if (sym->id_type == ID_VARIABLE) {
-      *procedure_code.top() << "\tReg[" << reg_num_stack.top() << "] = -" << sym->address <<" + Reg[" << reg_num_stack.top() << "];\t\t// Address of " << sym->name << " + offset\n";
-      *procedure_code.top() << "\tReg[" << reg_num_stack.top() << "] = Reg[FP] + Reg[" << reg_num_stack.top() << "];\n";
-    }
-    else {
-      *procedure_code.top() << "\tReg[" << reg_num_stack.top() << "] = " << sym->address <<" + Reg[" << reg_num_stack.top() << "];\t\t// Address of " << sym->name << " + offset\n";
-      *procedure_code.top() << "\tReg[" << reg_num_stack.top() << "] = Reg[FP] + Reg[" << reg_num_stack.top() << "];\n";
+  switch (e->kind) {
+    case EXP_LOAD:
+      r = evaluate(e->left);
+      *procedure_code.top() << "\t" << register_value(r, e->type) << " = " << memory("Reg[" + std::to_string(r) + "]", e->sym) << ";\t\t// Get array operand\n";
+      break;
+    case EXP_OPERATION:
+    case EXP_RELATION: {
+      std::string op = (e->kind == EXP_RELATION) ? relop_string(e->relop) : e->op;
+      std::string left, right;
+      r = reg;
+      bool spilled = operands(e->left, e->right, left, right);
+      reg = r + 1;
+      *procedure_code.top() << "\t" << register_value(r, e->type) << " = " << left << " " << op << " " << right << ";\t\t// expression = operand1 op operand2\n";
+      if (spilled)
+        *procedure_code.top() << "\tReg[SP] = Reg[SP] + 8;\t\t// Free spilled operand\n";
+      break;
     }
+    case EXP_INVERT:
+      r = evaluate(e->left);
+      *procedure_code.top() << "\tReg[" << r << "] = " << (e->type == TYPE_BOOL ? "!" : "~") << "Reg[" << r << "];\t\t// not\n";
+      break;
+    case EXP_NEGATE:
+      r = evaluate(e->left);
+      *procedure_code.top() << "\t" << register_value(r, e->type) << " = - " << register_value(r, e->type) << ";\t\t// Change sign\n";
+      break;
+    case EXP_CAST:
+      r = evaluate(e->left);
+      *procedure_code.top() << "\t*((double*)&Reg[" << r << "]) = (double)Reg[" << r << "];\t// Conversion\n";
+      break;
+    case EXP_CHECK:
+      r = evaluate(e->left);
+      *procedure_code.top() << "\tif (__builtin_expect((unsigned long long)Reg[" << r << "] > 1, 0))\t\t// Integer compared to a bool\n";
+      *procedure_code.top() << "\t\tdataConversionCheck(Reg[" << r << "]);\n";
+      return r;
+    default:
+      r = reg++;
+      return r;
   }
-  else {
-    int reg1 = reg_num_stack.top()-1;
-    if (sym->is_global)
-      *procedure_code.top() << "\tReg[" << reg1 << "] = " << sym->address <<" + Reg[" << reg1 << "];\t\t// Address of " << sym->name << " + offset\n";
-    else if (sym->id_type == ID_VARIABLE) {
-      *procedure_code.top() << "\tReg[" << reg1 << "] = -" << sym->address <<" + Reg[" << reg1 << "];\t\t// Address of " << sym->name << " + offset\n";
-      *procedure_code.top() << "\tReg[" << reg1 << "] = Reg[FP] + Reg[" << reg1 << "];\n";
+  remember(e, r);
+  return r;
+}
+
+// Registers needed to evaluate an expression without spilling, Sethi-Ullman numbering. Operands need none.
+int Code_generator::need(Expression* e)
+{
+  if (!operand(e).empty())
+    return 0;
+  switch (e->kind) {
+    case EXP_OPERATION:
+    case EXP_RELATION: {
+      int left = need(e->left);
+      int right = need(e->right);
+      if (left == right)
+        return std::max(left + 1, 1);
+      return std::max(left, right);
     }
-    else {
-      *procedure_code.top() << "\tReg[" << reg1 << "] = " << sym->address <<" + Reg[" << reg1 << "];\t\t// Address of " << sym->name << " + offset\n";
-      *procedure_code.top() << "\tReg[" << reg1 << "] = Reg[FP] + Reg[" << reg1 << "];\n";
+    case EXP_LOAD:
+    case EXP_INVERT:
+    case EXP_NEGATE:
+    case EXP_CAST:
+    case EXP_CHECK:
+      return std::max(need(e->left), 1);
+    default:
+      return 1;
+  }
+}
+
+// C text for both operands of a binary expression. The one needing more registers is evaluated first so fewer
+// are live at once, and it is spilled to the stack if the other still needs more than are free. Registers used
+// stay allocated, true if the caller must pop a spilled operand once the text has been used.
+bool Code_generator::operands(Expression* a, Expression* b, std::string& a_text, std::string& b_text)
+{
+  Expression* first = a;
+  Expression* second = b;
+  std::string* first_text = &a_text;
+  std::string* second_text = &b_text;
+  if (need(b) > need(a)) {
+    std::swap(first, second);
+    std::swap(first_text, second_text);
+  }
+  
+  bool spilled = false;
+  *first_text = operand(first);
+  *second_text = operand(second);
+  if (first_text->empty()) {
+    int r = evaluate(first);
+    *first_text = register_value(r, first->type);
+    if (second_text->empty() && reg + need(second) > NUM_REGISTERS) {
+      *procedure_code.top() << "\tReg[SP] = Reg[SP] - 8;\n";
+      *procedure_code.top() << "\tMEM(long long, Reg[SP]) = Reg[" << r << "];\t\t// Spill operand, registers are full\n";
+      *first_text = (first->type == TYPE_FLOAT) ? "MEM(double, Reg[SP])" : "MEM(long long, Reg[SP])";
+      reg--;
+      spilled = true;
     }
   }
-} 
+  if (second_text->empty())
+    *second_text = register_value(evaluate(second), second->type);
+  return spilled;
+}
+
+void Code_generator::arithmetic_operation(type_t type, const char* op)
+{
+  Expression* e = new Expression(EXP_OPERATION, type);
+  e->op = op;
+  e->right = pop();
+  e->left = pop();
+  expressions.push_back(e);
+}
+
+void Code_generator::relation_operation(relative_op_t relop)
+{
+  Expression* e = new Expression(EXP_RELATION, TYPE_BOOL);
+  e->relop = relop;
+  e->right = pop();
+  e->left = pop();
+  expressions.push_back(e);
+}
+
+void Code_generator::invert()
+{
+  Expression* e = pop();
+  Expression* inverted = new Expression(EXP_INVERT, e->type);
+  inverted->left = e;
+  expressions.push_back(inverted);
+}
+
+void Code_generator::change_sign(type_t type)
+{
+  Expression* e = new Expression(EXP_NEGATE, type);
+  e->left = pop();
+  expressions.push_back(e);
+}
+
+void Code_generator::calculate_address(Symbol *sym)
+{
+  Expression* e = new Expression(EXP_ADDRESS, TYPE_INT);
+  e->sym = sym;
+  expressions.push_back(e);
+}
+
+void Code_generator::element_address(Symbol* sym)
+{
+  expressions.push_back(element_of(sym, pop()));
+}
 
 void Code_generator::cast_to_float(bool top)
 {
-  int reg1 = reg_num_stack.top()-1;
-  if (top)
-    *procedure_code.top() << "\t*((double*)&Reg[" << reg_num_stack.top() << "]) = (double)Reg[" << reg_num_stack.top() << "];// Conversion\n";
-  else
-    *procedure_code.top() << "\t*((double*)&Reg[" << reg1 << "]) = (double)Reg[" << reg1 << "]);// Conversion\n";
+  if (expressions.size() < 2)
+    return;
+  Expression*& operand = expressions[expressions.size() - (top ? 1 : 2)];
+  Expression* e = new Expression(EXP_CAST, TYPE_FLOAT);
+  e->left = operand;
+  operand = e;
 }
 
 int Code_generator::if_false(std::string labelname)
 {
   int else_label = ++label_num;
-  *procedure_code.top() << "\tif (Reg[" << reg_num_stack.top() << "] == false) goto " << labelname << else_label << ";\n";
-  reg_num_stack.pop();
-  reg--;
+  Expression* e = optimize(pop());
+  branch(e, false, labelname + std::to_string(else_label));
+  delete e;
   return else_label;
 }
 
 int Code_generator::if_true(std::string labelname)
 {
   int else_label = ++label_num;
-  *procedure_code.top() << "\tif (Reg[" << reg_num_stack.top() << "] == true) goto " << labelname << else_label << ";\n";
-  reg_num_stack.pop();
-  reg--;
+  Expression* e = optimize(pop());
+  branch(e, true, labelname + std::to_string(else_label));
+  delete e;
   return else_label;
 }
 
+// Jump to target when the condition is when. The right side of & and | is only evaluated if the left doesn't
+// decide the branch, and neither is ever stored as a value.
+void Code_generator::branch(Expression* e, bool when, std::string target)
+{
+  if (e->type == TYPE_BOOL && e->kind == EXP_INVERT) {
+    branch(e->left, !when, target);
+    return;
+  }
+  if (e->type == TYPE_BOOL && e->kind == EXP_OPERATION && (e->op == "&" || e->op == "|")) {
+    if ((e->op == "|") == when) { // Either side alone takes the jump
+      branch(e->left, when, target);
+      branch(e->right, when, target);
+    }
+    else { // The left side alone can only rule it out
+      int skip = ++label_num;
+      branch(e->left, !when, "skip" + std::to_string(skip));
+      branch(e->right, when, target);
+      label("skip", skip);
+    }
+    return;
+  }
+  std::string condition = test(e);
+  *procedure_code.top() << "\tif (" << (when ? "(" : "!(") << condition << ")) goto " << target << ";\n";
+  jump(target);
+}
+
 void Code_generator::label(std::string labelname, int num)
 {
-  if (num == -1)
+  if (num == -1) { // A procedure, entered from anywhere
     *procedure_code.top() << labelname << ":\n";
-  else
-    *procedure_code.top() << labelname << num << ":\n";
+    forget();
+    reachable = true;
+    return;
+  }
+  *procedure_code.top() << labelname << num << ":\n";
+  
+  // Only jumped to from earlier code, what is known here is what every way in agrees on
+  std::map<std::string, std::vector<Value> >::iterator found = pending.find(labelname + std::to_string(num));
+  std::vector<Value> known;
+  if (found != pending.end())
+    known = found->second;
+  ranges.clear();
+  if (reachable && found != pending.end())
+    values = intersection(values, known);
+  else if (!reachable)
+    values = known;
+  if (found != pending.end())
+    pending.erase(found);
+  reachable = true;
 }
 
 void Code_generator::goto_(std::string labelname, int num)
 {
   if (num == -1)
     *procedure_code.top() << "\tgoto " << labelname << ";\n";
-  else
+  else {
     *procedure_code.top() << "\tgoto " << labelname << num << ";\n";
+    jump(labelname + std::to_string(num));
+  }
+  forget();
+  reachable = false;
+}
+
+void Code_generator::case_statement()
+{
+  Case c;
+  Expression* e = optimize(pop());
+  c.selector = value(e);
+  delete e;
+  c.dispatch = insertion_point();
+  c.end = ++label_num;
+  c.otherwise = "endcase" + std::to_string(c.end);
+  c.values = values;
+  cases.push(c);
+  forget();
+  reachable = false; // Only the arms follow the switch
+}
+
+void Code_generator::case_arm(std::vector<long long> &constants)
+{
+  Case& c = cases.top();
+  if (reachable) // The previous arm is done
+    goto_("endcase", c.end);
+  int arm = ++label_num;
+  c.arms += "\t";
+  for (unsigned int i = 0; i < constants.size(); i++)
+    c.arms += "case " + std::to_string(constants[i]) + ": ";
+  c.arms += "goto arm" + std::to_string(arm) + ";\n";
+  label("arm", arm);
+  values = c.values;
+}
+
+void Code_generator::case_default()
+{
+  Case& c = cases.top();
+  if (reachable)
+    goto_("endcase", c.end);
+  int arm = ++label_num;
+  c.otherwise = "arm" + std::to_string(arm);
+  label("arm", arm);
+  values = c.values;
+}
+
+void Code_generator::end_case()
+{
+  if (cases.empty())
+    return;
+  Case& c = cases.top();
+  
+  // Values without an arm skip the statement with what was known at the switch
+  if (c.otherwise == "endcase" + std::to_string(c.end)) {
+    std::vector<Value> known = values;
+    bool was_reachable = reachable;
+    values = c.values;
+    reachable = true;
+    jump(c.otherwise);
+    values = known;
+    reachable = was_reachable;
+  }
+  label("endcase", c.end);
+  
+  // gcc makes dense values one indexed jump through a table and sparse ones a binary search
+  insertions.top()[c.dispatch].code = "\tswitch (" + c.selector + ") {\n" + c.arms + "\tdefault: goto " + c.otherwise + ";\n\t}\n";
+  cases.pop();
 }
 
 void Code_generator::stack_alloc_param(Symbol* sym, bool in_param)
 {
-  if (in_param) {
-    sym->address = 2 + rel_fp_address; // Add size of frame pointer and return address to offset
-    rel_fp_address += sym->width;
+  if (sym->symbol_type.array()) { // Passed by reference in either direction
+    sym->reference = true;
+    sym->address = 16 + rel_fp_address;
+    rel_fp_address += 8;
+  }
+  else if (in_param) {
+    sym->address = 16 + rel_fp_address; // Add size of frame pointer and return address to offset
+    rel_fp_address += slot(sym->width);
   }
   else {
-    sym->address = 3 + rel_fp_address;
-    rel_fp_address += (sym->width + 1);
+    sym->address = 24 + rel_fp_address;
+    rel_fp_address += slot(sym->width) + 8;
+  }
+}
+
+void Code_generator::enter_frame()
+{
+  frames.push(Frame());
+  frames.top().size = 0;
+  frames.top().prologue = -1;
+}
+
+void Code_generator::frame_prologue()
+{
+  frames.top().prologue = insertion_point();
+}
+
+void Code_generator::exit_frame()
+{
+  // Every local and inlined frame is known now, SP moves once for all of them
+  Frame& frame = frames.top();
+  if (frame.size && frame.prologue >= 0)
+    insertions.top()[frame.prologue].code += "\tReg[SP] = Reg[FP] - " + std::to_string(frame.size) + ";\t\t// Allocate the frame\n";
+  frames.pop();
+}
+
+// A declared local shares bytes with the locals it is never live at the same time as
+void Code_generator::frame_alloc_local(Symbol* sym, int first, int last)
+{
+  Frame& frame = frames.top();
+  int size = frame_bytes(sym);
+  int low = 0;
+  bool moved = true;
+  while (moved) { // Lowest offset clear of every slot whose live range overlaps
+    moved = false;
+    for (unsigned int i = 0; i < frame.slots.size(); i++) {
+      Slot& other = frame.slots[i];
+      if (other.first <= last && first <= other.last && other.low < low + size && low < other.high) {
+        low = other.high;
+        moved = true;
+      }
+    }
   }
+  Slot slot_used = { low, low + size, first, last };
+  frame.slots.push_back(slot_used);
+  sym->address = low + size;
+  rel_fp_address = std::max(rel_fp_address, sym->address);
+  frame.size = std::max(frame.size, rel_fp_address);
 }
 
 void Code_generator::stack_alloc_local(Symbol* sym)
 {
-  *procedure_code.top() << "\tReg[SP] = Reg[SP] - " << sym->width << ";\t// Allocate space on stack for local variable\n";
-  rel_fp_address += sym->width;
+  rel_fp_address += frame_bytes(sym);
   sym->address = rel_fp_address;
+  frames.top().size = std::max(frames.top().size, rel_fp_address);
+  
+  // Declared by code inlined into a loop, so it is written on every pass
+  for (unsigned int i = 0; i < loops.size(); i++)
+    loops[i]->modified.insert(sym);
 }
 
 void Code_generator::alloc_static(Symbol* sym)
 {
-  sym->address = static_address;
-  static_address = static_address + sym->width;
+  int align = std::min(sym->symbol_type.size(), 8u);
+  sym->address = (static_address + align - 1) / align * align;
+  sym->module = module_name;
+  static_address = sym->address + sym->width;
 }
 
 void Code_generator::reset_fp_address()
@@ -293,28 +1159,135 @@ void Code_generator::reset_fp_address()
   rel_fp_address = 0;
 }
 
-void Code_generator::push_parameters(std::stack<Symbol*> &args, int num_out_params)
+int Code_generator::get_fp_address()
+{
+  return rel_fp_address;
+}
+
+void Code_generator::restore_fp_address(int address)
+{
+  rel_fp_address = address;
+}
+
+void Code_generator::free_stack(int address)
+{
+  rel_fp_address = address; // The space is part of the frame, the next inlined call reuses it
+  forget();
+}
+
+void Code_generator::argument(Symbol* param)
+{
+  // Each argument is evaluated into the next register, scalar out params also pass their address
+  // Arrays are only ever passed as their address. Once the argument registers run out, the rest are pushed
+  // on the stack in order, like spilled operands, and the registers above stay free for evaluating them
+  bool out_scalar = param->direction == DIRECTION_OUT && !param->symbol_type.array();
+  Expression* index;
+  Symbol* array = expressions.empty() ? NULL : element(expressions.back(), index);
+  Expression* e = optimize(pop());
+  bool push = stacked || reg + (out_scalar ? 2 : 1) > ARGUMENT_REGISTERS;
+  if (push && !stacked)
+    stacked_from = reg;
+  int r = evaluate(e);
+  if (out_scalar) { // An element is often passed right after it was compared
+    Expression current(EXP_LOAD, param->symbol_type.type());
+    current.sym = array;
+    current.left = e;
+    std::string text = current.sym ? recall(&current) : "";
+    if (text.empty())
+      text = memory("Reg[" + std::to_string(r) + "]", param);
+    *procedure_code.top() << "\t" << register_value(r+1, param->symbol_type.type()) << " = " << text << ";\t\t// Value of out argument\n";
+    if (current.sym)
+      remember(&current, r+1);
+    current.left = NULL;
+    reg++;
+  }
+  delete e;
+  
+  for (int i = r; push && i < reg; i++) {
+    *procedure_code.top() << "\tReg[SP] = Reg[SP] - 8;\n";
+    *procedure_code.top() << "\tMEM(long long, Reg[SP]) = Reg[" << i << "];\t\t// Pass argument on the stack, registers are full\n";
+    stacked++;
+  }
+  if (push)
+    reg = r;
+}
+
+// Argument register i of the call being made, a register or its place on the stack
+std::string Code_generator::argument_register(int i)
+{
+  if (!stacked || i < stacked_from)
+    return "Reg[" + std::to_string(i) + "]";
+  return "MEM(long long, Reg[" + std::to_string(stacked_from) + "] + " + std::to_string(8 * (stacked_from + stacked - 1 - i)) + ")";
+}
+
+std::string Code_generator::argument_value(int i, type_t type)
+{
+  if (!stacked || i < stacked_from)
+    return register_value(i, type);
+  if (type != TYPE_FLOAT)
+    return argument_register(i);
+  return "MEM(double, Reg[" + std::to_string(stacked_from) + "] + " + std::to_string(8 * (stacked_from + stacked - 1 - i)) + ")";
+}
+
+// Arguments on the stack are reached from where it ended after they were pushed, through the first free register
+void Code_generator::stacked_arguments()
+{
+  if (stacked)
+    *procedure_code.top() << "\tReg[" << stacked_from << "] = Reg[SP];\t\t// Arguments passed on the stack\n";
+}
+
+void Code_generator::release_argument(int i)
+{
+  if (!stacked || i < stacked_from)
+    reg--;
+}
+
+void Code_generator::free_stacked_arguments()
+{
+  if (stacked)
+    *procedure_code.top() << "\tReg[SP] = Reg[SP] + " << 8 * stacked << ";\t\t// Free arguments passed on the stack\n";
+  stacked = 0;
+}
+
+void Code_generator::push_parameters(std::stack<Symbol*> &args, int num_out_params, std::set<Symbol*> &copies)
 {
   Symbol *sym;
   int size = args.size();
   int i = size + num_out_params - 1;
+  
+  // Copies are made below the parameters, each with the address of its array above it for copying back
+  stacked_arguments();
+  std::stack<Symbol*> copy_args = args;
+  for (int r = i; !copy_args.empty(); copy_args.pop()) {
+    sym = copy_args.top();
+    if (copies.count(sym)) {
+      *procedure_code.top() << "\tReg[SP] = Reg[SP] - " << slot(sym->width) + 8 << ";\t\t// Copy array argument\n";
+      *procedure_code.top() << "\tmemcpy(&MEM(char, Reg[SP]), &MEM(char, " << argument_register(r) << "), " << sym->width << ");\n";
+      *procedure_code.top() << "\tMEM(long long, Reg[SP] + " << slot(sym->width) << ") = " << argument_register(r) << ";\n";
+      *procedure_code.top() << "\t" << argument_register(r) << " = Reg[SP];\n";
+    }
+    r -= (sym->direction == DIRECTION_OUT && !sym->symbol_type.array()) ? 2 : 1;
+  }
+  
   while (!args.empty()) { // Push args on to stack in reverse order
     sym = args.top();
     
-    *procedure_code.top() << "\tReg[SP] = Reg[SP] - " << sym->width << ";\t\t// Make space on stack for argument\n";
     if (sym->symbol_type.array()) {
-      *procedure_code.top() << "\tmemcpy(&MM[Reg[SP]], &MM[Reg[" << i << "]], 8*" << sym->width << ");\t\t// Copy array\n";
+      *procedure_code.top() << "\tReg[SP] = Reg[SP] - 8;\n";
+      *procedure_code.top() << "\tMEM(long long, Reg[SP]) = " << argument_register(i) << ";\t\t// Pass array by reference\n";
     }
-    else
-      *procedure_code.top() << "\tMM[Reg[SP]] = Reg[" << i << "];\t\t// Move argument to stack\n"; 
-    reg--;
+    else {
+      *procedure_code.top() << "\tReg[SP] = Reg[SP] - " << slot(sym->width) << ";\t\t// Make space on stack for argument\n";
+      *procedure_code.top() << "\t" << memory("Reg[SP]", sym) << " = " << argument_value(i, sym->symbol_type.type()) << ";\t\t// Move argument to stack\n"; 
+    }
+    release_argument(i);
     i--;
     
-    if (sym->direction == DIRECTION_OUT) {
-      *procedure_code.top() << "\tReg[SP] = Reg[SP] - 1;\t\t// Allocate space for out param address\n";
-      *procedure_code.top() << "\tMM[Reg[SP]] = Reg[" << i << "];\t\t// Push address for out parameter onto stack\n";
+    if (sym->direction == DIRECTION_OUT && !sym->symbol_type.array()) {
+      *procedure_code.top() << "\tReg[SP] = Reg[SP] - 8;\t\t// Allocate space for out param address\n";
+      *procedure_code.top() << "\tMEM(long long, Reg[SP]) = " << argument_register(i) << ";\t\t// Push address for out parameter onto stack\n";
+      release_argument(i);
       i--;
-      reg--;
     }
     
   args.pop();
@@ -323,188 +1296,712 @@ void Code_generator::push_parameters(std::stack<Symbol*> &args, int num_out_para
 
 void Code_generator::call_procedure(std::string name)
 {
-  *procedure_code.top() << "\tReg[SP] = Reg[SP] - 1;\t\t// Allocate space for return address\n";
+  *procedure_code.top() << "\tReg[SP] = Reg[SP] - 8;\t\t// Allocate space for return address\n";
   *procedure_code.top() << "\tReg[" << reg << "] = (long long)&&post" << name << ++label_num << ";\n";
-  *procedure_code.top() << "\tMM[Reg[SP]] = Reg[" << reg << "];\t\t// save return address\n";
-  *procedure_code.top() << "\tReg[SP] = Reg[SP] - 1;\t\t// Allocate space for FP\n";
-  *procedure_code.top() << "\tMM[Reg[SP]] = Reg[FP];\t\t// Save frame pointer\n";
+  *procedure_code.top() << "\tMEM(long long, Reg[SP]) = Reg[" << reg << "];\t\t// save return address\n";
+  *procedure_code.top() << "\tReg[SP] = Reg[SP] - 8;\t\t// Allocate space for FP\n";
+  *procedure_code.top() << "\tMEM(long long, Reg[SP]) = Reg[FP];\t\t// Save frame pointer\n";
   *procedure_code.top() << "\tReg[FP] = Reg[SP];\t\t// Move frame pointer to new position\n";
   *procedure_code.top() << "\tgoto " << name << ";\t\t// jump to procedure\n";
   *procedure_code.top() << "post" << name << label_num << ":\n";
 }
 
-void Code_generator::caller_return(Symbol* sym)
+void Code_generator::caller_return(Symbol* params, std::set<Symbol*> &copies)
 {
-  while (sym != NULL) {
-    if (sym->direction == DIRECTION_OUT) {
-
-      *procedure_code.top() << "\tReg[" << reg << "] = MM[Reg[SP]];\t\t// Get address of out param off stack\n";
-      *procedure_code.top() << "\tReg[SP] = Reg[SP] + 1;\n";
-        
-      if (sym->symbol_type.array())
-        *procedure_code.top() << "\tmemcpy(&MM[Reg[" << reg << "]], &MM[Reg[SP]], 8*" << sym->width << "); // Get out param off stack\n";
-      else {
-        if (sym->symbol_type.type() != TYPE_FLOAT)
-          *procedure_code.top() << "\tMM[Reg[" << reg << "]] = MM[Reg[SP]];\t\t// Get out param off stack\n";
-        else
-          *procedure_code.top() << "\t*((double*)&MM[Reg[" << reg << "]]) = *((double*)&MM[Reg[SP]]);\t// Get out param off stack\n";
+  // Copies lie above the parameters, so they are found from how much of both is left
+  int remaining = 0;
+  for (Symbol* sym = params; sym != NULL; sym = sym->next)
+    remaining += sym->symbol_type.array() ? 8 : slot(sym->width) + (sym->direction == DIRECTION_OUT ? 8 : 0);
+  int copied = 0;
+  
+  for (Symbol* sym = params; sym != NULL; sym = sym->next) {
+    if (sym->symbol_type.array()) {
+      if (copies.count(sym)) {
+        if (sym->direction == DIRECTION_OUT) {
+          *procedure_code.top() << "\tReg[" << reg << "] = MEM(long long, Reg[SP] + " << remaining + copied + slot(sym->width) << ");\n";
+          *procedure_code.top() << "\tmemcpy(&MEM(char, Reg[" << reg << "]), &MEM(char, Reg[SP] + " << remaining + copied << "), " << sym->width << ");\t\t// Copy array back\n";
+        }
+        copied += slot(sym->width) + 8;
       }
-        
-      *procedure_code.top() << "\tReg[SP] = Reg[SP] + " << sym->width << ";\t\t// Free output parameter\n";
+      *procedure_code.top() << "\tReg[SP] = Reg[SP] + 8;\t\t// Free array reference\n";
+      remaining -= 8;
+    }
+    else if (sym->direction == DIRECTION_OUT) {
+
+      *procedure_code.top() << "\tReg[" << reg << "] = MEM(long long, Reg[SP]);\t\t// Get address of out param off stack\n";
+      *procedure_code.top() << "\tReg[SP] = Reg[SP] + 8;\n";
+      *procedure_code.top() << "\t" << memory("Reg[" + std::to_string(reg) + "]", sym) << " = " << memory("Reg[SP]", sym) << ";\t\t// Get out param off stack\n";
+      *procedure_code.top() << "\tReg[SP] = Reg[SP] + " << slot(sym->width) << ";\t\t// Free output parameter\n";
+      remaining -= slot(sym->width) + 8;
     }
     else {
-      *procedure_code.top() << "\tReg[SP] = Reg[SP] + " << sym->width << ";\t\t// Free input parameter\n";
+      *procedure_code.top() << "\tReg[SP] = Reg[SP] + " << slot(sym->width) << ";\t\t// Free input parameter\n";
+      remaining -= slot(sym->width);
     }
-    sym = sym->next;
   }
+  if (copied)
+    *procedure_code.top() << "\tReg[SP] = Reg[SP] + " << copied << ";\t\t// Free array copies\n";
+  free_stacked_arguments();
+  forget();
 }
 
-void Code_generator::callee_return(bool runtime)
+void Code_generator::callee_return(Symbol* procedure)
 {
-  if (!runtime) {
-    *procedure_code.top() << "\tReg[SP] = Reg[FP];\t\t// Free local variables\n";
-    *procedure_code.top() << "\tReg[FP] = MM[Reg[FP]];\t\t// Restore Frame pointer\n";
-    *procedure_code.top() << "\tReg[SP] = Reg[SP] + 1;\t\t// Free space for FP\n";
-    *procedure_code.top() << "\tReg[0] = MM[Reg[SP]];\t\t// Pop return address off the stack\n";
-    *procedure_code.top() << "\tReg[SP] = Reg[SP] + 1;\t\t// Free return address space\n";
-    *procedure_code.top() << "\tgoto *(void*)Reg[0];\t\t// Return\n";
-  }
-  else {
-    output_file << "\tReg[SP] = Reg[FP];\t\t// Free local variables\n";
-    output_file << "\tReg[FP] = MM[Reg[FP]];\t\t// Restore Frame pointer\n";
-    output_file << "\tReg[SP] = Reg[SP] + 1;\t\t// Free space for FP\n";
-    output_file << "\tReg[0] = MM[Reg[SP]];\t\t// Pop return address off the stack\n";
-    output_file << "\tReg[SP] = Reg[SP] + 1;\t\t// Free return address space\n";
-    output_file << "\tgoto *(void*)Reg[0];\t\t// Return\n";
+  forget();
+  reachable = false;
+  if (procedure && procedure->leaf) {
+    *procedure_code.top() << "\tgoto *" << procedure->variable << ";\t\t// Return from leaf\n";
+    return;
   }
+  *procedure_code.top() << "\tReg[SP] = Reg[FP];\t\t// Free local variables\n";
+  *procedure_code.top() << "\tReg[FP] = MEM(long long, Reg[FP]);\t\t// Restore Frame pointer\n";
+  *procedure_code.top() << "\tReg[SP] = Reg[SP] + 8;\t\t// Free space for FP\n";
+  *procedure_code.top() << "\tReg[0] = MEM(long long, Reg[SP]);\t\t// Pop return address off the stack\n";
+  *procedure_code.top() << "\tReg[SP] = Reg[SP] + 8;\t\t// Free return address space\n";
+  *procedure_code.top() << "\tgoto *(void*)Reg[0];\t\t// Return\n";
 }
 
-void Code_generator::get_bool_value(bool b)
+// A leaf procedure is never active twice, so its return address, parameters and locals can be C variables of main
+void Code_generator::leaf_procedure(Symbol* procedure)
 {
-  reg_num_stack.push(reg++);
-  if (b)
-    *procedure_code.top() << "\tReg[" << reg_num_stack.top() << "] = true;\t\t// operand = true\n";
-  else
-    *procedure_code.top() << "\tReg[" << reg_num_stack.top() << "] = false;\t\t// operand = false\n";
+  procedure->leaf = true;
+  procedure->variable = "ret" + std::to_string(++temporary_num);
+  *output << "\tvoid* " << procedure->variable << ";\t\t// Return address of " << procedure->name << "\n";
 }
 
-void Code_generator::get_string_literal(Token* next_token)
+// A scalar whose address is never taken and that has one instance at a time, static so it starts at zero like memory
+void Code_generator::promote(Symbol* sym)
 {
-  reg_num_stack.push(reg++);
-  *procedure_code.top() << "\tstrcpy((char*)&MM[" << static_address << "], " << "\"" << next_token->string.c_str() << "\"" << ");\t\t// operand = string\n";
-  *procedure_code.top() << "\tReg[" << reg_num_stack.top() << "] = (long long)&MM[" << static_address << "];\n";
-  static_address = static_address + next_token->string.length()+1;
+  sym->variable = "v" + std::to_string(++temporary_num);
+  *output << "\tstatic " << c_type(sym->symbol_type.type(), sym->symbol_type.size()) << " " << sym->variable << ";\t\t// " << sym->name << "\n";
 }
 
-void Code_generator::get_constant(bool is_int, Token* next_token)
+void Code_generator::leaf_variable(Symbol* procedure, Symbol* sym)
 {
-  reg_num_stack.push(reg++);
-  if (is_int)
-    *procedure_code.top() << "\tReg[" << reg_num_stack.top() << "] = " << next_token->value.int_value << ";\t\t// operand = integer\n";
+  sym->variable = "lv" + std::to_string(++temporary_num);
+  if (sym->symbol_type.array()) { // Address of the caller's elements
+    sym->reference = true;
+    *output << "\tlong long " << sym->variable << ";\t\t// " << procedure->name << " " << sym->name << "\n";
+  }
   else
-    *procedure_code.top() << "\t*((double*)&Reg[" << reg_num_stack.top() << "]) = " << next_token->value.float_value << ";\t\t// operand = double\n";
+    *output << "\t" << c_type(sym->symbol_type.type(), sym->symbol_type.size()) << " " << sym->variable << ";\t\t// " << procedure->name << " " << sym->name << "\n";
+  if (sym->direction == DIRECTION_OUT && !sym->symbol_type.array()) // Where the caller stores the value after the call
+    *output << "\tlong long " << sym->variable << "_address;\n";
 }
 
-void Code_generator::get_value(bool is_int, Symbol* sym)
+void Code_generator::leaf_call(Symbol* procedure, std::stack<Symbol*> &args, int num_out_params, std::set<Symbol*> &copies)
 {
-  reg_num_stack.push(reg++);
-  if (is_int) {
-    if (sym->is_global)
-      *procedure_code.top() << "\tReg[" << reg_num_stack.top() << "] = MM[" << sym->address << "];\t\t// operand = static variable\n";
-    else if (sym->id_type == ID_VARIABLE)
-      *procedure_code.top() << "\tReg[" << reg_num_stack.top() << "] = MM[Reg[FP] - " << sym->address << "];\t\t// operand = local variable\n";
+  Symbol* sym;
+  int i = args.size() + num_out_params - 1;
+  
+  // Arguments go straight into the callee's variables, array copies are made on the stack
+  int copied = 0;
+  stacked_arguments();
+  while (!args.empty()) {
+    sym = args.top();
+    if (sym->symbol_type.array()) {
+      if (copies.count(sym)) {
+        *procedure_code.top() << "\tReg[SP] = Reg[SP] - " << slot(sym->width) + 8 << ";\t\t// Copy array argument\n";
+        *procedure_code.top() << "\tmemcpy(&MEM(char, Reg[SP]), &MEM(char, " << argument_register(i) << "), " << sym->width << ");\n";
+        *procedure_code.top() << "\tMEM(long long, Reg[SP] + " << slot(sym->width) << ") = " << argument_register(i) << ";\n";
+        *procedure_code.top() << "\t" << argument_register(i) << " = Reg[SP];\n";
+        copied += slot(sym->width) + 8;
+      }
+      *procedure_code.top() << "\t" << sym->variable << " = " << argument_register(i) << ";\t\t// Pass array by reference\n";
+    }
     else
-      *procedure_code.top() << "\tReg[" << reg_num_stack.top() << "] = MM[Reg[FP] + " << sym->address << "];\t\t// operand = parameter\n";
+      *procedure_code.top() << "\t" << sym->variable << " = " << argument_value(i, sym->symbol_type.type()) << ";\t\t// Pass argument\n";
+    release_argument(i);
+    i--;
+    
+    if (sym->direction == DIRECTION_OUT && !sym->symbol_type.array()) {
+      *procedure_code.top() << "\t" << sym->variable << "_address = " << argument_register(i) << ";\n";
+      release_argument(i);
+      i--;
+    }
+    args.pop();
   }
-  else {
-    if (sym->is_global)
-      *procedure_code.top() << "\t*((double*)&Reg[" << reg_num_stack.top() << "]) = *((double*)&MM[" << sym->address << "]);\t\t// operand = static variable\n";
-    else if (sym->id_type == ID_VARIABLE)
-      *procedure_code.top() << "\t*((double*)&Reg[" << reg_num_stack.top() << "]) = *((double*)&MM[Reg[FP] - " << sym->address << "]);\t\t// operand = local variable\n";
-    else
-      *procedure_code.top() << "\t*((double*)&Reg[" << reg_num_stack.top() << "]) = *((double*)&MM[Reg[FP] + " << sym->address << "]);\t\t// operand = parameter\n";
+  
+  *procedure_code.top() << "\t" << procedure->variable << " = &&post" << procedure->name << ++label_num << ";\n";
+  *procedure_code.top() << "\tgoto " << procedure->name << ";\t\t// jump to leaf procedure\n";
+  *procedure_code.top() << "post" << procedure->name << label_num << ":\n";
+  
+  // Out values are stored in parameter order, the first copy is the lowest on the stack
+  int offset = 0;
+  for (sym = procedure->params; sym != NULL; sym = sym->next) {
+    if (sym->symbol_type.array() && copies.count(sym)) {
+      if (sym->direction == DIRECTION_OUT) {
+        *procedure_code.top() << "\tReg[" << reg << "] = MEM(long long, Reg[SP] + " << offset + slot(sym->width) << ");\n";
+        *procedure_code.top() << "\tmemcpy(&MEM(char, Reg[" << reg << "]), &MEM(char, Reg[SP] + " << offset << "), " << sym->width << ");\t\t// Copy array back\n";
+      }
+      offset += slot(sym->width) + 8;
+    }
+    else if (sym->direction == DIRECTION_OUT && !sym->symbol_type.array())
+      *procedure_code.top() << "\t" << memory(sym->variable + "_address", sym) << " = " << sym->variable << ";\t\t// Store out argument\n";
   }
+  if (copied)
+    *procedure_code.top() << "\tReg[SP] = Reg[SP] + " << copied << ";\t\t// Free array copies\n";
+  free_stacked_arguments();
+  forget();
 }
 
-void Code_generator::get_indexed_value(bool is_int)
+void Code_generator::inline_parameters(std::vector<Symbol*> &slots)
 {
-    if (is_int)
-      *procedure_code.top() << "\tReg[" << reg_num_stack.top() << "] = MM[Reg[" << reg_num_stack.top() << "]];\t\t// Get array operand\n";
+  // Arguments are in registers in the same order as the slots. The slots are set on every pass of the loops
+  // the call is in, so nothing the inlined body reads from them is hoisted out of those loops
+  forget();
+  stacked_arguments();
+  for (unsigned int i = 0; i < slots.size(); i++) {
+    Symbol* sym = slots[i];
+    for (unsigned int j = 0; j < loops.size(); j++)
+      loops[j]->modified.insert(sym);
+    if (sym->reference)
+      *procedure_code.top() << "\tMEM(long long, " << location(sym) << ") = " << argument_register(i) << ";\t\t// Array is referenced by the inlined frame\n";
     else
-      *procedure_code.top() << "\t*((double*)&Reg[" << reg_num_stack.top() << "]) = *((double*)&MM[Reg[" << reg_num_stack.top() << "]]);\t\t// Get array operand\n";
+      *procedure_code.top() << "\t" << lvalue(sym) << " = " << argument_value(i, sym->symbol_type.type()) << ";\t\t// Move argument into inlined frame\n";
+    release_argument(i);
+  }
+  free_stacked_arguments();
 }
 
-void Code_generator::assignment(Symbol *left, bool is_int)
+void Code_generator::inline_return(Symbol* value, Symbol* address)
 {
-  if (is_int) {
-    if (left->is_global)
-      *procedure_code.top() << "\tMM[" << left->address << "] = Reg[" << reg_num_stack.top() << "];\t\t// assign static\n";
-    else if (left->id_type == ID_VARIABLE)
-      *procedure_code.top() << "\tMM[Reg[FP] - " << left->address << "] = Reg[" << reg_num_stack.top() << "];\t\t// assign local variable\n";
-    else
-      *procedure_code.top() << "\tMM[Reg[FP] + " << left->address << "] = Reg[" << reg_num_stack.top() << "];\t\t// assign parameter\n";
+  *procedure_code.top() << "\tReg[" << reg << "] = " << lvalue(address) << ";\t\t// Get address of out param\n";
+  *procedure_code.top() << "\t" << memory("Reg[" + std::to_string(reg) + "]", value) << " = " << lvalue(value) << ";\t\t// Copy out param\n";
+  forget();
+}
+
+
+int Code_generator::self_call(Symbol* procedure, std::stack<Symbol*> &args, int num_out_params, std::set<Symbol*> &in_place, std::set<Symbol*> &copies)
+{
+  Tail_call call;
+  call.insertion = insertion_point();
+  
+  int arg_reg = reg;
+  int arg_stacked = stacked;
+  std::stack<Symbol*> tail_args = args;
+  
+  procedure_code.push(new Code_buffer(context.lean));
+  push_parameters(args, num_out_params, copies);
+  call_procedure(procedure->name);
+  caller_return(procedure->params, copies);
+  insertions.top()[call.insertion].code = procedure_code.top()->str();
+  delete procedure_code.top();
+  procedure_code.pop();
+  
+  reg = arg_reg;
+  stacked = arg_stacked;
+  procedure_code.push(new Code_buffer(context.lean));
+  frame_reuse(procedure, tail_args, num_out_params, in_place);
+  stacked = 0;
+  call.jump_code = procedure_code.top()->str();
+  delete procedure_code.top();
+  procedure_code.pop();
+  
+  tail_calls.top().push_back(call);
+  forget();
+  return tail_calls.top().size() - 1;
+}
+
+void Code_generator::tail_position(int call)
+{
+  Tail_call& tail_call = tail_calls.top()[call];
+  insertions.top()[tail_call.insertion].code = tail_call.jump_code;
+}
+
+void Code_generator::frame_reuse(Symbol* procedure, std::stack<Symbol*> &args, int num_out_params, std::set<Symbol*> &in_place)
+{
+  Symbol *sym;
+  int i = args.size() + num_out_params - 1;
+  stacked_arguments();
+  while (!args.empty()) { // Every argument is already in a register or below the frame, so slots can be overwritten in any order
+    sym = args.top();
+    
+    if (sym->direction == DIRECTION_OUT && !sym->symbol_type.array()) { // Out param passed to itself, its value and address are already in place
+      release_argument(i--);
+      release_argument(i--);
+    }
+    else {
+      if (!in_place.count(sym)) {
+        if (sym->symbol_type.array())
+          *procedure_code.top() << "\tMEM(long long, " << location(sym) << ") = " << argument_register(i) << ";\t\t// Reference another array\n";
+        else
+          *procedure_code.top() << "\t" << lvalue(sym) << " = " << argument_value(i, sym->symbol_type.type()) << ";\t\t// Overwrite parameter in own frame\n";
+      }
+      release_argument(i);
+      i--;
+    }
+    
+    args.pop();
+  }
+  *procedure_code.top() << "\tReg[SP] = Reg[FP];\t\t// Free local variables\n";
+  *procedure_code.top() << "\tgoto " << procedure->name << ";\t\t// Tail call, reuse frame\n";
+}
+
+void Code_generator::enter_loop(std::set<Symbol*> &modified, bool calls, Symbol* induction, int step)
+{
+  Loop* loop = new Loop;
+  loop->modified = modified;
+  loop->calls = calls;
+  loop->induction = induction;
+  loop->step = step;
+  loop->preheader = insertion_point();
+  loop->condition = NULL;
+  loop->top = 0;
+  
+  // Values the loop can't change stay known in it and after it, a call may run this code again and set them
+  for (unsigned int i = 0; i < values.size() && !calls; i++) {
+    bool kept = true;
+    for (std::set<Symbol*>::iterator it = modified.begin(); it != modified.end() && kept; it++)
+      kept = !values[i].reads.count(*it) && !(values[i].load && (*it)->symbol_type.array());
+    if (kept)
+      loop->values.push_back(values[i]);
+  }
+  
+  // The induction variable lives in a C variable that gcc can see is only stepped by the loop
+  if (induction) {
+    loop->induction_name = "iv" + std::to_string(++temporary_num);
+    loop->temporaries["induction"] = loop->induction_name;
+    loop->declarations += "\tlong long " + loop->induction_name + ";\n";
+    loop->code += "\t" + loop->induction_name + " = " + lvalue(induction) + ";\t\t// Induction variable\n";
+  }
+  loops.push_back(loop);
+  
+  loop->capturing = true;
+  procedure_code.push(new Code_buffer(context.lean));
+}
+
+void Code_generator::loop_condition()
+{
+  Loop* loop = loops.back();
+  loop->assignment_code = procedure_code.top()->str();
+  delete procedure_code.top();
+  procedure_code.pop();
+  loop->capturing = false;
+  
+  // Rotated so the condition is tested at the bottom, the guard skips a loop that never runs
+  values = loop->values;
+  ranges.clear();
+  loop->condition = optimize(pop());
+  Expression* e = loop->condition;
+  if (e->type == TYPE_BOOL && (e->kind == EXP_INVERT || (e->kind == EXP_OPERATION && (e->op == "&" || e->op == "|")))) {
+    loop->top = ++label_num;
+    branch(e, false, "endloop" + std::to_string(loop->top));
+    *procedure_code.top() << "loop" << loop->top << ":\n";
   }
   else {
-    if (left->is_global)
-      *procedure_code.top() << "\tmemcpy(&MM[" << left->address << "], &Reg[" << reg_num_stack.top() << "], sizeof(double));\t\t// assign static\n";
-    else if (left->id_type == ID_VARIABLE)
-      *procedure_code.top() << "\tmemcpy(&MM[Reg[FP] - " << left->address << "], &Reg[" << reg_num_stack.top() << "], sizeof(double));\t\t// assign local variable\n";
-    else
-      *procedure_code.top() << "\tmemcpy(&MM[Reg[FP] + " << left->address << "], &Reg[" << reg_num_stack.top() << "], sizeof(double));\t\t// assign parameter\n";
+    std::string condition = test(e);
+    *procedure_code.top() << "\tif (" << condition << ") {\n";
+    *procedure_code.top() << "\tdo {\n";
+  }
+  values = loop->values;
+  ranges.clear();
+}
+
+void Code_generator::spill_inductions()
+{
+  // Memory must be current before anything that reads the variable there or runs the loop again
+  for (unsigned int i = 0; i < loops.size(); i++) {
+    if (loops[i]->induction)
+      *procedure_code.top() << "\t" << lvalue(loops[i]->induction) << " = " << loops[i]->induction_name << ";\n";
   }
-  reg_num_stack.pop();
-  reg--;
 }
 
-void Code_generator::assign_indexed(Symbol *left, bool is_int)
+void Code_generator::reload_invariants()
 {
-  int reg1 = reg_num_stack.top()-1;
+  // The callee may run the same loops recursively and overwrite their C variables, outer loops reload first
+  for (unsigned int i = 0; i < loops.size(); i++)
+    loops[i]->reloads.push_back(insertion_point());
+}
+
+void Code_generator::exit_loop()
+{
+  if (loops.empty())
+    return;
+  Loop* loop = loops.back();
+  if (loop->capturing) { // Only after a syntax error
+    delete procedure_code.top();
+    procedure_code.pop();
+  }
+  
+  if (loop->condition) {
+    forget(); // The assignment changes what the condition reads
+    *procedure_code.top() << loop->assignment_code << loop->advance_code;
+    if (loop->assignment_code.empty() && loop->advance_code.empty())
+      *procedure_code.top() << "\t;\n"; // The body may end with a label
+    if (loop->top) {
+      branch(loop->condition, true, "loop" + std::to_string(loop->top));
+      pending.erase("loop" + std::to_string(loop->top)); // Already placed, the loop's own values are gone there
+      label("endloop", loop->top);
+      *procedure_code.top() << "\t;\n";
+    }
+    else {
+      std::string condition = test(loop->condition);
+      *procedure_code.top() << "\t} while (" << condition << ");\n";
+      *procedure_code.top() << "\t}\n";
+    }
+  }
+  if (loop->induction)
+    *procedure_code.top() << "\t" << lvalue(loop->induction) << " = " << loop->induction_name << ";\n";
+  loops.pop_back();
+  values = loop->values;
+  ranges.clear();
+  reachable = true;
+  
+  if (!loop->temporaries.empty()) { // The loop becomes a C block scoping its variables
+    insertions.top()[loop->preheader].code += "\t{\t\t// Loop invariants\n" + loop->declarations + loop->code;
+    for (unsigned int i = 0; i < loop->reloads.size(); i++)
+      insertions.top()[loop->reloads[i]].code += loop->code;
+    *procedure_code.top() << "\t}\n";
+  }
+  delete loop->condition;
+  delete loop;
+}
+
+// Replace the largest parts of e that don't change in the innermost depth loops with C variables set before them
+Expression* Code_generator::hoist(Expression* e, unsigned int depth)
+{
+  if (e == NULL || depth == 0)
+    return e;
+  
+  // Address of an element indexed by an induction variable steps along with it
+  Expression* index;
+  if (element(e, index) && index->kind == EXP_VALUE) {
+    for (unsigned int i = 0; i < depth; i++) {
+      if (loops[i]->induction == index->sym)
+        return temporary(e, i, true);
+    }
+  }
+  
+  // Invariant in a loop means invariant in every loop inside it, so look for the outermost
+  unsigned int level = 0;
+  while (level < depth && !invariant(e, loops[level]))
+    level++;
+  bool trivial = e->kind == EXP_CONSTANT || e->kind == EXP_TEMPORARY || (e->kind == EXP_ADDRESS && e->sym->is_global)
+    || (e->kind == EXP_VALUE && (!induction_variable(e->sym).empty() || !e->sym->variable.empty()));
+  if (level < depth && !trivial)
+    return temporary(e, level, false);
+  
+  e->left = hoist(e->left, depth);
+  e->right = hoist(e->right, depth);
+  return e;
+}
+
+// Hoisted code runs even when the loop body doesn't, so nothing that can fault is invariant
+bool Code_generator::invariant(Expression* e, Loop* loop)
+{
+  Expression* index;
+  Symbol* array;
+  switch (e->kind) {
+    case EXP_CONSTANT:
+      return true;
+    case EXP_ADDRESS: // An array parameter's address is read from its slot
+      return !e->sym->reference || unchanged(e->sym, loop);
+    case EXP_VALUE:
+      return unchanged(e->sym, loop);
+    case EXP_LOAD:
+      array = element(e->left, index);
+      return array && unchanged(array, loop) && index->kind == EXP_CONSTANT
+        && index->int_value >= 0 && index->int_value < array->symbol_type.arraysize();
+    case EXP_OPERATION:
+      if (e->op == "/" && !(e->right->kind == EXP_CONSTANT && e->right->int_value != 0))
+        return false;
+      return invariant(e->left, loop) && invariant(e->right, loop);
+    case EXP_RELATION:
+      return invariant(e->left, loop) && invariant(e->right, loop);
+    case EXP_INVERT:
+    case EXP_NEGATE:
+    case EXP_CAST:
+      return invariant(e->left, loop);
+    default:
+      return false;
+  }
+}
+
+bool Code_generator::unchanged(Symbol* sym, Loop* loop)
+{
+  return !loop->modified.count(sym) && !(sym->is_global && loop->calls);
+}
+
+// The array whose element e addresses, with the index, or NULL if e is not an element address
+Symbol* Code_generator::element(Expression* e, Expression*& index)
+{
+  if (e->kind != EXP_OPERATION || e->op != "+" || e->left->kind != EXP_ADDRESS || !e->left->sym->symbol_type.array())
+    return NULL;
+  index = e->right;
+  if (e->left->sym->symbol_type.size() > 1) { // Scaled by element_of
+    if (index->kind != EXP_OPERATION || index->op != "*" || index->right->kind != EXP_CONSTANT)
+      return NULL;
+    index = index->left;
+  }
+  return e->left->sym;
+}
+
+Expression* Code_generator::temporary(Expression* e, unsigned int level, bool pointer)
+{
+  Loop* loop = loops[level];
+  std::string k = (pointer ? "pointer " : "") + key(e);
+  type_t type = e->type;
+  std::string name;
+  
+  std::map<std::string, std::string>::iterator found = loop->temporaries.find(k);
+  if (found != loop->temporaries.end())
+    name = found->second;
+  else {
+    Expression* index;
+    unsigned int stride = pointer ? element(e, index)->symbol_type.size() : 0;
+    name = (pointer ? "ptr" : "inv") + std::to_string(++temporary_num);
+    loop->temporaries[k] = name;
+    loop->declarations += "\t" + std::string(type == TYPE_FLOAT ? "double " : "long long ") + name + ";\n";
+    
+    // Computed where only the loops outside this one are running, no registers are live there
+    e = hoist(e, level);
+    int saved_reg = reg;
+    reg = 0;
+    procedure_code.push(new Code_buffer(context.lean));
+    std::string source = value(e);
+    *procedure_code.top() << "\t" << name << " = " << source << ";\t\t// " << (pointer ? "Address stepped by the loop" : "Loop invariant") << "\n";
+    loop->code += procedure_code.top()->str();
+    delete procedure_code.top();
+    procedure_code.pop();
+    reg = saved_reg;
+    
+    if (pointer) {
+      std::stringstream step;
+      step << "\t" << name << " = " << name << (loop->step < 0 ? " - " : " + ") << abs(loop->step) * stride << ";\n";
+      loop->advance_code += step.str();
+    }
+  }
+  delete e;
+  
+  Expression* t = new Expression(EXP_TEMPORARY, pointer ? TYPE_INT : type);
+  t->name = name;
+  return t;
+}
+
+std::string Code_generator::induction_variable(Symbol* sym)
+{
+  for (unsigned int i = 0; i < loops.size(); i++) {
+    if (loops[i]->induction == sym)
+      return loops[i]->induction_name;
+  }
+  return "";
+}
+
+std::string Code_generator::key(Expression* e)
+{
+  std::stringstream k;
+  k << e->kind << " " << e->type << " " << e->sym << " " << e->op << " " << e->relop << " " << e->int_value << " " << e->float_value << " " << e->name;
+  k << " (" << (e->left ? key(e->left) : "") << ", " << (e->right ? key(e->right) : "") << ")";
+  return k.str();
+}
+
+// Values are only numbered in a procedure's own code, not in code moved before a loop or held for later
+bool Code_generator::numbering()
+{
+  return !bodies.empty() && procedure_code.top() == bodies.top() && reachable;
+}
+
+void Code_generator::remember(Expression* e, int r)
+{
+  if (!numbering())
+    return;
+  Value v;
+  v.key = key(e);
+  v.name = "cse" + std::to_string(++temporary_num);
+  v.type = e->type;
+  v.insertion = insertion_point();
+  v.reg = r;
+  v.load = false;
+  
+  std::vector<Expression*> parts(1, e);
+  while (!parts.empty()) {
+    Expression* part = parts.back();
+    parts.pop_back();
+    if (part->kind == EXP_LOAD)
+      v.load = true;
+    if (part->kind == EXP_VALUE)
+      v.reads.insert(part->sym);
+    if (part->left)
+      parts.push_back(part->left);
+    if (part->right)
+      parts.push_back(part->right);
+  }
+  values.push_back(v);
+}
+
+// C variable already holding the value of e, empty if there is none
+std::string Code_generator::recall(Expression* e)
+{
+  if (values.empty() || !numbering())
+    return "";
+  std::string k = key(e);
+  for (unsigned int i = 0; i < values.size(); i++) {
+    Value& v = values[i];
+    if (v.key != k)
+      continue;
+    std::string& code = insertions.top()[v.insertion].code;
+    if (code.empty()) { // First reuse, the register is copied where the value was computed
+      *output << "\t" << (v.type == TYPE_FLOAT ? "double " : "long long ") << v.name << ";\n";
+      code = "\t" + v.name + " = " + register_value(v.reg, v.type) + ";\t\t// Value used again\n";
+    }
+    return v.name;
+  }
+  return "";
+}
+
+void Code_generator::forget()
+{
+  values.clear();
+  ranges.clear();
+}
+
+void Code_generator::forget(Symbol* sym)
+{
+  for (unsigned int i = 0; i < values.size(); i++) {
+    if (values[i].reads.count(sym))
+      values.erase(values.begin() + i--);
+  }
+  ranges.erase(sym);
+}
+
+void Code_generator::forget_loads()
+{
+  for (unsigned int i = 0; i < values.size(); i++) {
+    if (values[i].load)
+      values.erase(values.begin() + i--);
+  }
+}
+
+// Values known where the code jumps forward to a label
+void Code_generator::jump(std::string target)
+{
+  if (!reachable)
+    return;
+  std::map<std::string, std::vector<Value> >::iterator found = pending.find(target);
+  if (found == pending.end())
+    pending[target] = values;
+  else
+    found->second = intersection(found->second, values);
+}
+
+void Code_generator::get_bool_value(bool b)
+{
+  Expression* e = new Expression(EXP_CONSTANT, TYPE_BOOL);
+  e->int_value = b;
+  expressions.push_back(e);
+}
+
+void Code_generator::get_string_literal(Token* next_token)
+{
+  // Every use of the same literal shares one copy in static memory
+  std::map<std::string, int>::iterator found = strings.find(next_token->string);
+  if (found == strings.end()) {
+    found = strings.insert(std::make_pair(next_token->string, static_address)).first;
+    static_address = static_address + next_token->string.length() + 1;
+  }
+  
+  Expression* e = new Expression(EXP_STRING, TYPE_STRING);
+  e->int_value = found->second;
+  e->name = next_token->string;
+  expressions.push_back(e);
+}
+
+void Code_generator::get_constant(bool is_int, Token* next_token)
+{
+  Expression* e = new Expression(EXP_CONSTANT, is_int ? TYPE_INT : TYPE_FLOAT);
   if (is_int)
-    *procedure_code.top() << "\tMM[Reg[" << reg1 << "]] = Reg[" << reg_num_stack.top() << "];\t\t// " << " + offset = expression\n";
+    e->int_value = next_token->value.int_value;
+  else
+    e->float_value = next_token->value.float_value;
+  expressions.push_back(e);
+}
+
+void Code_generator::get_value(Symbol* sym)
+{
+  Expression* e = new Expression(EXP_VALUE, sym->symbol_type.type());
+  e->sym = sym;
+  expressions.push_back(e);
+}
+
+void Code_generator::get_indexed_value(Symbol* sym)
+{
+  Expression* e = new Expression(EXP_LOAD, sym->symbol_type.type());
+  e->sym = sym; // Array, for the size of its elements
+  e->left = pop();
+  expressions.push_back(e);
+}
+
+void Code_generator::assignment(Symbol *left)
+{
+  Expression* e = optimize(pop());
+  std::string target = lvalue(left);
+  if (!induction_variable(left).empty())
+    target = induction_variable(left);
+  std::string source = value(e);
+  
+  if (left->is_global)
+    *procedure_code.top() << "\t" << target << " = " << source << ";\t\t// assign static\n";
+  else if (left->id_type == ID_VARIABLE)
+    *procedure_code.top() << "\t" << target << " = " << source << ";\t\t// assign local variable\n";
   else
-    *procedure_code.top() << "\tmemcpy(&MM[Reg[" << reg1 << "]], &Reg[" << reg_num_stack.top() << "], sizeof(double));\t\t// " << " + offset = expression\n";
+    *procedure_code.top() << "\t" << target << " = " << source << ";\t\t// assign parameter\n";
+  forget(left);
   
-  reg_num_stack.pop();
-  reg--;
-  reg--;
+  // Bounds that fit the variable's width hold until it is written again
+  long long low, high;
+  long long limit = 1LL << std::min(8 * left->symbol_type.size() - 1, 62u);
+  if (left->symbol_type.type() == TYPE_INT && bounds(e, low, high) && low >= -limit && high < limit)
+    ranges[left] = std::make_pair(low, high);
+  delete e;
 }
 
-void Code_generator::spill_register()
+void Code_generator::assign_indexed(Symbol *left)
 {
-  reg_num_stack.pop();
+  Expression* e = optimize(pop());
+  Expression* element = optimize(element_of(left, pop()));
+  
+  // Address and value are evaluated in the order that keeps the fewest registers live
+  int saved_reg = reg;
+  std::string target, source;
+  bool spilled = operands(element, e, target, source);
+  target = memory(target, left);
+  
+  *procedure_code.top() << "\t" << target << " = " << source << ";\t\t// " << left->name << " + offset = expression\n";
+  if (spilled)
+    *procedure_code.top() << "\tReg[SP] = Reg[SP] + 8;\t\t// Free spilled operand\n";
+  reg = saved_reg;
+  forget_loads(); // Arrays passed by reference may share elements with any other array
+  delete e;
+  delete element;
 }
 
 void Code_generator::valid_data_check(bool top)
 {
-  int reg1 = reg_num_stack.top()-1;
-  if (top)
-    *procedure_code.top() << "\tdataConversionCheck(Reg[" << reg_num_stack.top() << "]);\n";
-  else
-    *procedure_code.top() << "\tdataConversionCheck(Reg[" << reg1 << "]);\n";
+  if (expressions.size() < 2)
+    return;
+  Expression*& operand = expressions[expressions.size() - (top ? 1 : 2)];
+  Expression* e = new Expression(EXP_CHECK, operand->type);
+  e->left = operand;
+  operand = e;
 }
 
-void Code_generator::output_relop(relative_op_t relop) 
+std::string Code_generator::relop_string(relative_op_t relop) 
 {
     switch (relop) {
         case IS_EQUAL:
-            *procedure_code.top() << "==";
-            break;
+            return "==";
         case NOT_EQUAL:
-            *procedure_code.top() << "!=";
-            break;
+            return "!=";
         case GREATER_THAN:
-            *procedure_code.top() << ">";
-            break;
+            return ">";
         case LESS_THAN:
-            *procedure_code.top() << "<";
-            break;
+            return "<";
         case GREATER_OR_EQUAL:
-            *procedure_code.top() << ">=";
-            break;
+            return ">=";
         case LESS_OR_EQUAL:
-            *procedure_code.top() << "<=";
-            break;
+            return "<=";
         default:
-            break;
+            return "";
     }
-}
\ No newline at end of file
+}
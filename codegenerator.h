@@ -2,18 +2,138 @@
 #define CODEGENERATOR_H
 
 #include <stack>
+#include <set>
+#include <map>
+#include <vector>
 #include <sstream>
 #include "symbol.h"
 #include "scanner.h"
+#include "code_buffer.h"
+
+#define NUM_REGISTERS 30 // Registers free for expressions, runtime.c keeps FP and SP above them
+#define ARGUMENT_REGISTERS 24 // Registers arguments are passed in, later ones go on the stack so the rest can be evaluated
+#define CACHE_LINE 64
+
+#ifndef RUNTIME_DIR
+#define RUNTIME_DIR "." // Holds runtime.h and the runtime libraries, the Makefile sets it to where they are built
+#endif
+
+enum expression_t {
+  EXP_CONSTANT,   // Integer, float or bool constant
+  EXP_STRING,     // Address of a string constant in static memory
+  EXP_VALUE,      // Value of a scalar variable
+  EXP_ADDRESS,    // Address of a variable or array
+  EXP_LOAD,       // Value at the address computed by left
+  EXP_OPERATION,  // left op right
+  EXP_RELATION,   // left relop right
+  EXP_INVERT,
+  EXP_NEGATE,
+  EXP_CAST,       // Integer left converted to float
+  EXP_CHECK,      // left must be a valid bool at runtime
+  EXP_TEMPORARY,  // Value computed before the loop into a C variable
+};
+
+// Expressions are built as the parser reduces them and emitted once a statement uses the value
+struct Expression {
+  Expression(expression_t k, type_t t);
+  ~Expression();
+
+  expression_t kind;
+  type_t type;
+  Symbol* sym;
+  std::string op;
+  relative_op_t relop;
+  long long int_value;
+  double float_value;
+  std::string name;   // Temporary variable
+  Expression* left;
+  Expression* right;
+};
+
+// Code spliced into a procedure at a position recorded before the code was known
+struct Insertion {
+  size_t position;
+  std::string code;
+};
+
+// A self-recursive call, held in both forms until the parser knows whether it is in tail position
+struct Tail_call {
+  int insertion;
+  std::string jump_code;
+};
+
+// A value an expression left in a register, reused from a C variable until something it reads is written
+struct Value {
+  std::string key;
+  std::string name;
+  type_t type;
+  int insertion;              // Sets the variable, only once the value is used again
+  int reg;
+  bool load;                  // Reads an array element
+  std::set<Symbol*> reads;
+};
+
+// A for loop being generated, its invariant values are computed once before it
+struct Loop {
+  std::set<Symbol*> modified;
+  bool calls;                 // Any called procedure may change a global
+  Symbol* induction;          // Stepped only by the loop assignment, or NULL
+  std::string induction_name; // C variable holding the induction variable while the loop runs
+  int step;
+  int preheader;              // Insertion points
+  std::vector<int> reloads;
+  bool capturing;             // The assignment is parsed first but runs after the body
+  std::string assignment_code;
+  Expression* condition;
+  int top;                    // Label jumped back to when the condition is lowered to branches, otherwise 0
+  std::map<std::string, std::string> temporaries;
+  std::string declarations;
+  std::string code;           // Computes the temporaries, before the loop and again after each call
+  std::string advance_code;   // Steps the strength reduced addresses with the induction variable
+  std::vector<Value> values;  // Known before the loop and not changed by it
+};
+
+// A case statement being generated, its switch is placed before the arms once they are all known
+struct Case {
+  std::string selector;       // Value switched on, computed just before the switch
+  int dispatch;               // Insertion point
+  int end;                    // Label after the statement
+  std::string arms;           // Case labels of the switch
+  std::string otherwise;      // Where values without an arm go
+  std::vector<Value> values;  // Known when the switch jumps to an arm
+};
+
+// Bytes of a frame a local uses while it is live
+struct Slot {
+  int low;    // Offsets below FP
+  int high;
+  int first;  // Token positions the local is live between
+  int last;
+};
+
+// A procedure's frame, allocated by a single adjustment of SP when the procedure is entered
+struct Frame {
+  std::vector<Slot> slots;
+  int size;
+  int prologue; // Insertion point
+};
 
 class Code_generator {
   public:
-    Code_generator(std::string filename);
+    Code_generator(Compilation& compilation);
     ~Code_generator();
     int next_label();
-    void main_runtime();
+    void main_runtime(std::vector<Symbol*> &runtime); // Declares the runtime procedures, returned for the symbol table
     void start();
     void exit();
+    void module(std::string name);
+    void import(std::string name, std::string object);
+    void export_procedure(Symbol* procedure);
+    void module_call(Symbol* procedure);
+    bool shard_procedure(Symbol* procedure);
+    void leave_shard();
+    bool sharded();
+    bool external(Symbol* procedure);
     void enter_procedure();
     void emit_procedure();
     void arithmetic_operation(type_t type, const char*);
@@ -21,46 +141,141 @@ class Code_generator {
     void invert();
     void change_sign(type_t type);
     void calculate_address(Symbol* sym);
-    void calculate_array_element_address(Symbol* sym, bool top, bool addr_already, bool copy_index);
+    void element_address(Symbol* sym);
     void cast_to_float(bool top);
     int if_false(std::string labelname);
     int if_true(std::string labelname);
     void label(std::string labelname, int num);
     void goto_(std::string labelname, int num);
+    void case_statement();
+    void case_arm(std::vector<long long> &constants);
+    void case_default();
+    void end_case();
     void stack_alloc_param(Symbol* sym, bool in_param);
+    void enter_frame();
+    void frame_prologue();
+    void exit_frame();
+    void frame_alloc_local(Symbol* sym, int first, int last);
     void stack_alloc_local(Symbol* sym);
     void alloc_static(Symbol* sym);
     void reset_fp_address();
-    void push_parameters(std::stack<Symbol*> &args, int num_out_params);
+    int get_fp_address();
+    void restore_fp_address(int address);
+    void free_stack(int address);
+    void argument(Symbol* param);
+    void push_parameters(std::stack<Symbol*> &args, int num_out_params, std::set<Symbol*> &copies);
     void call_procedure(std::string name);
-    void caller_return(Symbol* sym);
-    void callee_return(bool runtime);
-    void assignment(Symbol *left, bool is_int);
-    void assign_indexed(Symbol* left, bool is_int);
+    void caller_return(Symbol* params, std::set<Symbol*> &copies);
+    void callee_return(Symbol* procedure);
+    void leaf_procedure(Symbol* procedure);
+    void promote(Symbol* sym);
+    void leaf_variable(Symbol* procedure, Symbol* sym);
+    void leaf_call(Symbol* procedure, std::stack<Symbol*> &args, int num_out_params, std::set<Symbol*> &copies);
+    void inline_parameters(std::vector<Symbol*> &slots);
+    void inline_return(Symbol* value, Symbol* address);
+    int self_call(Symbol* procedure, std::stack<Symbol*> &args, int num_out_params, std::set<Symbol*> &in_place, std::set<Symbol*> &copies);
+    void tail_position(int call);
+    void enter_loop(std::set<Symbol*> &modified, bool calls, Symbol* induction, int step);
+    void loop_condition();
+    void spill_inductions();
+    void reload_invariants();
+    void exit_loop();
+    void assignment(Symbol *left);
+    void assign_indexed(Symbol* left);
     void get_bool_value(bool b);
     void get_string_literal(Token* next_token);
     void get_constant(bool is_int, Token* next_token);
-    void get_indexed_value(bool is_int);
-    void get_value(bool is_int, Symbol* sym);
-    void spill_register();
+    void get_indexed_value(Symbol* sym);
+    void get_value(Symbol* sym);
     void valid_data_check(bool top);
-    
+
   protected:
-    void output_relop(relative_op_t relop);
+    std::string relop_string(relative_op_t relop);
+    void frame_reuse(Symbol* procedure, std::stack<Symbol*> &args, int num_out_params, std::set<Symbol*> &in_place);
+    int insertion_point();
+    void splice(Code_buffer& out, Code_buffer* code, std::vector<Insertion> &positions);
+    void exit_module();
+    void entry_points(Code_buffer& out, std::vector<Symbol*> &procedures);
+    bool build(std::string command, std::string target, std::vector<std::string> &inputs);
+
+    Expression* pop();
+    Expression* optimize(Expression* e);
+    Expression* checked(Expression* e);
+    bool bounds(Expression* e, long long& low, long long& high);
+    int evaluate(Expression* e);
+    int need(Expression* e);
+    bool operands(Expression* a, Expression* b, std::string& a_text, std::string& b_text);
+    std::string operand(Expression* e);
+    std::string value(Expression* e);
+    std::string test(Expression* e);
+    void branch(Expression* e, bool when, std::string target);
+    std::string register_value(int r, type_t type);
+    std::string address(Symbol* sym);
+    std::string location(Symbol* sym);
+    std::string lvalue(Symbol* sym);
+    std::string memory(std::string address, Symbol* sym);
+    std::string argument_register(int i);
+    std::string argument_value(int i, type_t type);
+    void stacked_arguments();
+    void release_argument(int i);
+    void free_stacked_arguments();
+
+    Expression* hoist(Expression* e, unsigned int depth);
+    bool invariant(Expression* e, Loop* loop);
+    bool unchanged(Symbol* sym, Loop* loop);
+    Symbol* element(Expression* e, Expression*& index);
+    Expression* temporary(Expression* e, unsigned int level, bool pointer);
+    std::string key(Expression* e);
     
+    bool numbering();
+    void remember(Expression* e, int r);
+    std::string recall(Expression* e);
+    void forget();
+    void forget(Symbol* sym);
+    void forget_loads();
+    void jump(std::string target);
+    std::string induction_variable(Symbol* sym);
+
   private:
-   std::ofstream output_file;
+   Compilation& context;
+   Code_buffer file_code;      // Of the .c file, written at the end or copied to the compilation's code stream
+   Code_buffer* output;        // Where code outside procedures goes, the file or a shard
    std::string rawname;
+
+    std::stack <Code_buffer*> procedure_code;
+    std::stack <std::vector<Insertion> > insertions;
+    std::stack <std::vector<Tail_call> > tail_calls;
+    std::vector <Expression*> expressions;
+    std::vector <Loop*> loops;
+    std::stack <Frame> frames;
+    std::stack <Case> cases;
+    std::map <std::string, int> strings; // String constants and their static addresses
+    std::stack <Code_buffer*> bodies;
+    std::vector <Value> values;          // Available on every path to the code being generated
+    std::map <std::string, std::vector<Value> > pending; // Available at each forward jump to a label
+    bool reachable;
+    std::map <Symbol*, std::pair<long long, long long> > ranges; // Integer variables assigned a value within known bounds
     
-    std::stack <std::stringstream*> procedure_code;
-    std::stack <int> reg_num_stack;
+    std::string module_name;        // C name of the module being compiled, empty for a program
+    std::vector <std::string> imports; // C names of the modules used, each sets up its static memory at start
+    std::vector <std::string> objects; // Their object files, linked with the program
+    std::vector <Symbol*> exports;  // Procedures other modules enter, by number
     
+    int shards;                     // C files the procedures of a program are split across, 0 for one file
+    int shard;                      // Whose function code is being written to, -1 for main
+    Code_buffer* shard_code;        // Code of each shard's function, written to its file at the end
+    std::vector <std::vector<Symbol*> > shard_entries; // Procedures each shard is entered at, by number
+    Code_buffer runtime_code;       // Labels of the runtime procedures, repeated in every function
+
     int reg;
-    
+    int stacked;                    // Argument registers of the call being made that were pushed on the stack
+    int stacked_from;               // The first of them
+
     int static_address;
     int label_num;
     int rel_fp_address;
-  
+    int temporary_num;
+
 };
 
-#endif
\ No newline at end of file
+#endif
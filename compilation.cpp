@@ -0,0 +1,23 @@
+#include "compilation.h"
+
+// Counts and records an error or warning and prints it, numbered ones are prefixed with their line
+void Compilation::diagnose(diagnostic_t kind, int line, std::string message, bool numbered)
+{
+  errors << (kind == DIAGNOSTIC_ERROR ? "ERROR: " : "WARNING: ");
+  if (numbered)
+    errors << "Line " << line << ": ";
+  errors << message;
+
+  if (kind == DIAGNOSTIC_ERROR)
+    num_errors++;
+  else
+    num_warnings++;
+
+  Diagnostic diagnostic;
+  diagnostic.kind = kind;
+  diagnostic.line = line;
+  diagnostic.message = message;
+  if (!diagnostic.message.empty() && diagnostic.message[diagnostic.message.size()-1] == '\n')
+    diagnostic.message.erase(diagnostic.message.size()-1);
+  diagnostics.push_back(diagnostic);
+}
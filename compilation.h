@@ -0,0 +1,44 @@
+#ifndef COMPILATION_H
+#define COMPILATION_H
+
+#include <iostream>
+#include <string>
+#include <vector>
+
+enum diagnostic_t {
+  DIAGNOSTIC_ERROR,
+  DIAGNOSTIC_WARNING,
+};
+
+// An error or warning as data, for programs that embed the compiler
+struct Diagnostic {
+  diagnostic_t kind;
+  int line;
+  std::string message;
+};
+
+// State of compiling one source file, shared by its scanner, parser and generator so files can be compiled at once
+struct Compilation {
+  Compilation(std::string file, std::ostream& diagnostics = std::cerr, std::ostream& messages = std::cout)
+    : filename(file), source(NULL), code(NULL), lto(false), shards(0), lean(false), line_number(1), num_errors(0), num_warnings(0), warnings(true), fatal(false),
+      errors(diagnostics), output(messages) {}
+
+  void diagnose(diagnostic_t kind, int line, std::string message, bool numbered = true);
+
+  std::string filename;
+  const std::string* source; // Compiled instead of the file when set
+  std::ostream* code;        // Receives the C instead of a file when set, it is then not compiled to native code
+  bool lto;                  // Compile the C with link time optimization, so runtime helpers can be inlined
+  int shards;                // Extra C files the procedures are split across so gcc compiles them at once, 0 for one file
+  bool lean;                 // Generate C without the comments explaining it
+  int line_number;           // Of the token being parsed
+  int num_errors;
+  int num_warnings;
+  bool warnings;             // Reported, off while an inlined body is parsed again
+  bool fatal;                // Parsing stopped before the end of the source
+  std::vector<Diagnostic> diagnostics;
+  std::ostream& errors;      // Errors and warnings as text
+  std::ostream& output;      // Progress and inlining reports
+};
+
+#endif
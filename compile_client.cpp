@@ -0,0 +1,80 @@
+// Compile_client.cpp
+// Sends a program to the compile server and writes the C it returns next to the source, like the compiler would
+#include <iostream>
+#include <fstream>
+#include <sstream>
+#include <cstdlib>
+#include <cstring>
+#include <cerrno>
+#include <sys/socket.h>
+#include <sys/un.h>
+#include <unistd.h>
+#include "protocol.h"
+
+int main(int argc, char** argv)
+{
+  std::string path = SERVER_SOCKET;
+  char* filename = NULL;
+  Compile_options options;
+
+  for (int i = 1; i < argc; i++) {
+    if (!strcmp(argv[i], "-no-inline"))
+      options.inline_procedures = false;
+    else if (!strcmp(argv[i], "-report-inline"))
+      options.report_inlining = true;
+    else if (!strcmp(argv[i], "-lean"))
+      options.lean = true;
+    else if (!strcmp(argv[i], "-socket") && i + 1 < argc)
+      path = argv[++i];
+    else
+      filename = argv[i];
+  }
+
+  if (filename == NULL) {
+    std::cout << "Missing parameter: filename" << std::endl;
+    std::cout << "Usage: compile_client [-no-inline] [-report-inline] [-lean] [-socket path] filename" << std::endl;
+    exit(1);
+  }
+
+  std::ifstream ifs(filename);
+  if (!ifs) {
+    std::cerr << "Cannot read " << filename << std::endl;
+    exit(1);
+  }
+  std::stringstream buffer;
+  buffer << ifs.rdbuf();
+
+  struct sockaddr_un address;
+  memset(&address, 0, sizeof(address));
+  address.sun_family = AF_UNIX;
+  strncpy(address.sun_path, path.c_str(), sizeof(address.sun_path) - 1);
+  int fd = socket(AF_UNIX, SOCK_STREAM, 0);
+  if (fd < 0 || connect(fd, (struct sockaddr*)&address, sizeof(address)) < 0) {
+    std::cerr << "Cannot connect to the compile server at " << path << ": " << strerror(errno) << std::endl;
+    exit(1);
+  }
+
+  Compile_result result;
+  if (!send_request(fd, buffer.str(), options) || !receive_result(fd, result)) {
+    std::cerr << "The compile server did not answer" << std::endl;
+    exit(1);
+  }
+  close(fd);
+
+  for (unsigned int i = 0; i < result.diagnostics.size(); i++) {
+    const Diagnostic& diagnostic = result.diagnostics[i];
+    std::cerr << (diagnostic.kind == DIAGNOSTIC_ERROR ? "ERROR: " : "WARNING: ") << "Line " << diagnostic.line << ": " << diagnostic.message << "\n";
+  }
+  std::cout << result.messages;
+
+  if (result.success) {
+    std::string name = filename;
+    std::ofstream output(name.substr(0, name.find_last_of(".")) + ".c", std::ios_base::out | std::ios_base::trunc);
+    output << result.code;
+    std::cout << "Compilation completed with: \n\t" << result.num_errors << " Errors, \t" << result.num_warnings << " Warnings\n";
+  }
+  else
+    std::cout << "Compilation terminated with: \n\t" << result.num_errors << " Errors, \t" << result.num_warnings << " Warnings\n";
+
+  return result.success ? 0 : 1;
+}
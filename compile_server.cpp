@@ -0,0 +1,176 @@
+// Compile_server.cpp
+// Compiles programs sent over a Unix domain socket. It stays up between requests, so the keyword table, the
+// code of the compiler and the results of sources compiled before are warm when a request arrives.
+#include <iostream>
+#include <cstdlib>
+#include <cstring>
+#include <cerrno>
+#include <csignal>
+#include <exception>
+#include <deque>
+#include <unordered_map>
+#include <thread>
+#include <mutex>
+#include <condition_variable>
+#include <sys/socket.h>
+#include <sys/un.h>
+#include <unistd.h>
+#include "protocol.h"
+
+// Results of sources already compiled, the oldest is dropped when it is full
+struct Result_cache {
+  std::mutex lock;
+  std::unordered_map<std::string, Compile_result> results;
+  std::deque<std::string> order;
+  size_t limit;
+};
+
+static Result_cache cache;
+
+// Compilations running at once are limited to the number of jobs, connections beyond that wait for one to finish
+static std::mutex slots_lock;
+static std::condition_variable slot_free;
+static int free_slots;
+
+static void release_slot()
+{
+  std::lock_guard<std::mutex> lock(slots_lock);
+  free_slots++;
+  slot_free.notify_one();
+}
+
+static Compile_result compile(const std::string& source, const Compile_options& options)
+{
+  std::string key = std::string(1, '0' + options.inline_procedures + 2 * options.report_inlining + 4 * options.lean) + source;
+  if (cache.limit) {
+    std::lock_guard<std::mutex> lock(cache.lock);
+    std::unordered_map<std::string, Compile_result>::iterator it = cache.results.find(key);
+    if (it != cache.results.end())
+      return it->second;
+  }
+
+  {
+    std::unique_lock<std::mutex> lock(slots_lock);
+    while (!free_slots)
+      slot_free.wait(lock);
+    free_slots--;
+  }
+  Compile_result result;
+  try {
+    result = compile_source(source, options);
+  }
+  catch (...) {
+    release_slot();
+    throw;
+  }
+  release_slot();
+
+  if (cache.limit) {
+    std::lock_guard<std::mutex> lock(cache.lock);
+    if (cache.results.insert(std::make_pair(key, result)).second) {
+      cache.order.push_back(key);
+      if (cache.order.size() > cache.limit) {
+        cache.results.erase(cache.order.front());
+        cache.order.pop_front();
+      }
+    }
+  }
+  return result;
+}
+
+// The answer to a request too large to read, the connection is closed after it
+static Compile_result too_large(size_t size)
+{
+  Compile_result result;
+  Diagnostic diagnostic;
+  diagnostic.kind = DIAGNOSTIC_ERROR;
+  diagnostic.line = 0;
+  diagnostic.message = "Request of " + std::to_string(size) + " bytes is larger than the limit of " + std::to_string(MAX_REQUEST_SIZE);
+  result.success = false;
+  result.diagnostics.push_back(diagnostic);
+  result.num_errors = 1;
+  result.num_warnings = 0;
+  return result;
+}
+
+// Serves the requests of a connection until its client closes it. What goes wrong in one connection only ends it
+static void serve(int fd)
+{
+  std::string source;
+  Compile_options options;
+  size_t size;
+  try {
+    while (true) {
+      request_t request = receive_request(fd, source, options, size);
+      if (request == REQUEST_TOO_LARGE)
+        send_result(fd, too_large(size));
+      if (request != REQUEST_COMPILE || !send_result(fd, compile(source, options)))
+        break;
+    }
+  }
+  catch (const std::exception& e) {
+    std::cerr << "Connection closed: " << e.what() << std::endl;
+  }
+  close(fd);
+}
+
+int main(int argc, char** argv)
+{
+  std::string path = SERVER_SOCKET;
+  int jobs = std::thread::hardware_concurrency();
+  cache.limit = 256;
+
+  for (int i = 1; i < argc; i++) {
+    if (!strcmp(argv[i], "-j") && i + 1 < argc)
+      jobs = atoi(argv[++i]);
+    else if (!strcmp(argv[i], "-cache") && i + 1 < argc)
+      cache.limit = atoi(argv[++i]);
+    else if (argv[i][0] == '-') {
+      std::cout << "Usage: compile_server [-j jobs] [-cache results] [socket]" << std::endl;
+      exit(1);
+    }
+    else
+      path = argv[i];
+  }
+  if (jobs < 1)
+    jobs = 1;
+  free_slots = jobs;
+
+  signal(SIGPIPE, SIG_IGN); // A client that goes away only ends its connection
+
+  struct sockaddr_un address;
+  memset(&address, 0, sizeof(address));
+  address.sun_family = AF_UNIX;
+  if (path.size() >= sizeof(address.sun_path)) {
+    std::cerr << "Socket path too long: " << path << std::endl;
+    exit(1);
+  }
+  strcpy(address.sun_path, path.c_str());
+
+  int server = socket(AF_UNIX, SOCK_STREAM, 0);
+  unlink(path.c_str());
+  if (server < 0 || bind(server, (struct sockaddr*)&address, sizeof(address)) < 0 || listen(server, 128) < 0) {
+    std::cerr << "Cannot listen on " << path << ": " << strerror(errno) << std::endl;
+    exit(1);
+  }
+
+  // Build the shared tables and fault in the compiler before the first request is timed
+  compile_source("program warm is begin end program");
+
+  std::cout << "Compile server listening on " << path << ", compiling " << jobs << " at once" << std::endl;
+
+  while (true) {
+    int fd = accept(server, NULL, NULL);
+    if (fd < 0) {
+      if (errno == EINTR)
+        continue;
+      std::cerr << "accept: " << strerror(errno) << std::endl;
+      break;
+    }
+    std::thread(serve, fd).detach();
+  }
+
+  close(server);
+  unlink(path.c_str());
+  return 1;
+}
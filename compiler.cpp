@@ -0,0 +1,30 @@
+#include <sstream>
+#include "compiler.h"
+#include "parser.h"
+
+Compile_result compile_source(const std::string& source, const Compile_options& options)
+{
+  std::ostringstream code;
+  std::ostringstream messages;
+  std::ostream discard(NULL); // Diagnostics are returned as data, not text
+  
+  Compilation context("<memory>", discard, messages);
+  context.source = &source;
+  context.code = &code;
+  context.lean = options.lean;
+  
+  Parser* parser = new Parser(context);
+  parser->inline_procedures = options.inline_procedures;
+  parser->report_inlining = options.report_inlining;
+  parser->start();
+  delete parser;
+  
+  Compile_result result;
+  result.success = !context.num_errors && !context.fatal;
+  result.code = code.str();
+  result.diagnostics = context.diagnostics;
+  result.num_errors = context.num_errors;
+  result.num_warnings = context.num_warnings;
+  result.messages = messages.str();
+  return result;
+}
@@ -0,0 +1,30 @@
+#ifndef COMPILER_H
+#define COMPILER_H
+
+#include <string>
+#include <vector>
+#include "compilation.h"
+
+// Options of a compilation from memory, the same as the command line's
+struct Compile_options {
+  Compile_options() : inline_procedures(true), report_inlining(false), lean(false) {}
+
+  bool inline_procedures;
+  bool report_inlining;
+  bool lean;
+};
+
+// What compiling a program from memory produced
+struct Compile_result {
+  bool success;                        // No errors, code holds the whole program
+  std::string code;                    // Generated C, built with -I for runtime.h and linked with libruntime.a
+  std::vector<Diagnostic> diagnostics; // In the order they were found
+  int num_errors;
+  int num_warnings;
+  std::string messages;                // Inlining reports and why compilation stopped
+};
+
+// Compiles source text to C without touching the filesystem, safe to call from several threads at once
+Compile_result compile_source(const std::string& source, const Compile_options& options = Compile_options());
+
+#endif
@@ -0,0 +1,79 @@
+#include "runtime.h"
+
+long long module_counter_data;		// Start of the module's static memory
+
+void module_counter(int entry) {
+	goto enter_function;
+	void* ret1;		// Return address of getbool
+	bool lv2;		// getbool bb
+	long long lv2_address;
+getbool:
+	lv2 = getBool();
+	goto *ret1;
+	void* ret3;		// Return address of getinteger
+	int lv4;		// getinteger ii
+	long long lv4_address;
+getinteger:
+	lv4 = getInteger();
+	goto *ret3;
+	void* ret5;		// Return address of getfloat
+	double lv6;		// getfloat ff
+	long long lv6_address;
+getfloat:
+	lv6 = getFloat();
+	goto *ret5;
+	void* ret7;		// Return address of getstring
+	long long lv8;		// getstring ss
+	long long lv8_address;
+getstring:
+	lv8 = (long long)getString();
+	goto *ret7;
+	void* ret9;		// Return address of putbool
+	bool lv10;		// putbool b
+putbool:
+	putBool(lv10);
+	goto *ret9;
+	void* ret11;		// Return address of putinteger
+	int lv12;		// putinteger i
+putinteger:
+	putInteger(lv12);
+	goto *ret11;
+	void* ret13;		// Return address of putfloat
+	double lv14;		// putfloat f
+putfloat:
+	putFloat(lv14);
+	goto *ret13;
+	void* ret15;		// Return address of putstring
+	long long lv16;		// putstring s
+putstring:
+	putString((char*)lv16);
+	goto *ret15;
+bump:
+	Reg[0] = (long long)MEM(int, (module_counter_data + 0)) * 4;		// expression = operand1 op operand2
+	Reg[0] = (module_counter_data + 4) + Reg[0];		// expression = operand1 op operand2
+	MEM(int, Reg[0]) = (long long)MEM(int, Reg[FP] + 16);		// history + offset = expression
+	Reg[0] = (long long)MEM(int, (module_counter_data + 0)) + (long long)MEM(int, Reg[FP] + 16);		// expression = operand1 op operand2
+	MEM(int, (module_counter_data + 0)) = Reg[0];		// assign static
+	Reg[SP] = Reg[FP];		// Free local variables
+	Reg[FP] = MEM(long long, Reg[FP]);		// Restore Frame pointer
+	Reg[SP] = Reg[SP] + 8;		// Free space for FP
+	Reg[0] = MEM(long long, Reg[SP]);		// Pop return address off the stack
+	Reg[SP] = Reg[SP] + 8;		// Free return address space
+	goto *(void*)Reg[0];		// Return
+enter_function:
+	Reg[SP] = Reg[SP] - 8;		// Allocate space for return address
+	MEM(long long, Reg[SP]) = (long long)&&leave_function;		// save return address
+	Reg[SP] = Reg[SP] - 8;		// Allocate space for FP
+	MEM(long long, Reg[SP]) = Reg[FP];		// Save frame pointer
+	Reg[FP] = Reg[SP];		// Move frame pointer to new position
+	switch (entry) {
+		case 0: goto bump;
+	}
+leave_function:
+	return;
+}
+
+void module_counter_init()
+{
+	module_counter_data = (heapAlloc(20 + 7) + 7) & -8;
+}
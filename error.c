@@ -0,0 +1,80 @@
+#include "runtime.h"
+
+long long static_data();
+
+int main() {
+	goto start;
+	void* ret1;		// Return address of getbool
+	bool lv2;		// getbool bb
+	long long lv2_address;
+getbool:
+	lv2 = getBool();
+	goto *ret1;
+	void* ret3;		// Return address of getinteger
+	int lv4;		// getinteger ii
+	long long lv4_address;
+getinteger:
+	lv4 = getInteger();
+	goto *ret3;
+	void* ret5;		// Return address of getfloat
+	double lv6;		// getfloat ff
+	long long lv6_address;
+getfloat:
+	lv6 = getFloat();
+	goto *ret5;
+	void* ret7;		// Return address of getstring
+	long long lv8;		// getstring ss
+	long long lv8_address;
+getstring:
+	lv8 = (long long)getString();
+	goto *ret7;
+	void* ret9;		// Return address of putbool
+	bool lv10;		// putbool b
+putbool:
+	putBool(lv10);
+	goto *ret9;
+	void* ret11;		// Return address of putinteger
+	int lv12;		// putinteger i
+putinteger:
+	putInteger(lv12);
+	goto *ret11;
+	void* ret13;		// Return address of putfloat
+	double lv14;		// putfloat f
+putfloat:
+	putFloat(lv14);
+	goto *ret13;
+	void* ret15;		// Return address of putstring
+	long long lv16;		// putstring s
+putstring:
+	putString((char*)lv16);
+	goto *ret15;
+	static double v17;		// redeclaration
+	static long long v18;		// redeclaration
+	static bool v19;		// scope
+	static int v20;		// scope2
+	static double v21;		// float1
+	static double v22;		// float2
+	static int v23;		// int1
+	static int v24;		// int2
+	static long long v25;		// string1
+	static long long v26;		// string2
+	static bool v27;		// bool1
+	static bool v28;		// bool2
+	void* ret29;		// Return address of test_procedure
+	long long lv30;		// test_procedure intest
+	double lv31;		// test_procedure outtest
+	long long lv31_address;
+	int lv32;		// test_procedure scope
+	return 0;
+}
+
+long long static_data()
+{
+	strcpy(&MEM(char, 33), "Another test");
+	strcpy(&MEM(char, 1), "Should be a warning");
+	strcpy(&MEM(char, 21), "Test string");
+	strcpy(&MEM(char, 87), "This expression should be true\n");
+	strcpy(&MEM(char, 68), "This is not okay\n");
+	strcpy(&MEM(char, 46), "This should be okay\n");
+	return 120;
+}
@@ -2,17 +2,12 @@
 #include <sstream>
 #include "error.h"
 
-int Scanner::num_errors;
-int Scanner::num_warnings;
-
 Error::Error() noexcept
 {
-  Scanner::num_errors++;
 }
 
 Error::Error(const std::string &message) noexcept : msg(message)
 {
-  Scanner::num_errors++;
 }
 
 NoDeclaration::NoDeclaration(std::string wrd) noexcept
@@ -47,17 +42,13 @@ InvalidOp::InvalidOp(type_t type1, type_t type2) noexcept
 
 const char * Error::what() const noexcept
 {
-  std::stringstream stream;
-  stream << "ERROR: Line " << Scanner::line_number << ": ";
-  stream << msg;
-  return stream.str().c_str();
+  return msg.c_str();
 }
 
 const char * SyntaxError::what() const noexcept
 {
   std::stringstream stream;
   std::string strng;
-  stream << "ERROR: Line " << Scanner::line_number << ": ";
   stream << msg;
   if (expected && found) {
     stream << "A ";
@@ -67,31 +58,34 @@ const char * SyntaxError::what() const noexcept
     stream << " was found.";
   }
   stream << std::endl;
-  return stream.str().c_str();
+  text = stream.str();
+  return text.c_str();
 }
 
 const char * InvalidAssignment::what() const noexcept
 {
   std::stringstream stream;
   std::string strng;
-  stream << "ERROR: Line " << Scanner::line_number << ": ";
   stream << "Invalid assignment to type ";
   stream << Scanner::print_token(left_type->type(), strng);
+  if (left_type->type() == TYPE_INT && left_type->size() != Type::natural_size(TYPE_INT)) { stream << 8 * left_type->size(); }
   if (left_type->array()) { stream << "[" << left_type->arraysize() << "]"; }
   stream << " from type ";
   stream << Scanner::print_token(right_type->type(), strng);
+  if (right_type->type() == TYPE_INT && right_type->size() != Type::natural_size(TYPE_INT)) { stream << 8 * right_type->size(); }
   if (right_type->array()) { stream << "[" << right_type->arraysize() << "]"; }
   if (arg) { stream << " in argument " << arg; }
   stream << std::endl;
   
-  return stream.str().c_str();
+  text = stream.str();
+  return text.c_str();
 }
 
 const char * InvalidExpression::what() const noexcept
 {
   std::stringstream stream;
   std::string strng;
-  stream << "ERROR: Line " << Scanner::line_number << ": "; // TODO more detail in error
+  // TODO more detail in error
   stream << "Invalid type compatability between ";
   stream << Scanner::print_token(left_type->type(), strng);
   stream << " and ";
@@ -99,37 +93,38 @@ const char * InvalidExpression::what() const noexcept
   stream << " in expression near operator " << Scanner::print_token(op_type, strng);
   stream << std::endl;
   
-  return stream.str().c_str();
+  text = stream.str();
+  return text.c_str();
 }
 
 const char * InvalidOp::what() const noexcept
 {
   std::stringstream stream;
   std::string strng;
-  stream << "ERROR: Line " << Scanner::line_number << ": ";
   stream << "Operation ";
   stream << Scanner::print_token(op_type, strng);
   stream << " not defined for type ";
   stream << Scanner::print_token(type_type, strng);
   stream << std::endl;
   
-  return stream.str().c_str();
+  text = stream.str();
+  return text.c_str();
 }
 
 const char * NoDeclaration::what() const noexcept
 {
   std::stringstream stream;
-  stream << "ERROR: Line " << Scanner::line_number << ": ";
   stream << "'" << word << "'" << " has not been declared in the current scope\n";
 
-  return stream.str().c_str();
+  text = stream.str();
+  return text.c_str();
 }
 
 const char * Redeclaration::what() const noexcept
 {
   std::stringstream stream;
-  stream << "ERROR: Line " << Scanner::line_number << ": ";
   stream << "'" << word << "'" << " has already been declared in the current scope.\n";
   
-  return stream.str().c_str();
+  text = stream.str();
+  return text.c_str();
 }
\ No newline at end of file
@@ -14,6 +14,7 @@ public:
   virtual const char * what() const noexcept;
 protected:
   std::string msg;
+  mutable std::string text; // Returned by what(), the line is prefixed by whoever reports the error
 };
 
 class SyntaxError : public Error {
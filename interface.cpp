@@ -0,0 +1,96 @@
+#include <cstdio>
+#include <fstream>
+#include <sstream>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <fcntl.h>
+#include <unistd.h>
+#include "interface.h"
+
+Interface_file::Interface_file()
+{
+  header = NULL;
+  records = NULL;
+  names = NULL;
+  map = NULL;
+  length = 0;
+}
+
+Interface_file::~Interface_file()
+{
+  if (map)
+    munmap(map, length);
+}
+
+bool Interface_file::open(std::string path)
+{
+  int fd = ::open(path.c_str(), O_RDONLY);
+  if (fd < 0)
+    return false;
+  struct stat status;
+  if (fstat(fd, &status) < 0 || status.st_size < (off_t)sizeof(Interface_header)) {
+    close(fd);
+    return false;
+  }
+  length = status.st_size;
+  map = mmap(NULL, length, PROT_READ, MAP_PRIVATE, fd, 0);
+  close(fd);
+  if (map == MAP_FAILED) {
+    map = NULL;
+    return false;
+  }
+
+  // Everything is checked once here, so the records can be used without checks
+  header = (const Interface_header*)map;
+  if (header->magic != INTERFACE_MAGIC || header->version != INTERFACE_VERSION || header->names == 0
+      || length != sizeof(Interface_header) + (size_t)header->count * sizeof(Interface_record) + header->names)
+    return false;
+  records = (const Interface_record*)(header + 1);
+  names = (const char*)(records + header->count);
+  if (names[header->names - 1] != '\0' || header->module >= header->names)
+    return false;
+  for (uint32_t i = 0; i < header->count; i++) {
+    if (records[i].name >= header->names || records[i].kind > INTERFACE_GLOBAL)
+      return false;
+  }
+  return true;
+}
+
+bool save_interface(std::string path, Interface_header& header, std::vector<Interface_record> &records, std::string& names)
+{
+  header.magic = INTERFACE_MAGIC;
+  header.version = INTERFACE_VERSION;
+  header.count = records.size();
+  header.names = names.size();
+
+  // Written whole under another name first, so a compilation reading it never sees half of it
+  std::string temporary = path + ".tmp";
+  std::ofstream ofs(temporary.c_str(), std::ios_base::out | std::ios_base::trunc | std::ios_base::binary);
+  ofs.write((const char*)&header, sizeof(header));
+  if (!records.empty())
+    ofs.write((const char*)&records[0], records.size() * sizeof(Interface_record));
+  ofs.write(names.data(), names.size());
+  ofs.close();
+  return ofs && rename(temporary.c_str(), path.c_str()) == 0;
+}
+
+uint64_t hash_bytes(const std::string& bytes)
+{
+  uint64_t hash = 14695981039346656037ULL; // FNV-1a
+  for (unsigned int i = 0; i < bytes.size(); i++) {
+    hash ^= (unsigned char)bytes[i];
+    hash *= 1099511628211ULL;
+  }
+  return hash;
+}
+
+bool hash_file(std::string path, uint64_t& hash)
+{
+  std::ifstream ifs(path.c_str(), std::ios_base::in | std::ios_base::binary);
+  if (!ifs)
+    return false;
+  std::stringstream buffer;
+  buffer << ifs.rdbuf();
+  hash = hash_bytes(buffer.str());
+  return true;
+}
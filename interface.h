@@ -0,0 +1,68 @@
+#ifndef INTERFACE_H
+#define INTERFACE_H
+
+#include <string>
+#include <vector>
+#include <stdint.h>
+
+#define INTERFACE_MAGIC 0x4649444d // "MDIF" as read on little endian machines
+#define INTERFACE_VERSION 2        // Version 1 was text
+
+// Options a module was compiled with, a dependency compiled differently is compiled again
+#define INTERFACE_INLINE 1
+#define INTERFACE_LTO 2
+
+enum interface_kind_t {
+  INTERFACE_IMPORT,    // Module the module imports
+  INTERFACE_PROCEDURE, // Followed by the records of its parameters, in order
+  INTERFACE_PARAM,
+  INTERFACE_GLOBAL,
+};
+
+// A .interface file is this header, then the records, then the names the records point into
+struct Interface_header {
+  uint32_t magic;
+  uint32_t version;
+  uint64_t source_hash; // Of the source it was compiled from, the interface is out of date when the source differs
+  uint32_t options;
+  uint32_t count;       // Of records
+  uint32_t names;       // Bytes of names, each ends in a 0
+  uint32_t module;      // Offset of the module's name
+};
+
+// One exported name, a parameter or a module imported
+struct Interface_record {
+  uint32_t kind;
+  uint32_t name;        // Offset in the names
+  int32_t type;         // type_t of a parameter or global
+  uint32_t size;        // Bytes of one element
+  uint32_t array_size;
+  int32_t address;      // Entry number of a procedure, offset of a global in the module's static memory
+  uint8_t array;
+  uint8_t direction;    // direction_t of a parameter
+  uint8_t padding[2];
+};
+
+// An interface file mapped into memory, the records are read where they are
+class Interface_file {
+  public:
+    Interface_file();
+    ~Interface_file();
+
+    bool open(std::string path); // False if it is missing, of another version or damaged
+    const char* name(uint32_t offset) { return names + offset; }
+
+    const Interface_header* header;
+    const Interface_record* records;
+    const char* names;
+
+  private:
+    void* map;
+    size_t length;
+};
+
+bool save_interface(std::string path, Interface_header& header, std::vector<Interface_record> &records, std::string& names);
+uint64_t hash_bytes(const std::string& bytes);
+bool hash_file(std::string path, uint64_t& hash);
+
+#endif
@@ -1,30 +1,265 @@
 // Main.cpp
 #include <iostream>
+#include <sstream>
 #include <cstdlib>
+#include <cstring>
+#include <vector>
+#include <thread>
+#include <mutex>
+#include <condition_variable>
+#include <unistd.h>
 #include "parser.h"
+#include "interface.h"
 
-int main(int argc, char** argv)
+static bool inline_procedures = true;
+static bool report_inlining = false;
+static bool lto = false;
+static bool lean = false;
+static int shards = 0;
+
+static void usage()
 {
-  char* filename;
-  
-  if(argc > 1)
-    filename = argv[1];
-  else {
-    std::cout << "Missing parameter: filename" << std::endl;
-    exit(1);
-  }
-  
-  Parser* parser = new Parser(filename);
+  std::cout << "Usage: compiler [-no-inline] [-report-inline] [-lto] [-lean] [-shards count] [-j jobs] filename..." << std::endl;
+  exit(1);
+}
+
+// Compiles one file, everything it reports goes to the streams of its compilation
+static void compile(Compilation& context)
+{
+  context.lto = lto;
+  context.lean = lean;
+  context.shards = shards;
+  Parser* parser = new Parser(context);
+  parser->inline_procedures = inline_procedures;
+  parser->report_inlining = report_inlining;
   parser->start();
 
-  if (Scanner::num_errors > 0 && !(parser->EOF_found))
-    std::cout << "Compilation terminated with: \n\t" << Scanner::num_errors << " Errors, \t" << Scanner::num_warnings << " Warnings\n"; 
-  else if (Scanner::num_errors > 0)
-    std::cout << "Parsing complete, compilation terminated with: \n\t" << Scanner::num_errors << " Errors, \t" << Scanner::num_warnings << " Warnings\n";
+  if (context.fatal)
+    ;
+  else if (context.num_errors > 0 && !(parser->EOF_found))
+    context.output << "Compilation terminated with: \n\t" << context.num_errors << " Errors, \t" << context.num_warnings << " Warnings\n";
+  else if (context.num_errors > 0)
+    context.output << "Parsing complete, compilation terminated with: \n\t" << context.num_errors << " Errors, \t" << context.num_warnings << " Warnings\n";
   else
-    std::cout << "Compilation completed with: \n\t" << Scanner::num_errors << " Errors, \t" << Scanner::num_warnings << " Warnings\n"; 
-  
+    context.output << "Compilation completed with: \n\t" << context.num_errors << " Errors, \t" << context.num_warnings << " Warnings\n";
+
   delete parser;
+}
+
+// A file to compile, after the files of the modules it imports
+struct Unit {
+  std::string filename;
+  std::vector<int> imports;
+  bool given;  // On the command line, not only imported
+  enum { WAITING, COMPILING, CURRENT, COMPILED, FAILED } state;
+  std::ostringstream report;
+};
+
+// Modules named on the import lines in front of a file's header
+static std::vector<std::string> imported_modules(std::string filename)
+{
+  std::ostringstream ignored;
+  Compilation context(filename, ignored, ignored);
+  Scanner scanner(context);
+  scanner.quiet = true;
+  
+  std::vector<std::string> names;
+  Token* token = scanner.get_token(*scanner.input);
+  while (token->type == RESERVED_IMPORT) {
+    delete token;
+    token = scanner.get_token(*scanner.input);
+    if (token->type != TOK_IDENTIFIER)
+      break;
+    names.push_back(token->string);
+    delete token;
+    token = scanner.get_token(*scanner.input);
+    if (token->type != TOK_SEMICOLON)
+      break;
+    delete token;
+    token = scanner.get_token(*scanner.input);
+  }
+  delete token;
+  return names;
+}
+
+// Whether a module's interface and object were built from its source as it is now, with the same options
+static bool current(std::string filename)
+{
+  std::string rawname = filename.substr(0, filename.find_last_of('.'));
+  unsigned int options = (inline_procedures ? INTERFACE_INLINE : 0) | (lto ? INTERFACE_LTO : 0);
+  Interface_file file;
+  uint64_t hash;
+  return file.open(rawname + ".interface") && file.header->options == options && hash_file(filename, hash)
+    && hash == file.header->source_hash && access((rawname + ".o.build").c_str(), F_OK) == 0;
+}
+
+// Adds a file after the sources of the modules it imports, those without a source in its directory must have been compiled already
+static bool add_unit(std::string filename, bool given, std::vector<Unit*> &units, std::map<std::string, int> &index, std::vector<std::string> &path)
+{
+  for (unsigned int i = 0; i < path.size(); i++) {
+    if (path[i] == filename) {
+      std::cout << "Import cycle:";
+      for (; i < path.size(); i++)
+        std::cout << " " << path[i] << " ->";
+      std::cout << " " << filename << std::endl;
+      return false;
+    }
+  }
+  if (index.count(filename)) {
+    units[index[filename]]->given |= given;
+    return true;
+  }
+  
+  std::string directory;
+  size_t slash = filename.find_last_of('/');
+  if (slash != std::string::npos)
+    directory = filename.substr(0, slash + 1);
+  
+  std::vector<int> imports;
+  std::vector<std::string> names = imported_modules(filename);
+  path.push_back(filename);
+  for (unsigned int i = 0; i < names.size(); i++) {
+    std::string source = directory + names[i] + ".src";
+    if (access(source.c_str(), R_OK) != 0)
+      continue;
+    if (!add_unit(source, false, units, index, path))
+      return false;
+    imports.push_back(index[source]);
+  }
+  path.pop_back();
+  
+  index[filename] = units.size();
+  units.push_back(new Unit());
+  units.back()->filename = filename;
+  units.back()->imports = imports;
+  units.back()->given = given;
+  units.back()->state = Unit::WAITING;
+  return true;
+}
+
+int main(int argc, char** argv)
+{
+  std::vector<std::string> filenames;
+  int jobs = 1;
+
+  for (int i = 1; i < argc; i++) {
+    if (!strcmp(argv[i], "-no-inline"))
+      inline_procedures = false;
+    else if (!strcmp(argv[i], "-report-inline"))
+      report_inlining = true;
+    else if (!strcmp(argv[i], "-lto"))
+      lto = true;
+    else if (!strcmp(argv[i], "-lean"))
+      lean = true;
+    else if (!strcmp(argv[i], "-shards")) {
+      if (++i == argc || (shards = atoi(argv[i])) < 1) {
+        std::cout << "Invalid parameter: -shards needs a number of files" << std::endl;
+        usage();
+      }
+    }
+    else if (!strcmp(argv[i], "-j")) {
+      if (++i == argc || (jobs = atoi(argv[i])) < 1) {
+        std::cout << "Invalid parameter: -j needs a number of jobs" << std::endl;
+        usage();
+      }
+    }
+    else
+      filenames.push_back(argv[i]);
+  }
+
+  if (filenames.empty()) {
+    std::cout << "Missing parameter: filename" << std::endl;
+    usage();
+  }
+
+  // Modules are compiled before the files importing them, a file that imports none is compiled on its own.
+  // A module that is only imported is not compiled again while its source and those of its imports are unchanged
+  std::vector<Unit*> units;
+  std::map<std::string, int> index;
+  for (unsigned int i = 0; i < filenames.size(); i++) {
+    std::vector<std::string> path;
+    if (!add_unit(filenames[i], true, units, index, path))
+      return 1;
+  }
+
+  if (units.size() == 1) {
+    delete units[0];
+    Compilation context(filenames[0]);
+    compile(context);
+    return context.fatal || context.num_errors ? 1 : 0;
+  }
+
+  // The next free job takes the first file whose imports are compiled, reports are printed in that order
+  std::mutex lock;
+  std::condition_variable finished;
+  bool failed = false;
+  unsigned int printed = 0;
+
+  auto worker = [&]() {
+    std::unique_lock<std::mutex> guard(lock);
+    while (true) {
+      Unit* unit = NULL;
+      bool waiting = false;
+      for (unsigned int i = 0; i < units.size() && !unit; i++) {
+        if (units[i]->state != Unit::WAITING)
+          continue;
+        bool ready = true;
+        bool changed = false;
+        std::string broken;
+        for (unsigned int j = 0; j < units[i]->imports.size(); j++) {
+          Unit* module = units[units[i]->imports[j]];
+          if (module->state == Unit::FAILED)
+            broken = module->filename;
+          else if (module->state == Unit::COMPILED)
+            changed = true;
+          else if (module->state != Unit::CURRENT)
+            ready = false;
+        }
+        if (!broken.empty()) { // Its interface or object would be missing or stale
+          units[i]->report << "Not compiled, " << broken << " did not compile\n";
+          units[i]->state = Unit::FAILED;
+          failed = true;
+        }
+        else if (ready && !changed && !units[i]->given && current(units[i]->filename)) {
+          units[i]->report << "Up to date\n";
+          units[i]->state = Unit::CURRENT;
+        }
+        else if (ready)
+          unit = units[i];
+        else
+          waiting = true;
+      }
+      
+      if (unit) {
+        unit->state = Unit::COMPILING;
+        guard.unlock();
+        Compilation context(unit->filename, unit->report, unit->report);
+        compile(context);
+        guard.lock();
+        unit->state = context.fatal || context.num_errors ? Unit::FAILED : Unit::COMPILED;
+        if (unit->state == Unit::FAILED)
+          failed = true;
+      }
+      
+      for (; printed < units.size() && units[printed]->state > Unit::COMPILING; printed++)
+        std::cout << units[printed]->filename << ":\n" << units[printed]->report.str() << std::flush;
+      finished.notify_all();
+      if (unit)
+        continue;
+      if (!waiting)
+        break;
+      finished.wait(guard);
+    }
+  };
+
+  std::vector<std::thread> threads;
+  for (unsigned int t = 1; t < (unsigned int)jobs && t < units.size(); t++)
+    threads.push_back(std::thread(worker));
+  worker();
+  for (unsigned int t = 0; t < threads.size(); t++)
+    threads[t].join();
 
-  return 0;
-}
\ No newline at end of file
+  for (unsigned int i = 0; i < units.size(); i++)
+    delete units[i];
+  return failed ? 1 : 0;
+}
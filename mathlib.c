@@ -0,0 +1,142 @@
+#include "runtime.h"
+
+extern long long module_counter_data;
+void module_counter(int entry);
+void module_counter_init();
+
+long long module_mathlib_data;		// Start of the module's static memory
+
+void module_mathlib(int entry) {
+	goto enter_function;
+	void* ret1;		// Return address of getbool
+	bool lv2;		// getbool bb
+	long long lv2_address;
+getbool:
+	lv2 = getBool();
+	goto *ret1;
+	void* ret3;		// Return address of getinteger
+	int lv4;		// getinteger ii
+	long long lv4_address;
+getinteger:
+	lv4 = getInteger();
+	goto *ret3;
+	void* ret5;		// Return address of getfloat
+	double lv6;		// getfloat ff
+	long long lv6_address;
+getfloat:
+	lv6 = getFloat();
+	goto *ret5;
+	void* ret7;		// Return address of getstring
+	long long lv8;		// getstring ss
+	long long lv8_address;
+getstring:
+	lv8 = (long long)getString();
+	goto *ret7;
+	void* ret9;		// Return address of putbool
+	bool lv10;		// putbool b
+putbool:
+	putBool(lv10);
+	goto *ret9;
+	void* ret11;		// Return address of putinteger
+	int lv12;		// putinteger i
+putinteger:
+	putInteger(lv12);
+	goto *ret11;
+	void* ret13;		// Return address of putfloat
+	double lv14;		// putfloat f
+putfloat:
+	putFloat(lv14);
+	goto *ret13;
+	void* ret15;		// Return address of putstring
+	long long lv16;		// putstring s
+putstring:
+	putString((char*)lv16);
+	goto *ret15;
+square:
+	Reg[0] = (long long)MEM(int, (module_mathlib_data + 0)) + 1;		// expression = operand1 op operand2
+	MEM(int, (module_mathlib_data + 0)) = Reg[0];		// assign static
+	Reg[0] = 1;		// operand
+	Reg[SP] = Reg[SP] - 8;		// Make space on stack for argument
+	MEM(int, Reg[SP]) = Reg[0];		// Move argument to stack
+	module_counter(0);		// call bump in another function
+	Reg[SP] = Reg[SP] + 8;		// Free input parameter
+	Reg[0] = (long long)MEM(int, Reg[FP] + 16) * (long long)MEM(int, Reg[FP] + 16);		// expression = operand1 op operand2
+	MEM(int, Reg[FP] + 32) = Reg[0];		// assign parameter
+	Reg[SP] = Reg[FP];		// Free local variables
+	Reg[FP] = MEM(long long, Reg[FP]);		// Restore Frame pointer
+	Reg[SP] = Reg[SP] + 8;		// Free space for FP
+	Reg[0] = MEM(long long, Reg[SP]);		// Pop return address off the stack
+	Reg[SP] = Reg[SP] + 8;		// Free return address space
+	goto *(void*)Reg[0];		// Return
+	static int v19;		// i
+sum:
+	MEM(int, Reg[FP] + 32) = 0;		// assign parameter
+	v19 = 0;		// assign local variable
+	{		// Loop invariants
+	long long iv20;
+	long long ptr21;
+	iv20 = v19;		// Induction variable
+	Reg[0] = iv20 * 4;		// expression = operand1 op operand2
+	Reg[0] = (MEM(long long, Reg[FP] + 16)) + Reg[0];		// expression = operand1 op operand2
+	ptr21 = Reg[0];		// Address stepped by the loop
+	if (iv20 < 4) {
+	do {
+	Reg[0] = ptr21;		// operand
+	Reg[0] = MEM(int, Reg[0]);		// Get array operand
+	Reg[0] = (long long)MEM(int, Reg[FP] + 32) + Reg[0];		// expression = operand1 op operand2
+	MEM(int, Reg[FP] + 32) = Reg[0];		// assign parameter
+	Reg[0] = iv20 + 1;		// expression = operand1 op operand2
+	iv20 = Reg[0];		// assign local variable
+	ptr21 = ptr21 + 4;
+	} while (iv20 < 4);
+	}
+	v19 = iv20;
+	}
+	Reg[0] = 2;		// operand
+	Reg[SP] = Reg[SP] - 8;		// Make space on stack for argument
+	MEM(int, Reg[SP]) = Reg[0];		// Move argument to stack
+	module_counter(0);		// call bump in another function
+	Reg[SP] = Reg[SP] + 8;		// Free input parameter
+	Reg[SP] = Reg[FP];		// Free local variables
+	Reg[FP] = MEM(long long, Reg[FP]);		// Restore Frame pointer
+	Reg[SP] = Reg[SP] + 8;		// Free space for FP
+	Reg[0] = MEM(long long, Reg[SP]);		// Pop return address off the stack
+	Reg[SP] = Reg[SP] + 8;		// Free return address space
+	goto *(void*)Reg[0];		// Return
+greet:
+	Reg[0] = (long long)&MEM(char, module_mathlib_data + 16);		// operand
+	lv16 = Reg[0];		// Pass argument
+	ret15 = &&postputstring1;
+	goto putstring;		// jump to leaf procedure
+postputstring1:
+	Reg[0] = MEM(long long, Reg[FP] + 16);		// operand
+	lv16 = Reg[0];		// Pass argument
+	ret15 = &&postputstring2;
+	goto putstring;		// jump to leaf procedure
+postputstring2:
+	Reg[SP] = Reg[FP];		// Free local variables
+	Reg[FP] = MEM(long long, Reg[FP]);		// Restore Frame pointer
+	Reg[SP] = Reg[SP] + 8;		// Free space for FP
+	Reg[0] = MEM(long long, Reg[SP]);		// Pop return address off the stack
+	Reg[SP] = Reg[SP] + 8;		// Free return address space
+	goto *(void*)Reg[0];		// Return
+enter_function:
+	Reg[SP] = Reg[SP] - 8;		// Allocate space for return address
+	MEM(long long, Reg[SP]) = (long long)&&leave_function;		// save return address
+	Reg[SP] = Reg[SP] - 8;		// Allocate space for FP
+	MEM(long long, Reg[SP]) = Reg[FP];		// Save frame pointer
+	Reg[FP] = Reg[SP];		// Move frame pointer to new position
+	switch (entry) {
+		case 0: goto square;
+		case 1: goto sum;
+		case 2: goto greet;
+	}
+leave_function:
+	return;
+}
+
+void module_mathlib_init()
+{
+	module_mathlib_data = (heapAlloc(23 + 7) + 7) & -8;
+	strcpy(&MEM(char, module_mathlib_data + 16), "hello ");
+}
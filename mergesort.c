@@ -0,0 +1,477 @@
+#include "runtime.h"
+
+long long static_data();
+
+int main() {
+	goto start;
+	void* ret1;		// Return address of getbool
+	bool lv2;		// getbool bb
+	long long lv2_address;
+getbool:
+	lv2 = getBool();
+	goto *ret1;
+	void* ret3;		// Return address of getinteger
+	int lv4;		// getinteger ii
+	long long lv4_address;
+getinteger:
+	lv4 = getInteger();
+	goto *ret3;
+	void* ret5;		// Return address of getfloat
+	double lv6;		// getfloat ff
+	long long lv6_address;
+getfloat:
+	lv6 = getFloat();
+	goto *ret5;
+	void* ret7;		// Return address of getstring
+	long long lv8;		// getstring ss
+	long long lv8_address;
+getstring:
+	lv8 = (long long)getString();
+	goto *ret7;
+	void* ret9;		// Return address of putbool
+	bool lv10;		// putbool b
+putbool:
+	putBool(lv10);
+	goto *ret9;
+	void* ret11;		// Return address of putinteger
+	int lv12;		// putinteger i
+putinteger:
+	putInteger(lv12);
+	goto *ret11;
+	void* ret13;		// Return address of putfloat
+	double lv14;		// putfloat f
+putfloat:
+	putFloat(lv14);
+	goto *ret13;
+	void* ret15;		// Return address of putstring
+	long long lv16;		// putstring s
+putstring:
+	putString((char*)lv16);
+	goto *ret15;
+	static int v17;		// list_size
+	static int v18;		// k
+	void* ret19;		// Return address of increment
+	int lv20;		// increment num
+	long long lv20_address;
+increment:
+	Reg[0] = (long long)lv20 + 1;		// expression = operand1 op operand2
+	lv20 = Reg[0];		// assign parameter
+	goto *ret19;		// Return from leaf
+	double cse29;
+	double cse32;
+merge:
+	Reg[SP] = Reg[FP] - 144;		// Allocate the frame
+	MEM(int, Reg[FP] - 8) = (long long)MEM(int, Reg[FP] + 24);		// assign local variable
+	Reg[0] = (long long)MEM(int, Reg[FP] + 32) + 1;		// expression = operand1 op operand2
+	MEM(int, Reg[FP] - 16) = Reg[0];		// assign local variable
+	MEM(int, Reg[FP] - 24) = (long long)MEM(int, Reg[FP] + 24);		// assign local variable
+	{		// Loop invariants
+	long long iv23;
+	long long inv24;
+	long long inv25;
+	long long inv26;
+	long long ptr33;
+	long long inv34;
+	long long inv35;
+	iv23 = MEM(int, Reg[FP] - 24);		// Induction variable
+	inv24 = (long long)MEM(int, Reg[FP] + 32);		// Loop invariant
+	inv25 = (long long)MEM(int, Reg[FP] + 40);		// Loop invariant
+	inv26 = (MEM(long long, Reg[FP] + 16));		// Loop invariant
+	Reg[0] = iv23 * 8;		// expression = operand1 op operand2
+	Reg[0] = (((Reg[FP] - 81) & -64)) + Reg[0];		// expression = operand1 op operand2
+	ptr33 = Reg[0];		// Address stepped by the loop
+	inv34 = (Reg[FP] - 8);		// Loop invariant
+	inv35 = (Reg[FP] - 16);		// Loop invariant
+	if (!((long long)MEM(int, Reg[FP] - 8) <= inv24)) goto endloop1;
+	if (!((long long)MEM(int, Reg[FP] - 16) <= inv25)) goto endloop1;
+loop1:
+	Reg[0] = (long long)MEM(int, Reg[FP] - 8) * 8;		// expression = operand1 op operand2
+	Reg[0] = inv26 + Reg[0];		// expression = operand1 op operand2
+	*((double*)&Reg[0]) = MEM(double, Reg[0]);		// Get array operand
+	cse29 = *((double*)&Reg[0]);		// Value used again
+	Reg[1] = (long long)MEM(int, Reg[FP] - 16) * 8;		// expression = operand1 op operand2
+	Reg[1] = inv26 + Reg[1];		// expression = operand1 op operand2
+	*((double*)&Reg[1]) = MEM(double, Reg[1]);		// Get array operand
+	cse32 = *((double*)&Reg[1]);		// Value used again
+	if (!(*((double*)&Reg[0]) <= *((double*)&Reg[1]))) goto else2;
+	MEM(double, ptr33) = cse29;		// temp + offset = expression
+	Reg[0] = inv34;		// operand
+	Reg[1] = MEM(int, Reg[0]);		// Value of out argument
+	lv20 = Reg[1];		// Pass argument
+	lv20_address = Reg[0];
+	ret19 = &&postincrement3;
+	goto increment;		// jump to leaf procedure
+postincrement3:
+	MEM(int, lv20_address) = lv20;		// Store out argument
+	goto next4;
+else2:
+	MEM(double, ptr33) = cse32;		// temp + offset = expression
+	Reg[0] = inv35;		// operand
+	Reg[1] = MEM(int, Reg[0]);		// Value of out argument
+	lv20 = Reg[1];		// Pass argument
+	lv20_address = Reg[0];
+	ret19 = &&postincrement5;
+	goto increment;		// jump to leaf procedure
+postincrement5:
+	MEM(int, lv20_address) = lv20;		// Store out argument
+next4:
+	Reg[0] = iv23 + 1;		// expression = operand1 op operand2
+	iv23 = Reg[0];		// assign local variable
+	ptr33 = ptr33 + 8;
+	if (!((long long)MEM(int, Reg[FP] - 8) <= inv24)) goto skip6;
+	if (((long long)MEM(int, Reg[FP] - 16) <= inv25)) goto loop1;
+skip6:
+endloop1:
+	;
+	MEM(int, Reg[FP] - 24) = iv23;
+	}
+	if (!((long long)MEM(int, Reg[FP] - 8) > (long long)MEM(int, Reg[FP] + 32))) goto else7;
+	v18 = (long long)MEM(int, Reg[FP] - 16);		// assign local variable
+	{		// Loop invariants
+	long long iv36;
+	long long inv37;
+	long long ptr38;
+	long long inv39;
+	long long inv43;
+	iv36 = v18;		// Induction variable
+	inv37 = (long long)MEM(int, Reg[FP] + 40);		// Loop invariant
+	Reg[0] = iv36 * 8;		// expression = operand1 op operand2
+	Reg[0] = (MEM(long long, Reg[FP] + 16)) + Reg[0];		// expression = operand1 op operand2
+	ptr38 = Reg[0];		// Address stepped by the loop
+	inv39 = (((Reg[FP] - 81) & -64));		// Loop invariant
+	inv43 = (Reg[FP] - 24);		// Loop invariant
+	if (iv36 <= inv37) {
+	do {
+	Reg[0] = (long long)MEM(int, Reg[FP] - 24) * 8;		// expression = operand1 op operand2
+	Reg[0] = inv39 + Reg[0];		// expression = operand1 op operand2
+	Reg[1] = ptr38;		// operand
+	*((double*)&Reg[1]) = MEM(double, Reg[1]);		// Get array operand
+	MEM(double, Reg[0]) = *((double*)&Reg[1]);		// temp + offset = expression
+	Reg[0] = inv43;		// operand
+	Reg[1] = MEM(int, Reg[0]);		// Value of out argument
+	lv20 = Reg[1];		// Pass argument
+	lv20_address = Reg[0];
+	ret19 = &&postincrement8;
+	goto increment;		// jump to leaf procedure
+postincrement8:
+	MEM(int, lv20_address) = lv20;		// Store out argument
+	Reg[0] = iv36 + 1;		// expression = operand1 op operand2
+	iv36 = Reg[0];		// assign local variable
+	ptr38 = ptr38 + 8;
+	} while (iv36 <= inv37);
+	}
+	v18 = iv36;
+	}
+	goto next9;
+else7:
+	v18 = (long long)MEM(int, Reg[FP] - 8);		// assign local variable
+	{		// Loop invariants
+	long long iv44;
+	long long inv45;
+	long long ptr46;
+	long long inv47;
+	long long inv51;
+	iv44 = v18;		// Induction variable
+	inv45 = (long long)MEM(int, Reg[FP] + 32);		// Loop invariant
+	Reg[0] = iv44 * 8;		// expression = operand1 op operand2
+	Reg[0] = (MEM(long long, Reg[FP] + 16)) + Reg[0];		// expression = operand1 op operand2
+	ptr46 = Reg[0];		// Address stepped by the loop
+	inv47 = (((Reg[FP] - 81) & -64));		// Loop invariant
+	inv51 = (Reg[FP] - 24);		// Loop invariant
+	if (iv44 <= inv45) {
+	do {
+	Reg[0] = (long long)MEM(int, Reg[FP] - 24) * 8;		// expression = operand1 op operand2
+	Reg[0] = inv47 + Reg[0];		// expression = operand1 op operand2
+	Reg[1] = ptr46;		// operand
+	*((double*)&Reg[1]) = MEM(double, Reg[1]);		// Get array operand
+	MEM(double, Reg[0]) = *((double*)&Reg[1]);		// temp + offset = expression
+	Reg[0] = inv51;		// operand
+	Reg[1] = MEM(int, Reg[0]);		// Value of out argument
+	lv20 = Reg[1];		// Pass argument
+	lv20_address = Reg[0];
+	ret19 = &&postincrement10;
+	goto increment;		// jump to leaf procedure
+postincrement10:
+	MEM(int, lv20_address) = lv20;		// Store out argument
+	Reg[0] = iv44 + 1;		// expression = operand1 op operand2
+	iv44 = Reg[0];		// assign local variable
+	ptr46 = ptr46 + 8;
+	} while (iv44 <= inv45);
+	}
+	v18 = iv44;
+	}
+next9:
+	v18 = (long long)MEM(int, Reg[FP] + 24);		// assign local variable
+	{		// Loop invariants
+	long long iv52;
+	long long inv53;
+	long long ptr54;
+	long long ptr55;
+	iv52 = v18;		// Induction variable
+	inv53 = (long long)MEM(int, Reg[FP] + 40);		// Loop invariant
+	Reg[0] = iv52 * 8;		// expression = operand1 op operand2
+	Reg[0] = (((Reg[FP] - 81) & -64)) + Reg[0];		// expression = operand1 op operand2
+	ptr54 = Reg[0];		// Address stepped by the loop
+	Reg[0] = iv52 * 8;		// expression = operand1 op operand2
+	Reg[0] = (MEM(long long, Reg[FP] + 16)) + Reg[0];		// expression = operand1 op operand2
+	ptr55 = Reg[0];		// Address stepped by the loop
+	if (iv52 <= inv53) {
+	do {
+	Reg[0] = ptr54;		// operand
+	*((double*)&Reg[0]) = MEM(double, Reg[0]);		// Get array operand
+	MEM(double, ptr55) = *((double*)&Reg[0]);		// list + offset = expression
+	Reg[0] = iv52 + 1;		// expression = operand1 op operand2
+	iv52 = Reg[0];		// assign local variable
+	ptr54 = ptr54 + 8;
+	ptr55 = ptr55 + 8;
+	} while (iv52 <= inv53);
+	}
+	v18 = iv52;
+	}
+	Reg[SP] = Reg[FP];		// Free local variables
+	Reg[FP] = MEM(long long, Reg[FP]);		// Restore Frame pointer
+	Reg[SP] = Reg[SP] + 8;		// Free space for FP
+	Reg[0] = MEM(long long, Reg[SP]);		// Pop return address off the stack
+	Reg[SP] = Reg[SP] + 8;		// Free return address space
+	goto *(void*)Reg[0];		// Return
+merge_sort:
+	Reg[SP] = Reg[FP] - 8;		// Allocate the frame
+	if (!((long long)MEM(int, Reg[FP] + 24) < (long long)MEM(int, Reg[FP] + 32))) goto else11;
+	Reg[0] = (long long)MEM(int, Reg[FP] + 24) + (long long)MEM(int, Reg[FP] + 32);		// expression = operand1 op operand2
+	Reg[0] = Reg[0] / 2;		// expression = operand1 op operand2
+	MEM(int, Reg[FP] - 8) = Reg[0];		// assign local variable
+	Reg[0] = (MEM(long long, Reg[FP] + 16));		// operand
+	Reg[1] = (long long)MEM(int, Reg[FP] + 24);		// operand
+	Reg[2] = (long long)MEM(int, Reg[FP] - 8);		// operand
+	Reg[SP] = Reg[SP] - 8;		// Make space on stack for argument
+	MEM(int, Reg[SP]) = Reg[2];		// Move argument to stack
+	Reg[SP] = Reg[SP] - 8;		// Make space on stack for argument
+	MEM(int, Reg[SP]) = Reg[1];		// Move argument to stack
+	Reg[SP] = Reg[SP] - 8;
+	MEM(long long, Reg[SP]) = Reg[0];		// Pass array by reference
+	Reg[SP] = Reg[SP] - 8;		// Allocate space for return address
+	Reg[0] = (long long)&&postmerge_sort12;
+	MEM(long long, Reg[SP]) = Reg[0];		// save return address
+	Reg[SP] = Reg[SP] - 8;		// Allocate space for FP
+	MEM(long long, Reg[SP]) = Reg[FP];		// Save frame pointer
+	Reg[FP] = Reg[SP];		// Move frame pointer to new position
+	goto merge_sort;		// jump to procedure
+postmerge_sort12:
+	Reg[SP] = Reg[SP] + 8;		// Free array reference
+	Reg[SP] = Reg[SP] + 8;		// Free input parameter
+	Reg[SP] = Reg[SP] + 8;		// Free input parameter
+	Reg[0] = (MEM(long long, Reg[FP] + 16));		// operand
+	Reg[1] = (long long)MEM(int, Reg[FP] - 8) + 1;		// expression = operand1 op operand2
+	Reg[2] = (long long)MEM(int, Reg[FP] + 32);		// operand
+	Reg[SP] = Reg[SP] - 8;		// Make space on stack for argument
+	MEM(int, Reg[SP]) = Reg[2];		// Move argument to stack
+	Reg[SP] = Reg[SP] - 8;		// Make space on stack for argument
+	MEM(int, Reg[SP]) = Reg[1];		// Move argument to stack
+	Reg[SP] = Reg[SP] - 8;
+	MEM(long long, Reg[SP]) = Reg[0];		// Pass array by reference
+	Reg[SP] = Reg[SP] - 8;		// Allocate space for return address
+	Reg[0] = (long long)&&postmerge_sort13;
+	MEM(long long, Reg[SP]) = Reg[0];		// save return address
+	Reg[SP] = Reg[SP] - 8;		// Allocate space for FP
+	MEM(long long, Reg[SP]) = Reg[FP];		// Save frame pointer
+	Reg[FP] = Reg[SP];		// Move frame pointer to new position
+	goto merge_sort;		// jump to procedure
+postmerge_sort13:
+	Reg[SP] = Reg[SP] + 8;		// Free array reference
+	Reg[SP] = Reg[SP] + 8;		// Free input parameter
+	Reg[SP] = Reg[SP] + 8;		// Free input parameter
+	Reg[0] = (MEM(long long, Reg[FP] + 16));		// operand
+	Reg[1] = (long long)MEM(int, Reg[FP] + 24);		// operand
+	Reg[2] = (long long)MEM(int, Reg[FP] - 8);		// operand
+	Reg[3] = (long long)MEM(int, Reg[FP] + 32);		// operand
+	Reg[SP] = Reg[SP] - 8;		// Make space on stack for argument
+	MEM(int, Reg[SP]) = Reg[3];		// Move argument to stack
+	Reg[SP] = Reg[SP] - 8;		// Make space on stack for argument
+	MEM(int, Reg[SP]) = Reg[2];		// Move argument to stack
+	Reg[SP] = Reg[SP] - 8;		// Make space on stack for argument
+	MEM(int, Reg[SP]) = Reg[1];		// Move argument to stack
+	Reg[SP] = Reg[SP] - 8;
+	MEM(long long, Reg[SP]) = Reg[0];		// Pass array by reference
+	Reg[SP] = Reg[SP] - 8;		// Allocate space for return address
+	Reg[0] = (long long)&&postmerge14;
+	MEM(long long, Reg[SP]) = Reg[0];		// save return address
+	Reg[SP] = Reg[SP] - 8;		// Allocate space for FP
+	MEM(long long, Reg[SP]) = Reg[FP];		// Save frame pointer
+	Reg[FP] = Reg[SP];		// Move frame pointer to new position
+	goto merge;		// jump to procedure
+postmerge14:
+	Reg[SP] = Reg[SP] + 8;		// Free array reference
+	Reg[SP] = Reg[SP] + 8;		// Free input parameter
+	Reg[SP] = Reg[SP] + 8;		// Free input parameter
+	Reg[SP] = Reg[SP] + 8;		// Free input parameter
+else11:
+	Reg[SP] = Reg[FP];		// Free local variables
+	Reg[FP] = MEM(long long, Reg[FP]);		// Restore Frame pointer
+	Reg[SP] = Reg[SP] + 8;		// Free space for FP
+	Reg[0] = MEM(long long, Reg[SP]);		// Pop return address off the stack
+	Reg[SP] = Reg[SP] + 8;		// Free return address space
+	goto *(void*)Reg[0];		// Return
+	static int v60;		// i
+printlist:
+	v60 = 0;		// assign local variable
+	{		// Loop invariants
+	long long iv61;
+	long long ptr62;
+	iv61 = v60;		// Induction variable
+	Reg[0] = iv61 * 8;		// expression = operand1 op operand2
+	Reg[0] = (MEM(long long, Reg[FP] + 16)) + Reg[0];		// expression = operand1 op operand2
+	ptr62 = Reg[0];		// Address stepped by the loop
+	if (iv61 < (long long)v17) {
+	do {
+	Reg[0] = ptr62;		// operand
+	*((double*)&Reg[0]) = MEM(double, Reg[0]);		// Get array operand
+	lv14 = *((double*)&Reg[0]);		// Pass argument
+	ret13 = &&postputfloat15;
+	goto putfloat;		// jump to leaf procedure
+postputfloat15:
+	Reg[0] = (long long)&MEM(char, 0);		// operand
+	lv16 = Reg[0];		// Pass argument
+	ret15 = &&postputstring16;
+	goto putstring;		// jump to leaf procedure
+postputstring16:
+	Reg[0] = iv61 + 1;		// expression = operand1 op operand2
+	iv61 = Reg[0];		// assign local variable
+	ptr62 = ptr62 + 8;
+	} while (iv61 < (long long)v17);
+	}
+	v60 = iv61;
+	}
+	Reg[0] = (long long)&MEM(char, 3);		// operand
+	lv16 = Reg[0];		// Pass argument
+	ret15 = &&postputstring17;
+	goto putstring;		// jump to leaf procedure
+postputstring17:
+	Reg[SP] = Reg[FP];		// Free local variables
+	Reg[FP] = MEM(long long, Reg[FP]);		// Restore Frame pointer
+	Reg[SP] = Reg[SP] + 8;		// Free space for FP
+	Reg[0] = MEM(long long, Reg[SP]);		// Pop return address off the stack
+	Reg[SP] = Reg[SP] + 8;		// Free return address space
+	goto *(void*)Reg[0];		// Return
+	static int v64;		// i
+getlist:
+	Reg[SP] = Reg[FP] - 8;		// Allocate the frame
+	v64 = 0;		// assign local variable
+	{		// Loop invariants
+	long long iv65;
+	long long inv66;
+	long long ptr67;
+	iv65 = v64;		// Induction variable
+	inv66 = (Reg[FP] - 8);		// Loop invariant
+	Reg[0] = iv65 * 8;		// expression = operand1 op operand2
+	Reg[0] = (MEM(long long, Reg[FP] + 16)) + Reg[0];		// expression = operand1 op operand2
+	ptr67 = Reg[0];		// Address stepped by the loop
+	if (iv65 < (long long)v17) {
+	do {
+	Reg[0] = (long long)&MEM(char, 6);		// operand
+	lv16 = Reg[0];		// Pass argument
+	ret15 = &&postputstring18;
+	goto putstring;		// jump to leaf procedure
+postputstring18:
+	Reg[0] = iv65;		// operand
+	lv12 = Reg[0];		// Pass argument
+	ret11 = &&postputinteger19;
+	goto putinteger;		// jump to leaf procedure
+postputinteger19:
+	Reg[0] = (long long)&MEM(char, 13);		// operand
+	lv16 = Reg[0];		// Pass argument
+	ret15 = &&postputstring20;
+	goto putstring;		// jump to leaf procedure
+postputstring20:
+	Reg[0] = inv66;		// operand
+	*((double*)&Reg[1]) = MEM(double, Reg[0]);		// Value of out argument
+	lv6 = *((double*)&Reg[1]);		// Pass argument
+	lv6_address = Reg[0];
+	ret5 = &&postgetfloat21;
+	goto getfloat;		// jump to leaf procedure
+postgetfloat21:
+	MEM(double, lv6_address) = lv6;		// Store out argument
+	MEM(double, ptr67) = MEM(double, Reg[FP] - 8);		// list + offset = expression
+	Reg[0] = iv65 + 1;		// expression = operand1 op operand2
+	iv65 = Reg[0];		// assign local variable
+	ptr67 = ptr67 + 8;
+	} while (iv65 < (long long)v17);
+	}
+	v64 = iv65;
+	}
+	Reg[SP] = Reg[FP];		// Free local variables
+	Reg[FP] = MEM(long long, Reg[FP]);		// Restore Frame pointer
+	Reg[SP] = Reg[SP] + 8;		// Free space for FP
+	Reg[0] = MEM(long long, Reg[SP]);		// Pop return address off the stack
+	Reg[SP] = Reg[SP] + 8;		// Free return address space
+	goto *(void*)Reg[0];		// Return
+start:
+	init(static_data());		// Static memory is only known once the whole program is parsed
+	Reg[SP] = Reg[FP] - 120;		// Allocate the frame
+	v17 = 8;		// assign static
+	Reg[0] = (((Reg[FP] - 57) & -64));		// operand
+	Reg[SP] = Reg[SP] - 8;
+	MEM(long long, Reg[SP]) = Reg[0];		// Pass array by reference
+	Reg[SP] = Reg[SP] - 8;		// Allocate space for return address
+	Reg[0] = (long long)&&postgetlist22;
+	MEM(long long, Reg[SP]) = Reg[0];		// save return address
+	Reg[SP] = Reg[SP] - 8;		// Allocate space for FP
+	MEM(long long, Reg[SP]) = Reg[FP];		// Save frame pointer
+	Reg[FP] = Reg[SP];		// Move frame pointer to new position
+	goto getlist;		// jump to procedure
+postgetlist22:
+	Reg[SP] = Reg[SP] + 8;		// Free array reference
+	Reg[0] = (((Reg[FP] - 57) & -64));		// operand
+	Reg[SP] = Reg[SP] - 8;
+	MEM(long long, Reg[SP]) = Reg[0];		// Pass array by reference
+	Reg[SP] = Reg[SP] - 8;		// Allocate space for return address
+	Reg[0] = (long long)&&postprintlist23;
+	MEM(long long, Reg[SP]) = Reg[0];		// save return address
+	Reg[SP] = Reg[SP] - 8;		// Allocate space for FP
+	MEM(long long, Reg[SP]) = Reg[FP];		// Save frame pointer
+	Reg[FP] = Reg[SP];		// Move frame pointer to new position
+	goto printlist;		// jump to procedure
+postprintlist23:
+	Reg[SP] = Reg[SP] + 8;		// Free array reference
+	Reg[0] = (((Reg[FP] - 57) & -64));		// operand
+	Reg[1] = 0;		// operand
+	Reg[2] = (long long)v17 - 1;		// expression = operand1 op operand2
+	Reg[SP] = Reg[SP] - 8;		// Make space on stack for argument
+	MEM(int, Reg[SP]) = Reg[2];		// Move argument to stack
+	Reg[SP] = Reg[SP] - 8;		// Make space on stack for argument
+	MEM(int, Reg[SP]) = Reg[1];		// Move argument to stack
+	Reg[SP] = Reg[SP] - 8;
+	MEM(long long, Reg[SP]) = Reg[0];		// Pass array by reference
+	Reg[SP] = Reg[SP] - 8;		// Allocate space for return address
+	Reg[0] = (long long)&&postmerge_sort24;
+	MEM(long long, Reg[SP]) = Reg[0];		// save return address
+	Reg[SP] = Reg[SP] - 8;		// Allocate space for FP
+	MEM(long long, Reg[SP]) = Reg[FP];		// Save frame pointer
+	Reg[FP] = Reg[SP];		// Move frame pointer to new position
+	goto merge_sort;		// jump to procedure
+postmerge_sort24:
+	Reg[SP] = Reg[SP] + 8;		// Free array reference
+	Reg[SP] = Reg[SP] + 8;		// Free input parameter
+	Reg[SP] = Reg[SP] + 8;		// Free input parameter
+	Reg[0] = (((Reg[FP] - 57) & -64));		// operand
+	Reg[SP] = Reg[SP] - 8;
+	MEM(long long, Reg[SP]) = Reg[0];		// Pass array by reference
+	Reg[SP] = Reg[SP] - 8;		// Allocate space for return address
+	Reg[0] = (long long)&&postprintlist25;
+	MEM(long long, Reg[SP]) = Reg[0];		// save return address
+	Reg[SP] = Reg[SP] - 8;		// Allocate space for FP
+	MEM(long long, Reg[SP]) = Reg[FP];		// Save frame pointer
+	Reg[FP] = Reg[SP];		// Move frame pointer to new position
+	goto printlist;		// jump to procedure
+postprintlist25:
+	Reg[SP] = Reg[SP] + 8;		// Free array reference
+	return 0;
+}
+
+long long static_data()
+{
+	strcpy(&MEM(char, 0), "  ");
+	strcpy(&MEM(char, 13), ": ");
+	strcpy(&MEM(char, 3), "\n");
+	strcpy(&MEM(char, 6), "index ");
+	return 16;
+}
@@ -1,12 +1,16 @@
+#include <fstream>
+#include <algorithm>
 #include "parser.h"
 #include "error.h"
+#include "interface.h"
 
-symbol_map_iterator Parser::map_iterator;
-std::stack <symbol_map*> Parser::symbol_table;
-symbol_map* Parser::global_symbol_map;
-symbol_map* Parser::outer_symbol_map;
+// Inlining cost model, measured in tokens of the callee's declarations and body
+static const unsigned int INLINE_SMALL_BODY = 60;         // About the size of the call sequence it replaces
+static const unsigned int INLINE_SINGLE_CALL_BODY = 600;  // Only one copy is made, so larger bodies are worth it
+static const unsigned int INLINE_MAX_DEPTH = 4;
 
-Parser::Parser(std::string filename)
+
+Parser::Parser(Compilation& compilation) : context(compilation)
 {    
   EOF_found = false;
   
@@ -16,11 +20,21 @@ Parser::Parser(std::string filename)
   // Push outer scope hash map into symbol table
   symbol_table.push(outer_symbol_map);
   // Create scanner
-  scanner = new Scanner(filename);
+  scanner = new Scanner(context);
   // Create generator
-  codegen = new Code_generator(filename);
+  codegen = new Code_generator(context);
 
   bad_out_param = false;
+  operand_count = 0;
+  named_operand = NULL;
+  
+  inline_procedures = true;
+  report_inlining = false;
+  recording = NULL;
+  size_t slash = context.filename.find_last_of('/');
+  if (slash != std::string::npos)
+    directory = context.filename.substr(0, slash + 1);
+  count_call_sites();
 }
    
 Parser::~Parser()
@@ -40,6 +54,7 @@ Parser::~Parser()
         sym = sym->next;
         delete temp;
       }
+      delete map_iterator->second->body;
       delete map_iterator->second;
     }
   }
@@ -58,6 +73,7 @@ Parser::~Parser()
           sym = sym->next;
           delete temp;
         }
+        delete map_iterator->second->body;
         delete map_iterator->second;
       }
     }
@@ -71,14 +87,19 @@ Parser::~Parser()
 void Parser::start()
 {
   try {
-    next_token = scanner->get_token(Scanner::input_file);
+    next_token = scan();
     program();
   }
   catch (Error& e) {
-    std::cerr << e.what();
+    report(e);
   }
 }
 
+void Parser::report(Error& e)
+{
+  context.diagnose(DIAGNOSTIC_ERROR, context.line_number, e.what());
+}
+
 void Parser::match(type_t t)
 {  
   if (next_token->type == t) {
@@ -90,7 +111,7 @@ void Parser::match(type_t t)
 	|| t == TOK_OPEN_PAREN || t == TOK_CLOSE_PAREN || t == TOK_CLOSE_BRACKET || t == TOK_ASSIGNMENT || t == TOK_COMMA)
     {
       try { throw SyntaxError("Unexpected token, ", t, next_token->type); }
-      catch (SyntaxError& e) { std::cerr << e.what();}
+      catch (SyntaxError& e) { report(e);}
     }
     else // Something else will catch this error and a sync token will be found 
       throw SyntaxError("Unexpected token, ", t, next_token->type);
@@ -105,10 +126,34 @@ void Parser::move()
   }
   else {
     delete next_token;
-    next_token = scanner->get_token(Scanner::input_file);
+    next_token = scan();
   }
 }
 
+Token* Parser::scan()
+{
+  if (!pending_tokens.empty()) {
+    Token* token = pending_tokens.front();
+    pending_tokens.pop_front();
+    if (token->line)
+      context.line_number = token->line;
+    return token;
+  }
+  Token* token = scanner->get_token(*scanner->input);
+  if (recording)
+    recording->push_back(*token);
+  return token;
+}
+
+void Parser::replay(std::vector<Token> &tokens)
+{
+  // Parse the tokens next, then carry on from the current token
+  pending_tokens.push_front(next_token);
+  for (unsigned int i = tokens.size(); i > 0; i--)
+    pending_tokens.push_front(new Token(tokens[i-1]));
+  next_token = scan();
+}
+
 void Parser::find(type_t type)
 {  
   while (true) {
@@ -117,43 +162,59 @@ void Parser::find(type_t type)
     else if (next_token->type == type)
       break;
     else
-      next_token = scanner->get_token(Scanner::input_file);
+      next_token = scan();
   }
 }
 
 void Parser::program()
 {
-  try { program_header(); }
-  catch (Error& e) { std::cerr << e.what(); std::cout << "Fatal error, compilation terminated\n"; exit(1); }
+  try {
+    imports();
+    if (next_token->type == RESERVED_MODULE)
+      module_header();
+    else
+      program_header();
+  }
+  catch (Error& e) { report(e); context.output << "Fatal error, compilation terminated\n"; context.fatal = true; return; }
 
-  codegen->main_runtime();
+  std::vector<Symbol*> runtime;
+  codegen->main_runtime(runtime);
+  for (unsigned int i = 0; i < runtime.size(); i++)
+    add_to_symbol_table(runtime[i]);
 
-  try { program_body(); }
-  catch (Error& e) { std::cerr << e.what(); std::cout << "Compilation terminated\n"; find(TOK_EOF); exit(1);}
+  try {
+    if (module_name.empty())
+      program_body();
+    else
+      module_body();
+  }
+  catch (Error& e) { report(e); context.output << "Compilation terminated\n"; find(TOK_EOF); context.fatal = true; return; }
   
-  for (map_iterator = global_symbol_map->begin(); map_iterator != global_symbol_map->end(); map_iterator++) {
+  // What a module declares is used and set by the programs that import it
+  for (map_iterator = global_symbol_map->begin(); map_iterator != global_symbol_map->end() && module_name.empty(); map_iterator++) {
     if (!map_iterator->second->used && map_iterator->second->id_type == ID_VARIABLE)
-      Scanner::report_warning("Line "+std::to_string(map_iterator->second->line_declared)+": Unused variable '"+map_iterator->second->name+"'\n");
+      scanner->report_warning(map_iterator->second->line_declared, "Unused variable '"+map_iterator->second->name+"'\n");
     if (!map_iterator->second->initialized && map_iterator->second->id_type == ID_VARIABLE)
-      Scanner::report_warning("Line "+std::to_string(map_iterator->second->line_declared)+": Uninitialized variable '"+map_iterator->second->name+"'\n");
+      scanner->report_warning(map_iterator->second->line_declared, "Uninitialized variable '"+map_iterator->second->name+"'\n");
   }
   
   for (map_iterator = outer_symbol_map->begin(); map_iterator != outer_symbol_map->end(); map_iterator++) {
     if (!map_iterator->second->used && map_iterator->second->id_type == ID_VARIABLE)
-      Scanner::report_warning("Line "+std::to_string(map_iterator->second->line_declared)+": Unused variable '"+map_iterator->second->name+"'\n");
+      scanner->report_warning(map_iterator->second->line_declared, "Unused variable '"+map_iterator->second->name+"'\n");
     if (!map_iterator->second->initialized && map_iterator->second->id_type == ID_VARIABLE)
-      Scanner::report_warning("Line "+std::to_string(map_iterator->second->line_declared)+": Uninitialized variable '"+map_iterator->second->name+"'\n");
+      scanner->report_warning(map_iterator->second->line_declared, "Uninitialized variable '"+map_iterator->second->name+"'\n");
   }
     
   codegen->exit();
-  
+  if (!module_name.empty() && !context.num_errors && !context.code)
+    write_interface();
 }
 
 void Parser::program_header()
 {
   match(RESERVED_PROGRAM);
   try { identifier(); }
-  catch (Error& e){ std::cerr << e.what(); find(RESERVED_IS); }
+  catch (Error& e){ report(e); find(RESERVED_IS); }
   match(RESERVED_IS);
 }
 
@@ -164,30 +225,198 @@ void Parser::program_body()
       || type == RESERVED_FLOAT || type == RESERVED_BOOL || type == RESERVED_STRING ) {
     
     codegen->enter_procedure();
+    codegen->enter_frame();
       
     try { declarations_(); }
-    catch (Error& e) { std::cerr << e.what() ; find(RESERVED_BEGIN); }
+    catch (Error& e) { report(e); find(RESERVED_BEGIN); }
     match(RESERVED_BEGIN);
 
-    if (!Scanner::num_errors) {
+    if (!context.num_errors) {
       codegen->start();
       codegen->emit_procedure();
     }
 
     codegen->enter_procedure();
+    codegen->frame_prologue();
 
+    trailing_calls.clear();
     try { statements_(); }
-    catch (Error& e) { std::cerr << e.what(); find(RESERVED_END); }
+    catch (Error& e) { report(e); find(RESERVED_END); }
     match(RESERVED_END);
     match(RESERVED_PROGRAM);
 
-    if (!Scanner::num_errors)
+    codegen->exit_frame();
+    if (!context.num_errors)
       codegen->emit_procedure();
     
     match(TOK_EOF);
   }
 }
 
+void Parser::imports()
+{
+  while (next_token->type == RESERVED_IMPORT) {
+    match(RESERVED_IMPORT);
+    std::string name = identifier();
+    if (name.empty())
+      throw SyntaxError("A module name is expected after import.", ZERO, ZERO);
+    match(TOK_SEMICOLON);
+    import_module(name, true);
+  }
+}
+
+// Maps the interface a compiled module exports, the modules it imports are linked and set up first but their names stay hidden
+void Parser::import_module(std::string name, bool visible)
+{
+  std::map<std::string, bool>::iterator it = imported.find(name);
+  if (it != imported.end() && (it->second || !visible))
+    return;
+  bool registered = it != imported.end();
+  imported[name] = visible;
+  
+  Interface_file file;
+  if (!file.open(directory + name + ".interface") || name != file.name(file.header->module))
+    throw Error("No interface for module '" + name + "', compile " + directory + name + ".src first\n");
+  uint64_t hash;
+  if (hash_file(directory + name + ".src", hash) && hash != file.header->source_hash)
+    throw Error("Interface of module '" + name + "' is out of date, compile " + directory + name + ".src again\n");
+  
+  Symbol* procedure = NULL;
+  Symbol* last = NULL;
+  for (uint32_t i = 0; i < file.header->count; i++) {
+    const Interface_record& record = file.records[i];
+    switch (record.kind) {
+      case INTERFACE_IMPORT:
+        if (!registered)
+          import_module(file.name(record.name), false);
+        break;
+      case INTERFACE_PROCEDURE:
+        procedure = last = NULL;
+        if (!visible)
+          break;
+        procedure = new Symbol(file.name(record.name), true);
+        procedure->module = "module_" + name;
+        procedure->address = record.address;
+        procedure->used = procedure->initialized = true;
+        add_to_symbol_table(procedure);
+        break;
+      case INTERFACE_PARAM:
+        if (procedure) {
+          Symbol* param = new Symbol(file.name(record.name), record.array, (type_t)record.type, record.array_size);
+          param->set_element_size(record.size);
+          param->direction = (direction_t)record.direction;
+          if (last)
+            last->next = param;
+          else
+            procedure->params = param;
+          last = param;
+        }
+        break;
+      case INTERFACE_GLOBAL:
+        procedure = last = NULL;
+        if (!visible)
+          break;
+        Symbol* global = new Symbol(file.name(record.name), true, record.array, (type_t)record.type, record.array_size);
+        global->set_element_size(record.size);
+        global->module = "module_" + name;
+        global->address = record.address;
+        global->used = global->initialized = true;
+        add_to_symbol_table(global);
+        break;
+    }
+  }
+  if (!registered)
+    codegen->import(name, directory + name + ".o");
+}
+
+void Parser::module_header()
+{
+  match(RESERVED_MODULE);
+  module_name = identifier();
+  if (module_name.empty())
+    throw SyntaxError("A module name is expected.", ZERO, ZERO);
+  
+  // Other modules find its interface and object by its name
+  std::string file = context.filename.substr(directory.size());
+  if (context.filename != "<memory>" && file.substr(0, file.find_last_of('.')) != module_name) {
+    Error e("Module '" + module_name + "' must be in a file named " + module_name + ".src\n");
+    report(e);
+  }
+  codegen->module(module_name);
+  match(RESERVED_IS);
+}
+
+// A module only declares, what it declares at its top level is global and can be used by the programs importing it
+void Parser::module_body()
+{
+  codegen->enter_procedure();
+  codegen->enter_frame();
+  
+  try { declarations_(); }
+  catch (Error& e) { report(e); find(RESERVED_END); }
+  match(RESERVED_END);
+  match(RESERVED_MODULE);
+  
+  codegen->exit_frame();
+  if (!context.num_errors)
+    codegen->emit_procedure();
+  
+  match(TOK_EOF);
+}
+
+// Names then records, which are what other files read about the module
+static void add_record(std::vector<Interface_record> &records, std::string& names, interface_kind_t kind, Symbol* sym, std::string name)
+{
+  Interface_record record;
+  memset(&record, 0, sizeof(record));
+  record.kind = kind;
+  record.name = names.size();
+  names += name + '\0';
+  if (sym) {
+    record.type = sym->symbol_type.type();
+    record.size = sym->symbol_type.size();
+    record.array_size = sym->symbol_type.arraysize();
+    record.address = sym->address;
+    record.array = sym->symbol_type.array();
+    record.direction = sym->direction;
+  }
+  records.push_back(record);
+}
+
+// Written next to the source, mapped by every file that imports the module
+void Parser::write_interface()
+{
+  std::vector<Symbol*> globals;
+  for (map_iterator = global_symbol_map->begin(); map_iterator != global_symbol_map->end(); map_iterator++) {
+    if (map_iterator->second->id_type == ID_VARIABLE && map_iterator->second->module == "module_" + module_name)
+      globals.push_back(map_iterator->second);
+  }
+  std::sort(globals.begin(), globals.end(), [](Symbol* a, Symbol* b) { return a->address < b->address; });
+  
+  Interface_header header;
+  memset(&header, 0, sizeof(header));
+  if (context.source)
+    header.source_hash = hash_bytes(*context.source);
+  else
+    hash_file(context.filename, header.source_hash);
+  header.options = (inline_procedures ? INTERFACE_INLINE : 0) | (context.lto ? INTERFACE_LTO : 0);
+  
+  std::vector<Interface_record> records;
+  std::string names = module_name + '\0';
+  for (std::map<std::string, bool>::iterator it = imported.begin(); it != imported.end(); it++)
+    add_record(records, names, INTERFACE_IMPORT, NULL, it->first);
+  for (unsigned int i = 0; i < exported.size(); i++) {
+    add_record(records, names, INTERFACE_PROCEDURE, exported[i], exported[i]->name);
+    for (Symbol* param = exported[i]->params; param != NULL; param = param->next)
+      add_record(records, names, INTERFACE_PARAM, param, param->name);
+  }
+  for (unsigned int i = 0; i < globals.size(); i++)
+    add_record(records, names, INTERFACE_GLOBAL, globals[i], globals[i]->name);
+  
+  if (!save_interface(directory + module_name + ".interface", header, records, names))
+    scanner->report_warning(context.line_number, "Could not write the interface of module '" + module_name + "'\n");
+}
+
 void Parser::declarations_()
 {
   while (true) {
@@ -196,7 +425,7 @@ void Parser::declarations_()
 	|| type == RESERVED_BOOL || type == RESERVED_FLOAT || type == RESERVED_STRING)
     {
       try { declaration(); }
-      catch (Error& e) { std::cerr << e.what(); find(TOK_SEMICOLON); }
+      catch (Error& e) { report(e); find(TOK_SEMICOLON); }
       match(TOK_SEMICOLON);
       continue;
     }
@@ -207,25 +436,33 @@ void Parser::declarations_()
 
 void Parser::statements()
 {
+  trailing_calls.clear();
   try { statement(); }
-  catch (Error& e) { std::cerr << e.what(); find(TOK_SEMICOLON); }
+  catch (Error& e) { report(e); find(TOK_SEMICOLON); }
   match(TOK_SEMICOLON);
   statements_();
 }
 
 void Parser::statements_()
 {
+  // Self calls ending the statements parsed so far, in tail position if nothing runs after this block
+  std::vector<int> trailing = trailing_calls;
   while (true) {
     type_t type = next_token->type;
-    if (type == TOK_IDENTIFIER || type == RESERVED_IF || type == RESERVED_FOR || type == RESERVED_RETURN) {
+    if (type == TOK_IDENTIFIER || type == RESERVED_IF || type == RESERVED_FOR || type == RESERVED_CASE || type == RESERVED_RETURN) {
+      if (type == RESERVED_RETURN)
+        mark_tail_calls(trailing);
+      trailing_calls.clear();
       try { statement(); }
-      catch (Error& e) { std::cerr << e.what(); find(TOK_SEMICOLON); }
+      catch (Error& e) { report(e); find(TOK_SEMICOLON); }
       match(TOK_SEMICOLON);
+      trailing = trailing_calls;
       continue;
     }
     else
       break;	// e production
   }
+  trailing_calls = trailing;
 }
 
 void Parser::declaration()
@@ -233,11 +470,13 @@ void Parser::declaration()
   type_t type = next_token->type;
   if (type == RESERVED_GLOBAL) {
     match(RESERVED_GLOBAL); 
+    if (!procedure_stack.empty() && procedure_stack.top())
+      procedure_stack.top()->body->not_inlinable = "declares global variables";
     declaration_(true);
   }
   else if (type == RESERVED_PROCEDURE || type == RESERVED_INT || type == RESERVED_FLOAT
 	    || type == RESERVED_STRING || type == RESERVED_BOOL) {
-    declaration_(false);
+    declaration_(!module_name.empty() && procedure_stack.empty());
   }
   else { // error, not allowed
       throw SyntaxError("A declaration is expected.", ZERO, ZERO);
@@ -260,17 +499,24 @@ void Parser::declaration_(bool global)
 
 void Parser::procedure_declaration(bool global, id_type_t idt)
 {
+  int enclosing_fp_address = codegen->get_fp_address();
   codegen->reset_fp_address();
   std::string name = procedure_header(global, idt);
   
   codegen->enter_procedure();
   codegen->label(name, -1);
+  codegen->enter_frame();
+  codegen->frame_prologue();
 
   codegen->reset_fp_address();
   procedure_body(name);
   
-  if (!Scanner::num_errors)
+  codegen->exit_frame();
+  if (!context.num_errors)
     codegen->emit_procedure();
+  codegen->restore_fp_address(enclosing_fp_address);
+  if (procedure_stack.empty())
+    codegen->leave_shard();
 }
 
 std::string Parser::procedure_header(bool global, id_type_t idt)
@@ -280,16 +526,35 @@ std::string Parser::procedure_header(bool global, id_type_t idt)
   
   std::string id;
   try { id = identifier(); }
-  catch (Error& e) { std::cerr << e.what(); find(TOK_OPEN_PAREN); }
+  catch (Error& e) { report(e); find(TOK_OPEN_PAREN); }
   
   // Create symbol for procedure if valid id
   if (!id.empty()) {
     new_symbol = new Symbol(id, global);
+    new_symbol->body = new Procedure_body;
+    new_symbol->body->call_sites = call_sites[id];
+    new_symbol->body->complete = false;
+    
+    // Top level procedures of a module or of a program split into shards are entered from other C functions
+    bool entry = false;
+    if (procedure_stack.empty())
+      entry = !module_name.empty() || codegen->shard_procedure(new_symbol);
+    if (!framed.count(id) && !entry)
+      codegen->leaf_procedure(new_symbol);
   }
   
-  // Add procedure to scope its declared in
+  // Nested procedures are only visible in the enclosing scope
+  if (!procedure_stack.empty() && procedure_stack.top() && procedure_stack.top()->body)
+    procedure_stack.top()->body->not_inlinable = "declares nested procedures";
+  
+  // Add procedure to scope its declared in, the top level procedures of a module are entered from other modules
   if (new_symbol)
     add_to_symbol_table(new_symbol);
+  if (new_symbol && !module_name.empty() && procedure_stack.empty()) {
+    codegen->export_procedure(new_symbol);
+    exported.push_back(new_symbol);
+  }
+  procedure_stack.push(new_symbol);
   
   match(TOK_OPEN_PAREN);
   
@@ -299,7 +564,7 @@ std::string Parser::procedure_header(bool global, id_type_t idt)
   
   Symbol* params;
   try { params = paramlist(); }
-  catch (Error& e) { std::cerr << e.what(); find(TOK_CLOSE_PAREN); }
+  catch (Error& e) { report(e); find(TOK_CLOSE_PAREN); }
   match(TOK_CLOSE_PAREN);
   
   // Add procedure to its own scope so it can be recursive if not global and add paramlist
@@ -350,7 +615,9 @@ Symbol* Parser::parameter()
     if (sym)
       sym->direction = inout();
     
-    if (sym->direction == DIRECTION_IN)
+    if (!procedure_stack.empty() && procedure_stack.top() && procedure_stack.top()->leaf)
+      codegen->leaf_variable(procedure_stack.top(), sym);
+    else if (sym->direction == DIRECTION_IN)
       codegen->stack_alloc_param(sym, true);
     else
       codegen->stack_alloc_param(sym, false);
@@ -376,26 +643,43 @@ direction_t Parser::inout()
 
 void Parser::procedure_body(std::string name)
 {
+  Symbol* procedure = procedure_stack.top();
+  if (procedure) { // Record the body so calls to it can be inlined
+    recording = &procedure->body->tokens;
+    recording->push_back(*next_token);
+  }
+  
   try { declarations_(); }
-  catch (Error& e) { std::cerr << e.what(); find(RESERVED_BEGIN); }
+  catch (Error& e) { report(e); find(RESERVED_BEGIN); }
   match(RESERVED_BEGIN);
   
+  trailing_calls.clear();
   try { statements_(); }
-  catch (Error& e) { std::cerr << e.what(); find(RESERVED_END); }
+  catch (Error& e) { report(e); find(RESERVED_END); }
+  
+  // Recording stops at 'end', a nested procedure will have stopped it earlier
+  if (procedure && recording == &procedure->body->tokens)
+    procedure->body->complete = true;
+  recording = NULL;
+  
   match(RESERVED_END);
   match(RESERVED_PROCEDURE);
   
-  codegen->callee_return(false);
+  // Self calls left trailing the body are followed only by the return
+  mark_tail_calls(trailing_calls);
+  procedure_stack.pop();
+  
+  codegen->callee_return(procedure);
   // Delete procedure scope now that we have found end of procedure
   for (map_iterator = symbol_table.top()->begin(); map_iterator != symbol_table.top()->end(); map_iterator++) {
     if (!map_iterator->second->used && map_iterator->second->id_type == ID_VARIABLE)
-      Scanner::report_warning("Line "+std::to_string(map_iterator->second->line_declared)+": Unused variable '"+map_iterator->second->name+"'\n");
+      scanner->report_warning(map_iterator->second->line_declared, "Unused variable '"+map_iterator->second->name+"'\n");
     if (!map_iterator->second->initialized && map_iterator->second->id_type == ID_VARIABLE)
-      Scanner::report_warning("Line "+std::to_string(map_iterator->second->line_declared)+": Uninitialized variable '"+map_iterator->second->name+"'\n");
+      scanner->report_warning(map_iterator->second->line_declared, "Uninitialized variable '"+map_iterator->second->name+"'\n");
     if (!map_iterator->second->used && map_iterator->second->id_type == ID_PARAMETER && map_iterator->second->direction == DIRECTION_IN)
-      Scanner::report_warning("Line "+std::to_string(map_iterator->second->line_declared)+": Unused 'in' parameter '"+map_iterator->second->name+"'\n");
+      scanner->report_warning(map_iterator->second->line_declared, "Unused 'in' parameter '"+map_iterator->second->name+"'\n");
     if (!map_iterator->second->initialized && map_iterator->second->id_type == ID_PARAMETER && map_iterator->second->direction == DIRECTION_OUT)
-      Scanner::report_warning("Line "+std::to_string(map_iterator->second->line_declared)+": Unitialized 'out' parameter '"+map_iterator->second->name+"'\n");
+      scanner->report_warning(map_iterator->second->line_declared, "Unitialized 'out' parameter '"+map_iterator->second->name+"'\n");
     
     map_iterator->second->ref_count--;
     if (map_iterator->second->id_type == ID_VARIABLE)
@@ -407,6 +691,7 @@ void Parser::procedure_body(std::string name)
         sym = sym->next;
         delete temp;
       }
+      delete map_iterator->second->body;
       delete map_iterator->second;
     }
   }
@@ -417,7 +702,8 @@ void Parser::procedure_body(std::string name)
 Symbol* Parser::variable_declaration(bool global, id_type_t idt)
 {
   // Get variable type and match
-  type_t var_type = typemark(); 
+  unsigned int size = 0;
+  type_t var_type = typemark(size); 
   
   // Get token for identifier and match
   std::string id = identifier();
@@ -431,18 +717,36 @@ Symbol* Parser::variable_declaration(bool global, id_type_t idt)
   if (!id.empty() && idt == ID_VARIABLE) {
     if (global) { // Static data
       new_symbol = new Symbol(id, global, is_array, var_type, array_size);
-      codegen->alloc_static(new_symbol);
-      new_symbol->line_declared = Scanner::line_number;
+      new_symbol->set_element_size(size);
+      if (!is_array && procedure_stack.empty() && module_name.empty() && !codegen->sharded() && !escaped.count("." + id))
+        codegen->promote(new_symbol);
+      else
+        codegen->alloc_static(new_symbol);
+      new_symbol->line_declared = context.line_number;
     }
     else { // Allocate space on stack, local data
       new_symbol = new Symbol(id, global, is_array, var_type, array_size);
-      codegen->stack_alloc_local(new_symbol);
-      new_symbol->line_declared = Scanner::line_number;
+      new_symbol->set_element_size(size);
+      if (!procedure_stack.empty() && procedure_stack.top() && procedure_stack.top()->leaf && !is_array)
+        codegen->leaf_variable(procedure_stack.top(), new_symbol);
+      else if (!procedure_stack.empty() && !procedure_stack.top()) // Inlined, its frame is freed after the call
+        codegen->stack_alloc_local(new_symbol);
+      else if (!is_array && promotable(id))
+        codegen->promote(new_symbol);
+      else {
+        std::string key = (procedure_stack.empty() ? "" : procedure_stack.top()->name) + "." + id;
+        std::pair<int, int> range(0, INT_MAX);
+        if (live_ranges.count(key) && !is_array && !read_first.count(key)) // Otherwise it would see what the slot held before
+          range = live_ranges[key];
+        codegen->frame_alloc_local(new_symbol, range.first, range.second);
+      }
+      new_symbol->line_declared = context.line_number;
     }
   }
   else if (!id.empty() && idt == ID_PARAMETER) {
     new_symbol = new Symbol(id, is_array, var_type, array_size);
-    new_symbol->line_declared = Scanner::line_number;
+    new_symbol->set_element_size(size);
+    new_symbol->line_declared = context.line_number;
   }
   
   // Add variable to current scope.
@@ -459,18 +763,21 @@ bool Parser::array_size_brackets(unsigned int &array_size)
     match(TOK_OPEN_BRACKET);
     // Array size must be an int, if not find bracket close
     try { array_size = arraysize(); }
-    catch (Error& e) { std::cerr << e.what(); find(TOK_CLOSE_BRACKET);}
+    catch (Error& e) { report(e); find(TOK_CLOSE_BRACKET);}
     match(TOK_CLOSE_BRACKET);
     return true;
   }
   return false;
 }
 
-type_t Parser::typemark()
+type_t Parser::typemark(unsigned int &size)
 {
   type_t type = next_token->type;
   type_t ret;
   if (type == RESERVED_INT) {
+    // integer is the natural size, int8 to int64 give the bits
+    if (next_token->string != "integer")
+      size = std::stoi(next_token->string.substr(3)) / 8;
     match(RESERVED_INT);
     ret = TYPE_INT;
   }
@@ -489,6 +796,8 @@ type_t Parser::typemark()
   else { // error, not allowed
     throw SyntaxError("Missing type identifier in procedure declaration.", ZERO, ZERO);
   }
+  if (!size)
+    size = Type::natural_size(ret);
   return ret;
 }
 
@@ -519,6 +828,9 @@ void Parser::statement()
   else if (type == RESERVED_FOR) {
     loop_statement();
   }
+  else if (type == RESERVED_CASE) {
+    case_statement();
+  }
   else if (type == RESERVED_RETURN) {
     return_statement();
   }
@@ -540,42 +852,64 @@ void Parser::statement_(Symbol* left)
     type_match(type, rhs_type, 0);
     delete type;
     
-    codegen->calculate_array_element_address(left, false, false, false);
-    
-    if (rhs_type->type() != TYPE_FLOAT)
-      codegen->assign_indexed(left, true);
-    else
-      codegen->assign_indexed(left, false);
+    codegen->assign_indexed(left);
     
     if(rhs_type && !rhs_type->is_symbol()) delete rhs_type;
     
     left->initialized = true;
+    left->modified = true;
     if (left->direction == DIRECTION_IN)
-      Scanner::report_warning("Line "+std::to_string(Scanner::line_number)+": An in parameter is being modified\n");
+      scanner->report_warning(context.line_number, "An in parameter is being modified\n");
   }
   else if (type == TOK_OPEN_PAREN) {
+    std::stack<Symbol*> args;
+    std::vector<Symbol*> sources;
+    std::set<Symbol*> in_place;
+    std::set<Symbol*> copies;
+    int num_out_params = 0;
+    
     match(TOK_OPEN_PAREN);
-    try { argument_list(left); }
-    catch (Error& e) { std::cerr << e.what(); find(TOK_CLOSE_PAREN); }
+    try { argument_list(left, args, num_out_params, sources); }
+    catch (Error& e) { report(e); find(TOK_CLOSE_PAREN); }
     match(TOK_CLOSE_PAREN);
-    codegen->call_procedure(left->name);
-    codegen->caller_return(left->params);
+    
+    if (!procedure_stack.empty() && left == procedure_stack.top())
+      left->body->not_inlinable = "recursive";
+    
+    array_copies(left, sources, copies);
+    if (reuses_frame(left, sources, in_place, copies)) {
+      codegen->spill_inductions();
+      trailing_calls.push_back(codegen->self_call(left, args, num_out_params, in_place, copies));
+      codegen->reload_invariants();
+    }
+    else if (!context.num_errors && should_inline(left, !copies.empty()))
+      inline_call(left);
+    else if (left->leaf) // Never runs the caller's loops or reads its memory
+      codegen->leaf_call(left, args, num_out_params, copies);
+    else {
+      codegen->spill_inductions();
+      codegen->push_parameters(args, num_out_params, copies);
+      if (codegen->external(left))
+        codegen->module_call(left);
+      else
+        codegen->call_procedure(left->name);
+      codegen->caller_return(left->params, copies);
+      codegen->reload_invariants();
+    }
   }
   else { // Must be empty array expression
     match(TOK_ASSIGNMENT);
     rhs_type = expression(false);
     type_match(&left->symbol_type, rhs_type, 0);
     
-    if (rhs_type->type() != TYPE_FLOAT)
-      codegen->assignment(left, true);
-    else
-      codegen->assignment(left, false);
+    codegen->assignment(left);
     
     if (rhs_type && !rhs_type->is_symbol()) delete rhs_type;
     
     left->initialized = true;
+    left->modified = true;
     if (left->direction == DIRECTION_IN)
-      Scanner::report_warning("Line "+std::to_string(Scanner::line_number)+": An in parameter is being modified\n");
+      scanner->report_warning(context.line_number, "An in parameter is being modified\n");
   }
 }
 
@@ -594,11 +928,7 @@ void Parser::assignment() // This assignment is used in loops, can be empty
     delete type;
     
     if (lhs_sym->symbol_type.array() && arr_exp) {
-      codegen->calculate_array_element_address(lhs_sym, true, false, false);
-      if (rhs_type->type() != TYPE_FLOAT)
-        codegen->assign_indexed(lhs_sym, true);
-      else
-        codegen->assign_indexed(lhs_sym, false);
+      codegen->assign_indexed(lhs_sym);
     }
     // Is an array but no brackets
     else if (lhs_sym->symbol_type.array()) {
@@ -609,16 +939,14 @@ void Parser::assignment() // This assignment is used in loops, can be empty
       throw Error("Invalid use of [] in non-array type.\n");
     }
     else {
-      if (rhs_type->type() != TYPE_FLOAT)
-        codegen->assignment(lhs_sym, true);
-      else
-        codegen->assignment(lhs_sym, false);
+      codegen->assignment(lhs_sym);
     }
     if (rhs_type && !rhs_type->is_symbol()) delete rhs_type;
     
     lhs_sym->initialized = true;
+    lhs_sym->modified = true;
     if (lhs_sym->direction == DIRECTION_IN)
-      Scanner::report_warning("Line "+std::to_string(Scanner::line_number)+": An in parameter is being modified\n");
+      scanner->report_warning(context.line_number, "An in parameter is being modified\n");
   }
 }
 
@@ -635,7 +963,7 @@ bool Parser::array_expression()
         throw Error("Array index must be an integer\n");
       if (exp_type && !exp_type->is_symbol()) delete exp_type;
     }
-    catch (Error& e) { std::cerr << e.what(); find(TOK_CLOSE_BRACKET); }
+    catch (Error& e) { report(e); find(TOK_CLOSE_BRACKET); }
     match(TOK_CLOSE_BRACKET);
     return true;
   }
@@ -653,7 +981,7 @@ void Parser::if_statement()
     if (exp_type && exp_type->type() != TYPE_BOOL)
       throw Error("Must be a boolean expression in the if condition.\n");
   }
-  catch (Error& e) { std::cerr << e.what(); find(TOK_CLOSE_PAREN); }
+  catch (Error& e) { report(e); find(TOK_CLOSE_PAREN); }
   if (exp_type && !exp_type->is_symbol()) {
     if(exp_type && !exp_type->is_symbol()) delete exp_type;
   }
@@ -681,60 +1009,229 @@ void Parser::follow_if(int lab)
     codegen->goto_("next", after_else_label);
     codegen->label("else", lab);
 
+    // Both branches end the if statement
+    std::vector<int> then_trailing = trailing_calls;
     try { statements(); }
-    catch (Error& e) { std::cerr << e.what(); find(RESERVED_END); }
+    catch (Error& e) { report(e); find(RESERVED_END); }
     match(RESERVED_END);
     match(RESERVED_IF);
     codegen->label("next", after_else_label);
+    trailing_calls.insert(trailing_calls.end(), then_trailing.begin(), then_trailing.end());
   }
   else { // error, not allowed
       throw SyntaxError("Missing end or else after if clause.", ZERO, ZERO);
   }
 }
 
-void Parser::loop_statement()
+void Parser::case_statement()
 {
   Type* exp_type = NULL;
   
-  match(RESERVED_FOR);
+  match(RESERVED_CASE);
   match(TOK_OPEN_PAREN);
+  try {
+    exp_type = expression(false);
+    if (exp_type && exp_type->type() != TYPE_INT)
+      throw Error("Must be an integer expression in the case selector.\n");
+  }
+  catch (Error& e) { report(e); find(TOK_CLOSE_PAREN); }
+  if (exp_type && !exp_type->is_symbol()) delete exp_type;
+  match(TOK_CLOSE_PAREN);
+  match(RESERVED_IS);
+  
+  codegen->case_statement();
+  
+  // Each arm is a list of constants, then its statements. Any of them can end the statement.
+  std::vector<int> trailing;
+  std::set<long long> seen;
+  try {
+    while (next_token->type == TYPE_INT || next_token->type == TOK_MINUS) {
+      std::vector<long long> constants;
+      while (true) {
+        bool negative = next_token->type == TOK_MINUS;
+        if (negative)
+          match(TOK_MINUS);
+        if (next_token->type != TYPE_INT)
+          throw Error("Case values must be integer constants.\n");
+        long long value = negative ? -(long long)next_token->value.int_value : next_token->value.int_value;
+        match(TYPE_INT);
+        if (!seen.insert(value).second) { // Reported, the arm is still parsed
+          Error duplicate("Case value " + std::to_string(value) + " has more than one arm.\n");
+          report(duplicate);
+        }
+        constants.push_back(value);
+        if (next_token->type != TOK_COMMA)
+          break;
+        match(TOK_COMMA);
+      }
+      match(TOK_COLON);
+      
+      codegen->case_arm(constants);
+      statements();
+      trailing.insert(trailing.end(), trailing_calls.begin(), trailing_calls.end());
+    }
+    if (next_token->type == RESERVED_ELSE) {
+      match(RESERVED_ELSE);
+      codegen->case_default();
+      statements();
+      trailing.insert(trailing.end(), trailing_calls.begin(), trailing_calls.end());
+    }
+    match(RESERVED_END);
+    match(RESERVED_CASE);
+  }
+  catch (Error& e) { codegen->end_case(); throw; }
+  
+  codegen->end_case();
+  trailing_calls = trailing;
+}
+
+void Parser::loop_statement()
+{
+  Type* exp_type = NULL;
   
-  int condition_label = codegen->next_label();
-  codegen->goto_("loopcondition", condition_label);
+  match(RESERVED_FOR);
   
-  int assignment_label = codegen->next_label();
-  codegen->label("loopassignment", assignment_label);
+  // Read the whole loop first so the generator knows what stays the same while it runs
+  std::vector<Token> tokens;
+  read_loop(tokens);
+  std::set<Symbol*> modified;
+  bool calls = false;
+  Symbol* induction = NULL;
+  int step = 0;
+  analyze_loop(tokens, modified, calls, induction, step);
+  replay(tokens);
+  codegen->enter_loop(modified, calls, induction, step);
   
-  try { assignment(); }
-  catch (Error& e) { std::cerr << e.what(); find(TOK_SEMICOLON); }
-  match(TOK_SEMICOLON);
+  // The generator holds state for the loop until it is closed, even when the loop doesn't parse
+  try {
+    match(TOK_OPEN_PAREN);
+    
+    try { assignment(); }
+    catch (Error& e) { report(e); find(TOK_SEMICOLON); }
+    match(TOK_SEMICOLON);
 
-  codegen->label("loopcondition", condition_label);
+    try {
+      exp_type = expression(false);
+      if (exp_type->type() != TYPE_BOOL)
+        throw Error("Must be a boolean expression in the for condition.\n");
+    }
+    catch (Error& e) { report(e); find(TOK_CLOSE_PAREN); }
+    if (exp_type && !exp_type->is_symbol()) delete exp_type;
+    match(TOK_CLOSE_PAREN);
 
-  try {
-    exp_type = expression(false);
-    if (exp_type->type() != TYPE_BOOL)
-      throw Error("Must be a boolean expression in the for condition.\n");
+    codegen->loop_condition();
+
+    trailing_calls.clear();
+    try { statements_(); }
+    catch (Error& e) { report(e); find(RESERVED_END); }
+    match(RESERVED_END);
+    match(RESERVED_FOR);
+    trailing_calls.clear(); // The loop runs again after its last statement
   }
-  catch (Error& e) { std::cerr << e.what(); find(TOK_CLOSE_PAREN); }
-  if (exp_type && !exp_type->is_symbol()) delete exp_type;
-  match(TOK_CLOSE_PAREN);
+  catch (Error& e) { codegen->exit_loop(); throw; }
 
-  int postloop_label = codegen->if_false("postloop");
+  codegen->exit_loop();
+}
 
-  try { statements_(); }
-  catch (Error& e) { std::cerr << e.what(); find(RESERVED_END); }
-  match(RESERVED_END);
-  match(RESERVED_FOR);
+void Parser::read_loop(std::vector<Token> &tokens)
+{
+  // Tokens after 'for' up to its 'end for', nested loops included
+  int depth = 1;
+  type_t previous = ZERO;
+  Token* token = next_token;
+  while (true) {
+    tokens.push_back(*token);
+    if (token->type == RESERVED_FOR)
+      depth += (previous == RESERVED_END) ? -1 : 1;
+    if (token->type == TOK_EOF || depth == 0)
+      break;
+    previous = token->type;
+    delete token;
+    token = scan();
+  }
+  if (token->type == TOK_EOF)
+    next_token = token;
+  else {
+    delete token;
+    next_token = scan();
+  }
+}
 
-  codegen->goto_("loopassignment", assignment_label);
-  codegen->label("postloop", postloop_label);
+void Parser::analyze_loop(std::vector<Token> &tokens, std::set<Symbol*> &modified, bool &calls, Symbol*& induction, int &step)
+{
+  // Count the writes to each variable, by assignment or as an out argument
+  std::unordered_map<Symbol*, int> writes;
+  for (unsigned int i = 0; i + 1 < tokens.size(); i++) {
+    if (tokens[i].type != TOK_IDENTIFIER)
+      continue;
+    Symbol* sym = find_symbol(tokens[i].string);
+    if (sym == NULL)
+      continue;
+    
+    type_t next = tokens[i+1].type;
+    if (next == TOK_ASSIGNMENT)
+      writes[sym]++;
+    else if (next == TOK_OPEN_BRACKET) {
+      unsigned int j = i + 2;
+      for (int depth = 0; j < tokens.size() && !(tokens[j].type == TOK_CLOSE_BRACKET && depth == 0); j++) {
+        if (tokens[j].type == TOK_OPEN_BRACKET) depth++;
+        else if (tokens[j].type == TOK_CLOSE_BRACKET) depth--;
+      }
+      if (j + 1 < tokens.size() && tokens[j+1].type == TOK_ASSIGNMENT)
+        writes[sym]++;
+    }
+    else if (next == TOK_OPEN_PAREN && sym->id_type == ID_PROCEDURE) {
+      calls = true;
+      Symbol* param = sym->params;
+      bool first = true;
+      int depth = 0;
+      for (unsigned int j = i + 2; j < tokens.size(); j++) {
+        type_t type = tokens[j].type;
+        if (first && param && param->direction == DIRECTION_OUT && type == TOK_IDENTIFIER) {
+          Symbol* arg = find_symbol(tokens[j].string);
+          if (arg)
+            writes[arg]++;
+        }
+        first = false;
+        if (type == TOK_OPEN_PAREN || type == TOK_OPEN_BRACKET)
+          depth++;
+        else if (type == TOK_CLOSE_PAREN || type == TOK_CLOSE_BRACKET) {
+          if (depth-- == 0)
+            break;
+        }
+        else if (type == TOK_COMMA && depth == 0) {
+          param = param ? param->next : NULL;
+          first = true;
+        }
+      }
+    }
+  }
+  for (std::unordered_map<Symbol*, int>::iterator it = writes.begin(); it != writes.end(); it++)
+    modified.insert(it->first);
+  
+  // An induction variable is stepped by a constant in the loop assignment and written nowhere else
+  if (tokens.size() > 6 && tokens[0].type == TOK_OPEN_PAREN && tokens[1].type == TOK_IDENTIFIER
+      && tokens[2].type == TOK_ASSIGNMENT && tokens[3].type == TOK_IDENTIFIER && tokens[3].string == tokens[1].string
+      && (tokens[4].type == TOK_PLUS || tokens[4].type == TOK_MINUS) && tokens[5].type == TYPE_INT
+      && tokens[6].type == TOK_SEMICOLON)
+  {
+    Symbol* sym = find_symbol(tokens[1].string);
+    if (sym && sym->id_type != ID_PROCEDURE && writes[sym] == 1 && !sym->symbol_type.array()
+        && sym->symbol_type.type() == TYPE_INT && !(sym->is_global && calls)) {
+      induction = sym;
+      step = (tokens[4].type == TOK_PLUS) ? tokens[5].value.int_value : -tokens[5].value.int_value;
+    }
+  }
 }
 
 void Parser::return_statement()
 {
   match(RESERVED_RETURN);
-  codegen->callee_return(false);
+  codegen->spill_inductions();
+  if (!inline_exits.empty())
+    codegen->goto_("postinline", inline_exits.top());
+  else
+    codegen->callee_return(procedure_stack.empty() ? NULL : procedure_stack.top());
 }
 
 std::string Parser::identifier()
@@ -949,10 +1446,13 @@ Type* Parser::factor(bool out_param)
   if (out_param && (type != TOK_IDENTIFIER))
       bad_out_param = true;
   
+  operand_count++;
+  named_operand = NULL;
+  
   if (type == TOK_OPEN_PAREN) {
     match(TOK_OPEN_PAREN);
     try { factortype = expression(false); }
-    catch (Error& e) { std::cerr << e.what(); find(TOK_CLOSE_PAREN); }
+    catch (Error& e) { report(e); find(TOK_CLOSE_PAREN); }
     match(TOK_CLOSE_PAREN);
   }
   else if (type == TOK_IDENTIFIER || type == TYPE_FLOAT || type == TYPE_INT) {
@@ -964,6 +1464,7 @@ Type* Parser::factor(bool out_param)
     if (factortype->type() == TYPE_STRING || factortype->type() == TYPE_BOOL || factortype->array())
       throw InvalidOp(TOK_MINUS, factortype->type());
     codegen->change_sign(factortype->type());
+    named_operand = NULL;
   }
   else if (type == TYPE_STRING) {
     factortype = string();
@@ -1010,26 +1511,24 @@ Type* Parser::name(bool out_param)
   // Is an array and has brackets
   Symbol* id_sym = get_symbol(id);
   id_sym->used = true;
-  if (out_param) id_sym->initialized = true;
+  if (out_param) {
+    id_sym->initialized = true;
+    id_sym->modified = true;
+  }
+  named_operand = arr_exp_type ? NULL : id_sym;
   if (id_sym->symbol_type.array() && arr_exp_type) {
 
-    if (out_param)
-      codegen->calculate_array_element_address(id_sym, true, false, true);
-
-    codegen->calculate_array_element_address(id_sym, true, out_param, false);
-
-    if (id_sym->symbol_type.type() != TYPE_FLOAT)
-      codegen->get_indexed_value(true);
-    else
-      codegen->get_indexed_value(false);
+    // Out arguments are passed by address, the value is loaded from it
+    codegen->element_address(id_sym);
+    if (!out_param)
+      codegen->get_indexed_value(id_sym);
 
     Type* type = new Type(id_sym->symbol_type.type(), false, 1);
+    type->set_size(id_sym->symbol_type.size());
     return type;
   }
   // Is an array, but no brackets
   else if (id_sym->symbol_type.array()) {
-    if (out_param)
-      codegen->calculate_address(id_sym);
     codegen->calculate_address(id_sym);
     return &id_sym->symbol_type;
   }
@@ -1042,21 +1541,16 @@ Type* Parser::name(bool out_param)
     
     if (out_param)
       codegen->calculate_address(id_sym);
-    
-    if (id_sym->symbol_type.type() != TYPE_FLOAT)
-      codegen->get_value(true, id_sym);
     else
-      codegen->get_value(false, id_sym);
+      codegen->get_value(id_sym);
 
     return &id_sym->symbol_type;
   }
 }
 
-void Parser::argument_list(Symbol* procedure)
+void Parser::argument_list(Symbol* procedure, std::stack<Symbol*> &args, int &num_out_params, std::vector<Symbol*> &sources)
 {
   type_t type = next_token->type;
-  int num_out_params = 0;
-  std::stack<Symbol*> args;
   if (type == TOK_OPEN_PAREN || type == TOK_IDENTIFIER || type == TYPE_FLOAT || type == TYPE_INT
       || type == TOK_MINUS || type == TYPE_STRING || type == RESERVED_TRUE || type == RESERVED_FALSE)
   {
@@ -1067,10 +1561,12 @@ void Parser::argument_list(Symbol* procedure)
       throw Error("Too many arguments in procedure call\n");
     }
     
+    operand_count = 0;
     if (procedure->params->direction == DIRECTION_OUT)
       exp_type = expression(true);
     else
       exp_type = expression(false);
+    sources.push_back(operand_count == 1 ? named_operand : NULL);
     
     if (bad_out_param) {
       std::string integer = std::to_string(1);
@@ -1078,9 +1574,9 @@ void Parser::argument_list(Symbol* procedure)
       throw Error("A modifiable l-value is expected in argument "+integer+"\n");
     }
     
-    try { type_match(&procedure->params->symbol_type, exp_type, 1); }
+    try { type_match(&procedure->params->symbol_type, exp_type, 1, procedure->params->direction == DIRECTION_OUT); }
     catch (InvalidAssignment& e) { 
-      std::cerr << e.what();
+      report(e);
       if (procedure->params->next)
         find(TOK_COMMA);
       else
@@ -1090,18 +1586,14 @@ void Parser::argument_list(Symbol* procedure)
     
     // Push argument into a stack so they can be processed in reverse order
     args.push(procedure->params);
-    codegen->spill_register();
-    if (procedure->params->direction == DIRECTION_OUT) {
-      num_out_params++;
-      codegen->spill_register();
-    }
+    codegen->argument(procedure->params);
+    if (procedure->params->direction == DIRECTION_OUT && !procedure->params->symbol_type.array())
+      num_out_params++; // Scalar out arguments pass their value and address
     
     // last_arg should be null or we are missing arguments
-    Symbol* last_arg = argument_list_(procedure->params->next, args, num_out_params);
+    Symbol* last_arg = argument_list_(procedure->params->next, args, num_out_params, sources);
     if(last_arg != NULL)
       throw Error("Not enough arguments in procedure call\n");
-    
-    codegen->push_parameters(args, num_out_params);
   }
   else {
     if (procedure->params != NULL)
@@ -1109,7 +1601,7 @@ void Parser::argument_list(Symbol* procedure)
   }
 }
 
-Symbol* Parser::argument_list_(Symbol* next_param, std::stack<Symbol*> &args, int &num_out_params)
+Symbol* Parser::argument_list_(Symbol* next_param, std::stack<Symbol*> &args, int &num_out_params, std::vector<Symbol*> &sources)
 {
   Symbol* current_param = next_param;
   int argnum = 2;
@@ -1122,10 +1614,12 @@ Symbol* Parser::argument_list_(Symbol* next_param, std::stack<Symbol*> &args, in
       if (current_param == NULL) {
         throw Error("Too many arguments in procedure call\n");
       }
+      operand_count = 0;
       if (current_param->direction == DIRECTION_OUT)
         exp_type = expression(true);
       else
         exp_type = expression(false);
+      sources.push_back(operand_count == 1 ? named_operand : NULL);
       
       if (bad_out_param) {
         std::string integer = std::to_string(argnum);
@@ -1134,9 +1628,9 @@ Symbol* Parser::argument_list_(Symbol* next_param, std::stack<Symbol*> &args, in
       }
       
       // Check types
-      try { type_match(&current_param->symbol_type, exp_type, argnum); }
+      try { type_match(&current_param->symbol_type, exp_type, argnum, current_param->direction == DIRECTION_OUT); }
       catch (InvalidAssignment& e) { 
-      std::cerr << e.what();
+      report(e);
       if (current_param->next)
         find(TOK_COMMA);
       else
@@ -1146,11 +1640,9 @@ Symbol* Parser::argument_list_(Symbol* next_param, std::stack<Symbol*> &args, in
 
       // Push argument onto stack
       args.push(current_param);
-      codegen->spill_register();
-      if (current_param->direction == DIRECTION_OUT) {
-        codegen->spill_register();
+      codegen->argument(current_param);
+      if (current_param->direction == DIRECTION_OUT && !current_param->symbol_type.array())
         num_out_params++;
-      }
       current_param = current_param->next;
       argnum++;
       continue;
@@ -1161,6 +1653,357 @@ Symbol* Parser::argument_list_(Symbol* next_param, std::stack<Symbol*> &args, in
   return current_param;
 }
 
+// Arrays are passed by reference, an argument is copied only where the callee could tell the difference
+void Parser::array_copies(Symbol* procedure, std::vector<Symbol*> &sources, std::set<Symbol*> &copies)
+{
+  bool complete = procedure->body && procedure->body->complete;
+  std::map<Symbol*, int> passed;
+  std::set<Symbol*> written;
+  std::set<type_t> element_outs;
+  
+  unsigned int n = 0;
+  for (Symbol* param = procedure->params; param != NULL && n < sources.size(); param = param->next, n++) {
+    Symbol* source = sources[n];
+    if (!param->symbol_type.array()) {
+      if (param->direction == DIRECTION_OUT && source == NULL) // Written through the address of an element
+        element_outs.insert(param->symbol_type.type());
+      continue;
+    }
+    // The caller's in argument must not change, and the callee could reach a global by name
+    bool writes = param->direction == DIRECTION_OUT || !complete || param->modified;
+    if (source == NULL || source->is_global || (param->direction == DIRECTION_IN && writes))
+      copies.insert(param);
+    passed[source]++;
+    if (writes)
+      written.insert(source);
+  }
+  
+  n = 0;
+  for (Symbol* param = procedure->params; param != NULL && n < sources.size(); param = param->next, n++) {
+    Symbol* source = sources[n];
+    if (!param->symbol_type.array() || copies.count(param))
+      continue;
+    if ((passed[source] > 1 && written.count(source)) || (written.count(source) && element_outs.count(param->symbol_type.type())))
+      copies.insert(param);
+  }
+}
+
+bool Parser::reuses_frame(Symbol* procedure, std::vector<Symbol*> &sources, std::set<Symbol*> &in_place, std::set<Symbol*> &copies)
+{
+  // Only a procedure calling itself has the same frame layout as the caller
+  if (procedure_stack.empty() || procedure != procedure_stack.top())
+    return false;
+  
+  unsigned int n = 0;
+  for (Symbol* param = procedure->params; param != NULL; param = param->next, n++) {
+    if (n >= sources.size())
+      return false;
+    Symbol* source = sources[n];
+    
+    if (source == param)
+      in_place.insert(param);
+    else if (param->symbol_type.array()) { // The reference is replaced, unless the argument must be copied
+      if (copies.count(param) || source == NULL || source->id_type != ID_PARAMETER)
+        return false;
+    }
+    else if (param->direction == DIRECTION_OUT) // Copy out must still happen after the call returns
+      return false;
+  }
+  return true;
+}
+
+void Parser::mark_tail_calls(std::vector<int> &calls)
+{
+  for (unsigned int i = 0; i < calls.size(); i++)
+    codegen->tail_position(calls[i]);
+  calls.clear();
+}
+
+void Parser::count_call_sites()
+{
+  // Pre-scan the source so the inliner knows how many times each procedure is called,
+  // which procedures need a frame because they make calls or declare arrays,
+  // the token positions between which each local is live, which locals may be read first, which scalars are passed
+  // as out arguments and which procedures can be active more than once
+  std::istream* ifs = scanner->open();
+  int line_number = context.line_number;
+  int num_errors = context.num_errors;
+  scanner->quiet = true;
+  
+  type_t previous = ZERO;
+  std::string name;
+  std::vector<std::string> procedures(1); // Enclosing the current token, innermost last, the program first
+  std::vector<bool> in_body(1, false);
+  std::vector<std::map<std::string, std::pair<int, int> > > locals(1);
+  std::vector<int> loops;
+  std::map<std::string, std::vector<bool> > outs; // Whether each parameter is out, by procedure
+  std::map<std::string, std::set<std::string> > callees;
+  outs["getbool"] = outs["getinteger"] = outs["getfloat"] = outs["getstring"] = std::vector<bool>(1, true);
+  outs["putbool"] = outs["putinteger"] = outs["putfloat"] = outs["putstring"] = std::vector<bool>(1, false);
+  bool header = false;
+  std::vector<bool> header_outs;
+  std::string callee;     // Of the call whose arguments are being scanned
+  int argument = 0;
+  int argument_tokens = 0;
+  std::string argument_name;
+  int parens = 0;
+  int position = 0;
+  int branches = 0;       // If and case statements enclosing the current token
+  std::string assigned;   // Local first used as the target of the assignment being scanned
+  bool target = false;    // The previous token was that target
+  Token* token = scanner->get_token(*ifs);
+  while (token->type != TOK_EOF) {
+    if (token->type == TOK_OPEN_PAREN && !name.empty()) {
+      call_sites[name]++;
+      framed.insert(procedures.back());
+      callees[procedures.back()].insert(name);
+      callee = name;
+      argument = 0;
+      argument_tokens = 0;
+    }
+    else if (!callee.empty() && parens == 1 && (token->type == TOK_COMMA || token->type == TOK_CLOSE_PAREN)) {
+      // A variable passed alone to an out parameter, or to a procedure not seen, has its address taken
+      std::vector<bool>& directions = outs[callee];
+      if (argument_tokens == 1 && !argument_name.empty() && (argument >= (int)directions.size() || directions[argument]))
+        escaped.insert((locals.back().count(argument_name) ? procedures.back() : "") + "." + argument_name);
+      argument++;
+      argument_tokens = 0;
+      if (token->type == TOK_CLOSE_PAREN)
+        callee.clear();
+    }
+    else if (!callee.empty()) {
+      argument_tokens++;
+      argument_name = (token->type == TOK_IDENTIFIER) ? token->string : "";
+    }
+    if (header && parens == 1 && (token->type == RESERVED_IN || token->type == RESERVED_OUT))
+      header_outs.push_back(token->type == RESERVED_OUT);
+    else if (header && parens == 1 && token->type == TOK_CLOSE_PAREN) {
+      // Procedures of the same name in different scopes are merged, a parameter is out if it is in any of them
+      std::vector<bool>& directions = outs[procedures.back()];
+      for (unsigned int i = 0; i < header_outs.size(); i++) {
+        if (i < directions.size())
+          directions[i] = directions[i] || header_outs[i];
+        else
+          directions.push_back(header_outs[i]);
+      }
+      header = false;
+    }
+    
+    if (token->type == TOK_IDENTIFIER && previous == RESERVED_PROCEDURE) {
+      procedures.push_back(token->string);
+      in_body.push_back(false);
+      locals.push_back(std::map<std::string, std::pair<int, int> >());
+      header_outs.clear();
+      header = true;
+    }
+    else if (token->type == RESERVED_PROCEDURE && previous == RESERVED_END && procedures.size() > 1) {
+      add_live_ranges(procedures.back(), locals.back());
+      procedures.pop_back();
+      in_body.pop_back();
+      locals.pop_back();
+    }
+    else if (token->type == RESERVED_BEGIN)
+      in_body.back() = true;
+    else if (token->type == TOK_OPEN_BRACKET && !in_body.back() && !parens) // Local array
+      framed.insert(procedures.back());
+    else if (token->type == TOK_IDENTIFIER && !in_body.back() && !parens
+             && (previous == RESERVED_INT || previous == RESERVED_FLOAT || previous == RESERVED_BOOL || previous == RESERVED_STRING))
+      locals.back()[token->string] = std::make_pair(INT_MAX, -1);
+    else if (token->type == TOK_IDENTIFIER && in_body.back() && locals.back().count(token->string)) {
+      // Written first only by a plain assignment outside of any branch or loop, whose value doesn't use it
+      std::pair<int, int>& range = locals.back()[token->string];
+      if (range.first == INT_MAX && !branches && loops.empty() && parens == 0 && previous != TOK_IDENTIFIER) {
+        assigned = token->string;
+        target = true;
+      }
+      else if (range.first == INT_MAX || token->string == assigned)
+        read_first.insert(procedures.back() + "." + token->string);
+      range.first = std::min(range.first, position);
+      range.second = position;
+    }
+    else if (token->type == RESERVED_FOR && previous != RESERVED_END)
+      loops.push_back(position);
+    else if (token->type == RESERVED_FOR && !loops.empty()) {
+      // A local used in a loop may carry its value around it, so it is live for the whole loop
+      std::map<std::string, std::pair<int, int> >::iterator it;
+      for (it = locals.back().begin(); it != locals.back().end(); it++) {
+        if (it->second.second >= loops.back()) {
+          it->second.first = std::min(it->second.first, loops.back());
+          it->second.second = position;
+        }
+      }
+      loops.pop_back();
+    }
+    if (target && token->type != TOK_IDENTIFIER) {
+      if (token->type != TOK_ASSIGNMENT)
+        read_first.insert(procedures.back() + "." + assigned);
+      target = false;
+    }
+    if (token->type == TOK_SEMICOLON)
+      assigned.clear();
+    if ((token->type == RESERVED_IF || token->type == RESERVED_CASE) && previous != RESERVED_END)
+      branches++;
+    else if ((token->type == RESERVED_IF || token->type == RESERVED_CASE) && branches)
+      branches--;
+    if (token->type == TOK_OPEN_PAREN)
+      parens++;
+    else if (token->type == TOK_CLOSE_PAREN)
+      parens--;
+    if (token->type == TOK_IDENTIFIER && previous != RESERVED_PROCEDURE)
+      name = token->string;
+    else
+      name.clear();
+    previous = token->type;
+    position++;
+    delete token;
+    token = scanner->get_token(*ifs);
+  }
+  delete token;
+  add_live_ranges("", locals.front());
+  
+  // A procedure that can reach itself through its calls may be active more than once
+  std::map<std::string, std::set<std::string> >::iterator it;
+  for (it = callees.begin(); it != callees.end(); it++) {
+    std::set<std::string> reached;
+    std::vector<std::string> work(it->second.begin(), it->second.end());
+    while (!work.empty()) {
+      std::string next = work.back();
+      work.pop_back();
+      if (reached.count(next))
+        continue;
+      reached.insert(next);
+      work.insert(work.end(), callees[next].begin(), callees[next].end());
+    }
+    if (reached.count(it->first))
+      recursive.insert(it->first);
+  }
+  
+  delete ifs;
+  scanner->quiet = false;
+  context.line_number = line_number;
+  context.num_errors = num_errors;
+}
+
+// A local of the program or of a procedure that is never active twice can live in a C variable, unless its address is taken
+bool Parser::promotable(std::string id)
+{
+  std::string procedure = procedure_stack.empty() ? "" : procedure_stack.top()->name;
+  return !recursive.count(procedure) && !escaped.count(procedure + "." + id);
+}
+
+void Parser::add_live_ranges(std::string procedure, std::map<std::string, std::pair<int, int> > &locals)
+{
+  // Procedures with the same name in different scopes share the union of their ranges
+  std::map<std::string, std::pair<int, int> >::iterator it;
+  for (it = locals.begin(); it != locals.end(); it++) {
+    std::string key = procedure + "." + it->first;
+    if (live_ranges.count(key)) {
+      live_ranges[key].first = std::min(live_ranges[key].first, it->second.first);
+      live_ranges[key].second = std::max(live_ranges[key].second, it->second.second);
+    }
+    else
+      live_ranges[key] = it->second;
+  }
+}
+
+bool Parser::should_inline(Symbol* procedure, bool copies_arrays)
+{
+  Procedure_body* body = procedure->body;
+  if (!inline_procedures || body == NULL) // Runtime procedures have no body
+    return false;
+  
+  std::string reason;
+  unsigned int size = body->tokens.size();
+  if (!body->not_inlinable.empty())
+    reason = body->not_inlinable;
+  else if (!body->complete)
+    reason = "body not complete";
+  else if (copies_arrays)
+    reason = "array arguments must be copied";
+  else if (inline_exits.size() >= INLINE_MAX_DEPTH)
+    reason = "too deeply inlined";
+  else if (size > INLINE_SINGLE_CALL_BODY)
+    reason = "body too large";
+  else if (size > INLINE_SMALL_BODY && body->call_sites > 1)
+    reason = "body too large for more than one call site";
+  
+  if (report_inlining) {
+    context.output << "Line " << context.line_number << ": " << (reason.empty() ? "inlined" : "did not inline");
+    context.output << " '" << procedure->name << "' (" << size << " tokens, " << body->call_sites << " call sites";
+    if (!reason.empty())
+      context.output << ", " << reason;
+    context.output << ")\n";
+  }
+  return reason.empty();
+}
+
+void Parser::inline_call(Symbol* procedure)
+{
+  int frame = codegen->get_fp_address();
+  
+  // Parameters become locals of the caller, copied in and out like a real call, arrays are referenced
+  symbol_map *map = new symbol_map;
+  symbol_table.push(map);
+  std::vector<Symbol*> slots;
+  std::vector<Symbol*> out_values;
+  std::vector<Symbol*> out_addresses;
+  for (Symbol* param = procedure->params; param != NULL; param = param->next) {
+    Symbol* copy = new Symbol(param->name, false, param->symbol_type.array(), param->symbol_type.type(), param->symbol_type.arraysize());
+    copy->set_element_size(param->symbol_type.size());
+    copy->used = true;
+    copy->initialized = true;
+    copy->reference = param->symbol_type.array();
+    if (param->direction == DIRECTION_OUT && !copy->reference) {
+      Symbol* address = new Symbol(param->name, false, false, TYPE_INT, 1);
+      address->set_element_size(8);
+      codegen->stack_alloc_local(address);
+      slots.push_back(address);
+      out_addresses.push_back(address);
+      out_values.push_back(copy);
+    }
+    codegen->stack_alloc_local(copy);
+    slots.push_back(copy);
+    add_to_symbol_table(copy);
+  }
+  codegen->inline_parameters(slots);
+  
+  // Parse the callee again in place of the call, it sees only its own scope and the globals
+  bool warnings = context.warnings;
+  context.warnings = false;
+  inline_exits.push(codegen->next_label());
+  procedure_stack.push(NULL);
+  replay(procedure->body->tokens);
+  
+  try { declarations_(); }
+  catch (Error& e) { report(e); find(RESERVED_BEGIN); }
+  match(RESERVED_BEGIN);
+  
+  trailing_calls.clear();
+  try { statements_(); }
+  catch (Error& e) { report(e); find(RESERVED_END); }
+  match(RESERVED_END);
+  trailing_calls.clear();
+  
+  procedure_stack.pop();
+  codegen->label("postinline", inline_exits.top());
+  inline_exits.pop();
+  context.warnings = warnings;
+  
+  for (unsigned int i = 0; i < out_values.size(); i++)
+    codegen->inline_return(out_values[i], out_addresses[i]);
+  codegen->free_stack(frame);
+  
+  // Delete the inlined scope
+  for (map_iterator = symbol_table.top()->begin(); map_iterator != symbol_table.top()->end(); map_iterator++) {
+    map_iterator->second->ref_count--;
+    delete map_iterator->second;
+  }
+  delete symbol_table.top();
+  symbol_table.pop();
+  for (unsigned int i = 0; i < out_addresses.size(); i++)
+    delete out_addresses[i];
+}
+
 Type* Parser::number(bool arraysize)
 {
   type_t type = next_token->type;
@@ -1208,7 +2051,7 @@ void Parser::add_to_symbol_table(Symbol* sym)
       }
     }
     else {
-      Scanner::report_warning("Line "+std::to_string(Scanner::line_number)+": Ignoring the 'global' specifier. It should not be used in this scope\n");
+      scanner->report_warning(context.line_number, "Ignoring the 'global' specifier. It should not be used in this scope\n");
       map_iterator = symbol_table.top()->find(sym->name);
       if (map_iterator != symbol_table.top()->end())
         throw Redeclaration(sym->name);
@@ -1232,23 +2075,30 @@ void Parser::add_to_symbol_table(Symbol* sym)
 }
 
 Symbol* Parser::get_symbol(std::string id)
+{
+  Symbol* sym = find_symbol(id);
+  if (sym == NULL) // Not in either symbol table
+    throw NoDeclaration(id);
+  return sym;
+}
+
+Symbol* Parser::find_symbol(std::string id)
 {
   map_iterator = symbol_table.top()->find(id);
   // If the symbol is not in the current scope, check global symbol table
   if (map_iterator == symbol_table.top()->end()) {
     map_iterator = global_symbol_map->find(id);
-    if (map_iterator == global_symbol_map->end()) {
-      // Not in either symbol table
-      throw NoDeclaration(id);
-    }
+    if (map_iterator == global_symbol_map->end())
+      return NULL;
   }
   return map_iterator->second;
 }
 
-void Parser::type_match(Type* lhs_type, Type* rhs_type, int argnum)
+void Parser::type_match(Type* lhs_type, Type* rhs_type, int argnum, bool same_size)
 {
   // TODO only allow array assignment for params
-  if (*lhs_type != *rhs_type)
+  // Out arguments are written through their address, so they must also be stored at the same size
+  if (*lhs_type != *rhs_type || (same_size && lhs_type->size() != rhs_type->size()))
     throw InvalidAssignment(lhs_type, rhs_type, argnum);
 }
 
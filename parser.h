@@ -2,8 +2,12 @@
 #define PARSER_H
 
 #include <cstdlib>
+#include <climits>
 #include <stdlib.h>
 #include <stack>
+#include <deque>
+#include <set>
+#include <vector>
 #include <unistd.h>
 #include <sstream>
 
@@ -12,23 +16,37 @@
 #include "error.h"
 #include "codegenerator.h"
 
+// Tokens of a procedure from its declarations to the 'end' of its body
+struct Procedure_body {
+  std::vector<Token> tokens;
+  int call_sites;
+  bool complete;
+  std::string not_inlinable; // Why the body can never be inlined, empty if it can
+};
+
 class Parser {
   public:
-    Parser(std::string filename);
+    Parser(Compilation& compilation);
     ~Parser();
 
     void start();
-    static void add_to_symbol_table(Symbol* sym);
+    void add_to_symbol_table(Symbol* sym);
     Symbol* get_symbol(std::string id);
+    Symbol* find_symbol(std::string id);
     
     bool EOF_found;
+    bool inline_procedures;
+    bool report_inlining;
     
   protected:
     void match(type_t t);
     void move();
+    Token* scan();
+    void replay(std::vector<Token> &tokens);
     void find(type_t type);
     void syntax_error(std::string mesg);
-    void type_match(Type* lhs_type, Type* rhs_type, int argnum);
+    void report(Error& e);
+    void type_match(Type* lhs_type, Type* rhs_type, int argnum, bool same_size = false);
     Type* arithmetic_typecheck(Type* lhs_type, Type* rhs_type, type_t op_type);
     void relation_typecheck(Type* lhs_type, Type* rhs_type, relative_op_t relop);
     
@@ -36,6 +54,11 @@ class Parser {
     void return_after_runtime();
     void program_header();
     void program_body();
+    void imports();
+    void import_module(std::string name, bool visible);
+    void module_header();
+    void module_body();
+    void write_interface();
     void declarations_();
     void statements();
     void statements_();
@@ -50,7 +73,7 @@ class Parser {
     void procedure_body(std::string name);
     Symbol* variable_declaration(bool global, id_type_t idt);
     bool array_size_brackets(unsigned int &array_size);
-    type_t typemark();
+    type_t typemark(unsigned int &size);
     unsigned int arraysize();
     void statement();
     void statement_(Symbol* left);
@@ -58,7 +81,10 @@ class Parser {
     bool array_expression();
     void if_statement();
     void follow_if(int lab);
+    void case_statement();
     void loop_statement();
+    void read_loop(std::vector<Token> &tokens);
+    void analyze_loop(std::vector<Token> &tokens, std::set<Symbol*> &modified, bool &calls, Symbol*& induction, int &step);
     void return_statement();
     void expression_(Type*& lhs_type, bool out_param);
     void arithop_(Type*& lhs_type, bool out_param);
@@ -71,26 +97,58 @@ class Parser {
     Type* term(bool out_param);
     Type* factor(bool out_param);
     Type* factor_(bool out_param);
-    void argument_list(Symbol* procedure);
-    Symbol* argument_list_(Symbol* next_param, std::stack<Symbol*> &args, int &num_out_params);
+    void argument_list(Symbol* procedure, std::stack<Symbol*> &args, int &num_out_params, std::vector<Symbol*> &sources);
+    Symbol* argument_list_(Symbol* next_param, std::stack<Symbol*> &args, int &num_out_params, std::vector<Symbol*> &sources);
+    void array_copies(Symbol* procedure, std::vector<Symbol*> &sources, std::set<Symbol*> &copies);
+    bool reuses_frame(Symbol* procedure, std::vector<Symbol*> &sources, std::set<Symbol*> &in_place, std::set<Symbol*> &copies);
+    void mark_tail_calls(std::vector<int> &calls);
+    void count_call_sites();
+    bool promotable(std::string id);
+    void add_live_ranges(std::string procedure, std::map<std::string, std::pair<int, int> > &locals);
+    bool should_inline(Symbol* procedure, bool copies_arrays);
+    void inline_call(Symbol* procedure);
     Type* name(bool out_param);
     Type* number(bool arraysize);
     Type* string();
 
   private:
+    Compilation& context;
     Token *next_token;
     Scanner *scanner;
     Code_generator *codegen;
     
     bool bad_out_param;
     
+    // Modules
+    std::string module_name;          // Of the module being compiled, empty for a program
+    std::string directory;            // Of the source, where the interfaces of imported modules are found
+    std::map<std::string, bool> imported; // Modules whose interface was read, true if their names can be used
+    std::vector<Symbol*> exported;    // Procedures of the module, in the order other modules number them
+    
+    // Tail call detection
+    std::stack<Symbol*> procedure_stack;
+    std::vector<int> trailing_calls;
+    int operand_count;
+    Symbol* named_operand;
+    
+    // Inlining
+    std::deque<Token*> pending_tokens;
+    std::vector<Token>* recording;
+    std::unordered_map<std::string, int> call_sites;
+    std::set<std::string> framed; // Procedures that can't be leaves
+    std::unordered_map<std::string, std::pair<int, int> > live_ranges; // Of each local, by procedure and name
+    std::set<std::string> escaped;   // Scalars whose address is taken, by procedure and name
+    std::set<std::string> read_first; // Locals that may be read before they are written, they keep their own slot
+    std::set<std::string> recursive;
+    std::stack<int> inline_exits;
+    
     char num[8];
     
     // Symbol table management
-    static symbol_map_iterator map_iterator;
-    static std::stack <symbol_map*> symbol_table;
-    static symbol_map* global_symbol_map;
-    static symbol_map* outer_symbol_map;
+    symbol_map_iterator map_iterator;
+    std::stack <symbol_map*> symbol_table;
+    symbol_map* global_symbol_map;
+    symbol_map* outer_symbol_map;
 };
 
 #endif
\ No newline at end of file
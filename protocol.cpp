@@ -0,0 +1,111 @@
+#include <sstream>
+#include <cerrno>
+#include <unistd.h>
+#include "protocol.h"
+
+static bool write_all(int fd, const std::string& data)
+{
+  size_t done = 0;
+  while (done < data.size()) {
+    ssize_t n = write(fd, data.data() + done, data.size() - done);
+    if (n < 0 && errno == EINTR)
+      continue;
+    if (n <= 0)
+      return false;
+    done += n;
+  }
+  return true;
+}
+
+static bool read_all(int fd, std::string& data, size_t size)
+{
+  data.resize(size);
+  size_t done = 0;
+  while (done < size) {
+    ssize_t n = read(fd, &data[done], size - done);
+    if (n < 0 && errno == EINTR)
+      continue;
+    if (n <= 0)
+      return false;
+    done += n;
+  }
+  return true;
+}
+
+// The header line, read a byte at a time so nothing after it is consumed
+static bool read_line(int fd, std::istringstream& line)
+{
+  std::string text;
+  char ch;
+  while (true) {
+    ssize_t n = read(fd, &ch, 1);
+    if (n < 0 && errno == EINTR)
+      continue;
+    if (n <= 0)
+      return false;
+    if (ch == '\n')
+      break;
+    if (text.size() == MAX_HEADER_SIZE)
+      return false;
+    text += ch;
+  }
+  line.str(text);
+  return true;
+}
+
+bool send_request(int fd, const std::string& source, const Compile_options& options)
+{
+  std::ostringstream header;
+  header << "compile " << options.inline_procedures << " " << options.report_inlining << " " << options.lean << " " << source.size() << "\n";
+  return write_all(fd, header.str() + source);
+}
+
+request_t receive_request(int fd, std::string& source, Compile_options& options, size_t& size)
+{
+  std::istringstream header;
+  std::string word;
+  if (!read_line(fd, header))
+    return REQUEST_CLOSED;
+  if (!(header >> word >> options.inline_procedures >> options.report_inlining >> options.lean >> size) || word != "compile")
+    return REQUEST_CLOSED;
+  if (size > MAX_REQUEST_SIZE)
+    return REQUEST_TOO_LARGE;
+  return read_all(fd, source, size) ? REQUEST_COMPILE : REQUEST_CLOSED;
+}
+
+bool send_result(int fd, const Compile_result& result)
+{
+  std::ostringstream message;
+  message << "result " << result.success << " " << result.num_errors << " " << result.num_warnings << " ";
+  message << result.diagnostics.size() << " " << result.code.size() << " " << result.messages.size() << "\n";
+  for (unsigned int i = 0; i < result.diagnostics.size(); i++) {
+    const Diagnostic& diagnostic = result.diagnostics[i];
+    message << diagnostic.kind << " " << diagnostic.line << " " << diagnostic.message.size() << "\n" << diagnostic.message;
+  }
+  message << result.code << result.messages;
+  return write_all(fd, message.str());
+}
+
+bool receive_result(int fd, Compile_result& result)
+{
+  std::istringstream header;
+  std::string word;
+  size_t diagnostics, code, messages;
+  if (!read_line(fd, header))
+    return false;
+  if (!(header >> word >> result.success >> result.num_errors >> result.num_warnings >> diagnostics >> code >> messages) || word != "result")
+    return false;
+
+  result.diagnostics.clear();
+  for (size_t i = 0; i < diagnostics; i++) {
+    std::istringstream line;
+    int kind;
+    size_t size;
+    Diagnostic diagnostic;
+    if (!read_line(fd, line) || !(line >> kind >> diagnostic.line >> size) || !read_all(fd, diagnostic.message, size))
+      return false;
+    diagnostic.kind = (diagnostic_t)kind;
+    result.diagnostics.push_back(diagnostic);
+  }
+  return read_all(fd, result.code, code) && read_all(fd, result.messages, messages);
+}
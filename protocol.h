@@ -0,0 +1,24 @@
+#ifndef PROTOCOL_H
+#define PROTOCOL_H
+
+#include <string>
+#include "compiler.h"
+
+#define SERVER_SOCKET "/tmp/compiler.sock"
+#define MAX_REQUEST_SIZE (64 << 20) // Bytes of source in one request, a larger one is answered with an error
+#define MAX_HEADER_SIZE 256         // Bytes of a header line
+
+enum request_t {
+  REQUEST_COMPILE,
+  REQUEST_TOO_LARGE, // The source was left unread, size holds what the header asked for
+  REQUEST_CLOSED,    // The connection was closed or sent something that is not a request
+};
+
+// Requests and results between the compile server and its clients over a stream socket.
+// Each is a line of sizes followed by that many bytes, so a connection can carry any number of them.
+bool send_request(int fd, const std::string& source, const Compile_options& options);
+request_t receive_request(int fd, std::string& source, Compile_options& options, size_t& size);
+bool send_result(int fd, const Compile_result& result);
+bool receive_result(int fd, Compile_result& result);
+
+#endif
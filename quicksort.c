@@ -0,0 +1,384 @@
+#include "runtime.h"
+
+long long static_data();
+
+int main() {
+	goto start;
+	void* ret1;		// Return address of getbool
+	bool lv2;		// getbool bb
+	long long lv2_address;
+getbool:
+	lv2 = getBool();
+	goto *ret1;
+	void* ret3;		// Return address of getinteger
+	int lv4;		// getinteger ii
+	long long lv4_address;
+getinteger:
+	lv4 = getInteger();
+	goto *ret3;
+	void* ret5;		// Return address of getfloat
+	double lv6;		// getfloat ff
+	long long lv6_address;
+getfloat:
+	lv6 = getFloat();
+	goto *ret5;
+	void* ret7;		// Return address of getstring
+	long long lv8;		// getstring ss
+	long long lv8_address;
+getstring:
+	lv8 = (long long)getString();
+	goto *ret7;
+	void* ret9;		// Return address of putbool
+	bool lv10;		// putbool b
+putbool:
+	putBool(lv10);
+	goto *ret9;
+	void* ret11;		// Return address of putinteger
+	int lv12;		// putinteger i
+putinteger:
+	putInteger(lv12);
+	goto *ret11;
+	void* ret13;		// Return address of putfloat
+	double lv14;		// putfloat f
+putfloat:
+	putFloat(lv14);
+	goto *ret13;
+	void* ret15;		// Return address of putstring
+	long long lv16;		// putstring s
+putstring:
+	putString((char*)lv16);
+	goto *ret15;
+	static int v17;		// list_size
+	static double v18;		// pivot_value
+	static int v19;		// i
+	void* ret20;		// Return address of swap
+	double lv21;		// swap num1
+	long long lv21_address;
+	double lv22;		// swap num2
+	long long lv22_address;
+	double lv23;		// swap temp
+swap:
+	lv23 = lv21;		// assign local variable
+	lv21 = lv22;		// assign parameter
+	lv22 = lv23;		// assign parameter
+	goto *ret20;		// Return from leaf
+	long long cse25;
+	double cse26;
+	double cse34;
+partition:
+	Reg[0] = (long long)MEM(int, Reg[FP] + 48) * 8;		// expression = operand1 op operand2
+	Reg[0] = (MEM(long long, Reg[FP] + 16)) + Reg[0];		// expression = operand1 op operand2
+	cse25 = Reg[0];		// Value used again
+	*((double*)&Reg[0]) = MEM(double, Reg[0]);		// Get array operand
+	cse26 = *((double*)&Reg[0]);		// Value used again
+	v18 = *((double*)&Reg[0]);		// assign local variable
+	Reg[0] = cse25;		// operand
+	*((double*)&Reg[1]) = cse26;		// Value of out argument
+	Reg[2] = (long long)MEM(int, Reg[FP] + 32) * 8;		// expression = operand1 op operand2
+	Reg[2] = (MEM(long long, Reg[FP] + 16)) + Reg[2];		// expression = operand1 op operand2
+	*((double*)&Reg[3]) = MEM(double, Reg[2]);		// Value of out argument
+	lv22 = *((double*)&Reg[3]);		// Pass argument
+	lv22_address = Reg[2];
+	lv21 = *((double*)&Reg[1]);		// Pass argument
+	lv21_address = Reg[0];
+	ret20 = &&postswap1;
+	goto swap;		// jump to leaf procedure
+postswap1:
+	MEM(double, lv21_address) = lv21;		// Store out argument
+	MEM(double, lv22_address) = lv22;		// Store out argument
+	MEM(int, Reg[FP] + 48) = (long long)MEM(int, Reg[FP] + 24);		// assign parameter
+	v19 = (long long)MEM(int, Reg[FP] + 24);		// assign local variable
+	{		// Loop invariants
+	long long iv31;
+	long long inv32;
+	long long ptr33;
+	iv31 = v19;		// Induction variable
+	inv32 = (long long)MEM(int, Reg[FP] + 32);		// Loop invariant
+	Reg[0] = iv31 * 8;		// expression = operand1 op operand2
+	Reg[0] = (MEM(long long, Reg[FP] + 16)) + Reg[0];		// expression = operand1 op operand2
+	ptr33 = Reg[0];		// Address stepped by the loop
+	if (iv31 < inv32) {
+	do {
+	Reg[0] = ptr33;		// operand
+	*((double*)&Reg[0]) = MEM(double, Reg[0]);		// Get array operand
+	cse34 = *((double*)&Reg[0]);		// Value used again
+	if (!(*((double*)&Reg[0]) <= v18)) goto else2;
+	Reg[0] = ptr33;		// operand
+	*((double*)&Reg[1]) = cse34;		// Value of out argument
+	Reg[2] = (long long)MEM(int, Reg[FP] + 48) * 8;		// expression = operand1 op operand2
+	Reg[2] = (MEM(long long, Reg[FP] + 16)) + Reg[2];		// expression = operand1 op operand2
+	*((double*)&Reg[3]) = MEM(double, Reg[2]);		// Value of out argument
+	lv22 = *((double*)&Reg[3]);		// Pass argument
+	lv22_address = Reg[2];
+	lv21 = *((double*)&Reg[1]);		// Pass argument
+	lv21_address = Reg[0];
+	ret20 = &&postswap3;
+	goto swap;		// jump to leaf procedure
+postswap3:
+	MEM(double, lv21_address) = lv21;		// Store out argument
+	MEM(double, lv22_address) = lv22;		// Store out argument
+	Reg[0] = (long long)MEM(int, Reg[FP] + 48) + 1;		// expression = operand1 op operand2
+	MEM(int, Reg[FP] + 48) = Reg[0];		// assign parameter
+else2:
+	Reg[0] = iv31 + 1;		// expression = operand1 op operand2
+	iv31 = Reg[0];		// assign local variable
+	ptr33 = ptr33 + 8;
+	} while (iv31 < inv32);
+	}
+	v19 = iv31;
+	}
+	Reg[0] = (long long)MEM(int, Reg[FP] + 48) * 8;		// expression = operand1 op operand2
+	Reg[0] = (MEM(long long, Reg[FP] + 16)) + Reg[0];		// expression = operand1 op operand2
+	*((double*)&Reg[1]) = MEM(double, Reg[0]);		// Value of out argument
+	Reg[2] = (long long)MEM(int, Reg[FP] + 32) * 8;		// expression = operand1 op operand2
+	Reg[2] = (MEM(long long, Reg[FP] + 16)) + Reg[2];		// expression = operand1 op operand2
+	*((double*)&Reg[3]) = MEM(double, Reg[2]);		// Value of out argument
+	lv22 = *((double*)&Reg[3]);		// Pass argument
+	lv22_address = Reg[2];
+	lv21 = *((double*)&Reg[1]);		// Pass argument
+	lv21_address = Reg[0];
+	ret20 = &&postswap4;
+	goto swap;		// jump to leaf procedure
+postswap4:
+	MEM(double, lv21_address) = lv21;		// Store out argument
+	MEM(double, lv22_address) = lv22;		// Store out argument
+	Reg[SP] = Reg[FP];		// Free local variables
+	Reg[FP] = MEM(long long, Reg[FP]);		// Restore Frame pointer
+	Reg[SP] = Reg[SP] + 8;		// Free space for FP
+	Reg[0] = MEM(long long, Reg[SP]);		// Pop return address off the stack
+	Reg[SP] = Reg[SP] + 8;		// Free return address space
+	goto *(void*)Reg[0];		// Return
+quick_sort:
+	Reg[SP] = Reg[FP] - 8;		// Allocate the frame
+	if (!((long long)MEM(int, Reg[FP] + 32) > (long long)MEM(int, Reg[FP] + 24))) goto else5;
+	Reg[0] = (long long)MEM(int, Reg[FP] + 32) - (long long)MEM(int, Reg[FP] + 24);		// expression = operand1 op operand2
+	Reg[0] = Reg[0] / 2;		// expression = operand1 op operand2
+	Reg[0] = (long long)MEM(int, Reg[FP] + 24) + Reg[0];		// expression = operand1 op operand2
+	MEM(int, Reg[FP] - 8) = Reg[0];		// assign local variable
+	Reg[0] = (MEM(long long, Reg[FP] + 16));		// operand
+	Reg[1] = (long long)MEM(int, Reg[FP] + 24);		// operand
+	Reg[2] = (long long)MEM(int, Reg[FP] + 32);		// operand
+	Reg[3] = (Reg[FP] - 8);		// operand
+	Reg[4] = MEM(int, Reg[3]);		// Value of out argument
+	Reg[SP] = Reg[SP] - 8;		// Make space on stack for argument
+	MEM(int, Reg[SP]) = Reg[4];		// Move argument to stack
+	Reg[SP] = Reg[SP] - 8;		// Allocate space for out param address
+	MEM(long long, Reg[SP]) = Reg[3];		// Push address for out parameter onto stack
+	Reg[SP] = Reg[SP] - 8;		// Make space on stack for argument
+	MEM(int, Reg[SP]) = Reg[2];		// Move argument to stack
+	Reg[SP] = Reg[SP] - 8;		// Make space on stack for argument
+	MEM(int, Reg[SP]) = Reg[1];		// Move argument to stack
+	Reg[SP] = Reg[SP] - 8;
+	MEM(long long, Reg[SP]) = Reg[0];		// Pass array by reference
+	Reg[SP] = Reg[SP] - 8;		// Allocate space for return address
+	Reg[0] = (long long)&&postpartition6;
+	MEM(long long, Reg[SP]) = Reg[0];		// save return address
+	Reg[SP] = Reg[SP] - 8;		// Allocate space for FP
+	MEM(long long, Reg[SP]) = Reg[FP];		// Save frame pointer
+	Reg[FP] = Reg[SP];		// Move frame pointer to new position
+	goto partition;		// jump to procedure
+postpartition6:
+	Reg[SP] = Reg[SP] + 8;		// Free array reference
+	Reg[SP] = Reg[SP] + 8;		// Free input parameter
+	Reg[SP] = Reg[SP] + 8;		// Free input parameter
+	Reg[0] = MEM(long long, Reg[SP]);		// Get address of out param off stack
+	Reg[SP] = Reg[SP] + 8;
+	MEM(int, Reg[0]) = MEM(int, Reg[SP]);		// Get out param off stack
+	Reg[SP] = Reg[SP] + 8;		// Free output parameter
+	Reg[0] = (MEM(long long, Reg[FP] + 16));		// operand
+	Reg[1] = (long long)MEM(int, Reg[FP] + 24);		// operand
+	Reg[2] = (long long)MEM(int, Reg[FP] - 8) - 1;		// expression = operand1 op operand2
+	Reg[SP] = Reg[SP] - 8;		// Make space on stack for argument
+	MEM(int, Reg[SP]) = Reg[2];		// Move argument to stack
+	Reg[SP] = Reg[SP] - 8;		// Make space on stack for argument
+	MEM(int, Reg[SP]) = Reg[1];		// Move argument to stack
+	Reg[SP] = Reg[SP] - 8;
+	MEM(long long, Reg[SP]) = Reg[0];		// Pass array by reference
+	Reg[SP] = Reg[SP] - 8;		// Allocate space for return address
+	Reg[0] = (long long)&&postquick_sort7;
+	MEM(long long, Reg[SP]) = Reg[0];		// save return address
+	Reg[SP] = Reg[SP] - 8;		// Allocate space for FP
+	MEM(long long, Reg[SP]) = Reg[FP];		// Save frame pointer
+	Reg[FP] = Reg[SP];		// Move frame pointer to new position
+	goto quick_sort;		// jump to procedure
+postquick_sort7:
+	Reg[SP] = Reg[SP] + 8;		// Free array reference
+	Reg[SP] = Reg[SP] + 8;		// Free input parameter
+	Reg[SP] = Reg[SP] + 8;		// Free input parameter
+	Reg[0] = (MEM(long long, Reg[FP] + 16));		// operand
+	Reg[1] = (long long)MEM(int, Reg[FP] - 8) + 1;		// expression = operand1 op operand2
+	Reg[2] = (long long)MEM(int, Reg[FP] + 32);		// operand
+	MEM(int, Reg[FP] + 24) = Reg[1];		// Overwrite parameter in own frame
+	Reg[SP] = Reg[FP];		// Free local variables
+	goto quick_sort;		// Tail call, reuse frame
+else5:
+	Reg[SP] = Reg[FP];		// Free local variables
+	Reg[FP] = MEM(long long, Reg[FP]);		// Restore Frame pointer
+	Reg[SP] = Reg[SP] + 8;		// Free space for FP
+	Reg[0] = MEM(long long, Reg[SP]);		// Pop return address off the stack
+	Reg[SP] = Reg[SP] + 8;		// Free return address space
+	goto *(void*)Reg[0];		// Return
+	static int v51;		// i
+printlist:
+	v51 = 0;		// assign local variable
+	{		// Loop invariants
+	long long iv52;
+	long long ptr53;
+	iv52 = v51;		// Induction variable
+	Reg[0] = iv52 * 8;		// expression = operand1 op operand2
+	Reg[0] = (MEM(long long, Reg[FP] + 16)) + Reg[0];		// expression = operand1 op operand2
+	ptr53 = Reg[0];		// Address stepped by the loop
+	if (iv52 < 8) {
+	do {
+	Reg[0] = ptr53;		// operand
+	*((double*)&Reg[0]) = MEM(double, Reg[0]);		// Get array operand
+	lv14 = *((double*)&Reg[0]);		// Pass argument
+	ret13 = &&postputfloat9;
+	goto putfloat;		// jump to leaf procedure
+postputfloat9:
+	Reg[0] = (long long)&MEM(char, 0);		// operand
+	lv16 = Reg[0];		// Pass argument
+	ret15 = &&postputstring10;
+	goto putstring;		// jump to leaf procedure
+postputstring10:
+	Reg[0] = iv52 + 1;		// expression = operand1 op operand2
+	iv52 = Reg[0];		// assign local variable
+	ptr53 = ptr53 + 8;
+	} while (iv52 < 8);
+	}
+	v51 = iv52;
+	}
+	Reg[0] = (long long)&MEM(char, 3);		// operand
+	lv16 = Reg[0];		// Pass argument
+	ret15 = &&postputstring11;
+	goto putstring;		// jump to leaf procedure
+postputstring11:
+	Reg[SP] = Reg[FP];		// Free local variables
+	Reg[FP] = MEM(long long, Reg[FP]);		// Restore Frame pointer
+	Reg[SP] = Reg[SP] + 8;		// Free space for FP
+	Reg[0] = MEM(long long, Reg[SP]);		// Pop return address off the stack
+	Reg[SP] = Reg[SP] + 8;		// Free return address space
+	goto *(void*)Reg[0];		// Return
+	static int v55;		// i
+getlist:
+	Reg[SP] = Reg[FP] - 8;		// Allocate the frame
+	v55 = 0;		// assign local variable
+	{		// Loop invariants
+	long long iv56;
+	long long inv57;
+	long long ptr58;
+	iv56 = v55;		// Induction variable
+	inv57 = (Reg[FP] - 8);		// Loop invariant
+	Reg[0] = iv56 * 8;		// expression = operand1 op operand2
+	Reg[0] = (MEM(long long, Reg[FP] + 16)) + Reg[0];		// expression = operand1 op operand2
+	ptr58 = Reg[0];		// Address stepped by the loop
+	if (iv56 < (long long)v17) {
+	do {
+	Reg[0] = (long long)&MEM(char, 6);		// operand
+	lv16 = Reg[0];		// Pass argument
+	ret15 = &&postputstring12;
+	goto putstring;		// jump to leaf procedure
+postputstring12:
+	Reg[0] = iv56;		// operand
+	lv12 = Reg[0];		// Pass argument
+	ret11 = &&postputinteger13;
+	goto putinteger;		// jump to leaf procedure
+postputinteger13:
+	Reg[0] = (long long)&MEM(char, 13);		// operand
+	lv16 = Reg[0];		// Pass argument
+	ret15 = &&postputstring14;
+	goto putstring;		// jump to leaf procedure
+postputstring14:
+	Reg[0] = inv57;		// operand
+	*((double*)&Reg[1]) = MEM(double, Reg[0]);		// Value of out argument
+	lv6 = *((double*)&Reg[1]);		// Pass argument
+	lv6_address = Reg[0];
+	ret5 = &&postgetfloat15;
+	goto getfloat;		// jump to leaf procedure
+postgetfloat15:
+	MEM(double, lv6_address) = lv6;		// Store out argument
+	MEM(double, ptr58) = MEM(double, Reg[FP] - 8);		// list + offset = expression
+	Reg[0] = iv56 + 1;		// expression = operand1 op operand2
+	iv56 = Reg[0];		// assign local variable
+	ptr58 = ptr58 + 8;
+	} while (iv56 < (long long)v17);
+	}
+	v55 = iv56;
+	}
+	Reg[SP] = Reg[FP];		// Free local variables
+	Reg[FP] = MEM(long long, Reg[FP]);		// Restore Frame pointer
+	Reg[SP] = Reg[SP] + 8;		// Free space for FP
+	Reg[0] = MEM(long long, Reg[SP]);		// Pop return address off the stack
+	Reg[SP] = Reg[SP] + 8;		// Free return address space
+	goto *(void*)Reg[0];		// Return
+start:
+	init(static_data());		// Static memory is only known once the whole program is parsed
+	Reg[SP] = Reg[FP] - 120;		// Allocate the frame
+	v17 = 8;		// assign static
+	Reg[0] = (((Reg[FP] - 57) & -64));		// operand
+	Reg[SP] = Reg[SP] - 8;
+	MEM(long long, Reg[SP]) = Reg[0];		// Pass array by reference
+	Reg[SP] = Reg[SP] - 8;		// Allocate space for return address
+	Reg[0] = (long long)&&postgetlist16;
+	MEM(long long, Reg[SP]) = Reg[0];		// save return address
+	Reg[SP] = Reg[SP] - 8;		// Allocate space for FP
+	MEM(long long, Reg[SP]) = Reg[FP];		// Save frame pointer
+	Reg[FP] = Reg[SP];		// Move frame pointer to new position
+	goto getlist;		// jump to procedure
+postgetlist16:
+	Reg[SP] = Reg[SP] + 8;		// Free array reference
+	Reg[0] = (((Reg[FP] - 57) & -64));		// operand
+	Reg[SP] = Reg[SP] - 8;
+	MEM(long long, Reg[SP]) = Reg[0];		// Pass array by reference
+	Reg[SP] = Reg[SP] - 8;		// Allocate space for return address
+	Reg[0] = (long long)&&postprintlist17;
+	MEM(long long, Reg[SP]) = Reg[0];		// save return address
+	Reg[SP] = Reg[SP] - 8;		// Allocate space for FP
+	MEM(long long, Reg[SP]) = Reg[FP];		// Save frame pointer
+	Reg[FP] = Reg[SP];		// Move frame pointer to new position
+	goto printlist;		// jump to procedure
+postprintlist17:
+	Reg[SP] = Reg[SP] + 8;		// Free array reference
+	Reg[0] = (((Reg[FP] - 57) & -64));		// operand
+	Reg[1] = 0;		// operand
+	Reg[2] = (long long)v17 - 1;		// expression = operand1 op operand2
+	Reg[SP] = Reg[SP] - 8;		// Make space on stack for argument
+	MEM(int, Reg[SP]) = Reg[2];		// Move argument to stack
+	Reg[SP] = Reg[SP] - 8;		// Make space on stack for argument
+	MEM(int, Reg[SP]) = Reg[1];		// Move argument to stack
+	Reg[SP] = Reg[SP] - 8;
+	MEM(long long, Reg[SP]) = Reg[0];		// Pass array by reference
+	Reg[SP] = Reg[SP] - 8;		// Allocate space for return address
+	Reg[0] = (long long)&&postquick_sort18;
+	MEM(long long, Reg[SP]) = Reg[0];		// save return address
+	Reg[SP] = Reg[SP] - 8;		// Allocate space for FP
+	MEM(long long, Reg[SP]) = Reg[FP];		// Save frame pointer
+	Reg[FP] = Reg[SP];		// Move frame pointer to new position
+	goto quick_sort;		// jump to procedure
+postquick_sort18:
+	Reg[SP] = Reg[SP] + 8;		// Free array reference
+	Reg[SP] = Reg[SP] + 8;		// Free input parameter
+	Reg[SP] = Reg[SP] + 8;		// Free input parameter
+	Reg[0] = (((Reg[FP] - 57) & -64));		// operand
+	Reg[SP] = Reg[SP] - 8;
+	MEM(long long, Reg[SP]) = Reg[0];		// Pass array by reference
+	Reg[SP] = Reg[SP] - 8;		// Allocate space for return address
+	Reg[0] = (long long)&&postprintlist19;
+	MEM(long long, Reg[SP]) = Reg[0];		// save return address
+	Reg[SP] = Reg[SP] - 8;		// Allocate space for FP
+	MEM(long long, Reg[SP]) = Reg[FP];		// Save frame pointer
+	Reg[FP] = Reg[SP];		// Move frame pointer to new position
+	goto printlist;		// jump to procedure
+postprintlist19:
+	Reg[SP] = Reg[SP] + 8;		// Free array reference
+	return 0;
+}
+
+long long static_data()
+{
+	strcpy(&MEM(char, 0), "  ");
+	strcpy(&MEM(char, 13), ": ");
+	strcpy(&MEM(char, 3), "\n");
+	strcpy(&MEM(char, 6), "index ");
+	return 16;
+}
@@ -1,17 +1,12 @@
-#include <stdbool.h>
+// Built once into libruntime.a, which every compiled program is linked with
 #include <stdio.h>
-#include <string.h>
 #include <stdlib.h>
+#include "runtime.h"
 
-#define NUM_REGS 32
-#define MEM_SIZE 1024*1024
 long long Reg[NUM_REGS];
-long long MM[MEM_SIZE];
-#define SP NUM_REGS-1
-#define FP NUM_REGS-2
+long long MM[MEM_SIZE] __attribute__((aligned(64)));
 
 long long heap_pointer;
-long long heapAlloc(long long size);
 
 bool getBool()
 {
@@ -38,9 +33,9 @@ float getFloat()
 
 char* getString()
 {
-  long long address = heapAlloc(8); // 64 bytes
-  scanf("%s", (char*)&MM[address]);
-  return (char*)&MM[address];
+  long long address = heapAlloc(64);
+  scanf("%63s", &MEM(char, address));
+  return &MEM(char, address);
 }
 
 int putBool(bool b)
@@ -73,8 +68,8 @@ int putString(char* s)
 
 void init(long long start_address)
 {
-  Reg[SP] = MEM_SIZE;
-  Reg[FP] = MEM_SIZE;
+  Reg[SP] = sizeof(MM);
+  Reg[FP] = sizeof(MM);
   heap_pointer = start_address;
 }
 
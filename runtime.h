@@ -0,0 +1,29 @@
+#ifndef RUNTIME_H
+#define RUNTIME_H
+
+#include <stdbool.h>
+#include <string.h>
+
+#define NUM_REGS 32
+#define MEM_SIZE 1024*1024
+extern long long Reg[NUM_REGS];
+extern long long MM[MEM_SIZE] __attribute__((aligned(64))); // Cache line aligned, so frame addresses rounded to 64 are too
+#define SP NUM_REGS-1
+#define FP NUM_REGS-2
+
+// Memory is addressed in bytes, each value is read and written at its own size
+#define MEM(type, address) (*(type*)((char*)MM + (address)))
+
+bool getBool();
+int getInteger();
+float getFloat();
+char* getString();
+int putBool(bool b);
+int putInteger(int i);
+int putFloat(float f);
+int putString(char* s);
+void init(long long start_address);
+long long heapAlloc(long long size);
+void dataConversionCheck(long long num);
+
+#endif
@@ -4,60 +4,61 @@
 
 #include "scanner.h"
 
-std::ifstream Scanner::input_file;
-int Scanner::line_number;
-
-Scanner::Scanner(std::string filename)
+Scanner::Scanner(Compilation& compilation) : context(compilation), reserved_words(keywords())
 {
-  init(filename);
-  line_number = 1;
-  num_errors = 0;
-  num_warnings = 0;
+  init(context.filename);
+  quiet = false;
 }
 
 Scanner::~Scanner()
 {
-  reserved_words.clear();
-  input_file.close();
+  delete input;
 }
 
 bool Scanner::init(std::string filename)
 {
   file_name = filename;
   
-  input_file.open(file_name, std::ios_base::in);
- 
-  // Setup reserved words table
-  reserve(RESERVED_STRING, "string");
-  reserve(RESERVED_INT, "integer");
-  reserve(RESERVED_BOOL, "bool");
-  reserve(RESERVED_FLOAT, "float");
-  reserve(RESERVED_GLOBAL, "global");
-  reserve(RESERVED_IN, "in");
-  reserve(RESERVED_OUT, "out");
-  reserve(RESERVED_IF, "if");
-  reserve(RESERVED_THEN, "then");
-  reserve(RESERVED_ELSE, "else");
-  reserve(RESERVED_CASE, "case");
-  reserve(RESERVED_FOR, "for");
-  reserve(RESERVED_AND, "and");
-  reserve(RESERVED_OR, "or" );
-  reserve(RESERVED_NOT, "not");
-  reserve(RESERVED_PROGRAM, "program");
-  reserve(RESERVED_PROCEDURE, "procedure");
-  reserve(RESERVED_BEGIN, "begin");
-  reserve(RESERVED_RETURN, "return");
-  reserve(RESERVED_END, "end");
-  reserve(RESERVED_IS, "is");
-  reserve(RESERVED_FALSE, "false");
-  reserve(RESERVED_TRUE, "true");
+  input = open();
   
   return true;
 }
 
-void Scanner::reserve(type_t type, std::string word)
+// Reserved words, built when the first scanner is created and shared by every scanner after it
+const word_map& Scanner::keywords()
 {
-  reserved_words[word] = type;  
+  static const word_map words = {
+    {"string", RESERVED_STRING},
+    {"integer", RESERVED_INT},
+    {"int8", RESERVED_INT}, // Sized integers, the token string gives the size
+    {"int16", RESERVED_INT},
+    {"int32", RESERVED_INT},
+    {"int64", RESERVED_INT},
+    {"bool", RESERVED_BOOL},
+    {"float", RESERVED_FLOAT},
+    {"global", RESERVED_GLOBAL},
+    {"in", RESERVED_IN},
+    {"out", RESERVED_OUT},
+    {"if", RESERVED_IF},
+    {"then", RESERVED_THEN},
+    {"else", RESERVED_ELSE},
+    {"case", RESERVED_CASE},
+    {"for", RESERVED_FOR},
+    {"and", RESERVED_AND},
+    {"or", RESERVED_OR},
+    {"not", RESERVED_NOT},
+    {"program", RESERVED_PROGRAM},
+    {"module", RESERVED_MODULE},
+    {"import", RESERVED_IMPORT},
+    {"procedure", RESERVED_PROCEDURE},
+    {"begin", RESERVED_BEGIN},
+    {"return", RESERVED_RETURN},
+    {"end", RESERVED_END},
+    {"is", RESERVED_IS},
+    {"false", RESERVED_FALSE},
+    {"true", RESERVED_TRUE},
+  };
+  return words;
 }
 
 bool Scanner::is_reserved(std::string word)
@@ -76,13 +77,22 @@ type_t Scanner::get_reserved_type(std::string word)
   return reserved_words_iterator->second;
 }
 
-void Scanner::report_warning(std::string message)
+// The source from its start, from memory when the compilation holds it
+std::istream* Scanner::open()
+{
+  if (context.source)
+    return new std::istringstream(*context.source);
+  return new std::ifstream(file_name.c_str(), std::ios_base::in);
+}
+
+void Scanner::report_warning(int line, std::string message)
 {
-  std::cerr << "WARNING: " << message;
-  num_warnings++;
+  if (!context.warnings)
+    return;
+  context.diagnose(DIAGNOSTIC_WARNING, line, message);
 }
 
-Token* Scanner::get_token(std::ifstream& ifs)
+Token* Scanner::get_token(std::istream& ifs)
 {  
   int i, ch;
   Token* token = NULL;
@@ -94,7 +104,7 @@ Token* Scanner::get_token(std::ifstream& ifs)
   }
 
   if (ch == '\n' || ch == '\r') {
-    line_number++;
+    context.line_number++;
     return get_token(ifs);
   }
   
@@ -139,6 +149,7 @@ Token* Scanner::get_token(std::ifstream& ifs)
       if (is_reserved(word)) {
         type_t t = get_reserved_type(word);
         token = new Token(t);
+        token->string = word;
       }
       else {
         token = new Token(TOK_IDENTIFIER);
@@ -157,7 +168,7 @@ Token* Scanner::get_token(std::ifstream& ifs)
       }
 
       if (ch != '"') {
-        syntax_error("Invalid string constant at line "+std::to_string(line_number)+"\n");
+        syntax_error("Invalid string constant at line "+std::to_string(context.line_number)+"\n");
       }
     }
     else if (ch == '!') {
@@ -167,7 +178,7 @@ Token* Scanner::get_token(std::ifstream& ifs)
         token->value.relop = NOT_EQUAL;
       }
       else {
-        syntax_error("Invalid token at line "+std::to_string(line_number)+"\n");
+        syntax_error("Invalid token at line "+std::to_string(context.line_number)+"\n");
         return get_token(ifs);
       }
     }
@@ -178,7 +189,7 @@ Token* Scanner::get_token(std::ifstream& ifs)
         token->value.relop = IS_EQUAL;
       }
       else {
-        syntax_error("Invalid token at line "+std::to_string(line_number)+"\n");
+        syntax_error("Invalid token at line "+std::to_string(context.line_number)+"\n");
         return get_token(ifs);
       }
     }
@@ -253,7 +264,7 @@ Token* Scanner::get_token(std::ifstream& ifs)
       token = new Token(TOK_OR);
     else {
       char* mesg = new char[32];
-      sprintf(mesg, "Unknown token '%c' at line %d", ch, line_number);
+      sprintf(mesg, "Unknown token '%c' at line %d", ch, context.line_number);
       syntax_error(mesg);
       delete [] mesg;
       return get_token(ifs);
@@ -261,19 +272,22 @@ Token* Scanner::get_token(std::ifstream& ifs)
   }
   else {
     char* mesg = new char[32];
-    sprintf(mesg, "Unknown token '%c' at line %d\n", ch, line_number);
+    sprintf(mesg, "Unknown token '%c' at line %d\n", ch, context.line_number);
     syntax_error(mesg);
     delete [] mesg;
     return get_token(ifs);
   }
   
+  token->line = context.line_number;
   return token;
 }
 
 void Scanner::syntax_error(std::string mesg)
 {
-  std::cerr << "ERROR: " << mesg;
-  num_errors++;
+  if (!quiet)
+    context.diagnose(DIAGNOSTIC_ERROR, context.line_number, mesg, false);
+  else
+    context.num_errors++;
 }
 
 std::string& Scanner::print_token(type_t type, std::string& string)
@@ -326,6 +340,10 @@ std::string& Scanner::print_token(type_t type, std::string& string)
     string = "'not'";
   else if (type == RESERVED_PROGRAM)
     string = "'program'";
+  else if (type == RESERVED_MODULE)
+    string = "'module'";
+  else if (type == RESERVED_IMPORT)
+    string = "'import'";
   else if (type == RESERVED_PROCEDURE)
     string = "'procedure'";
   else if (type == RESERVED_BEGIN)
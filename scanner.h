@@ -2,8 +2,10 @@
 #define SCANNER_H
 
 #include <fstream>
+#include <sstream>
 
 #include "symbol.h"
+#include "compilation.h"
 
 enum relative_op_t {
   IS_EQUAL,
@@ -16,9 +18,10 @@ enum relative_op_t {
 
 class Token {
  public:
-    Token(type_t t){ type = t; }
+    Token(type_t t){ type = t; line = 0; }
     
     type_t type;
+    int line; // Line it was scanned on, restored when the token is parsed again
     union value_t {
       int int_value;
       double float_value;
@@ -27,38 +30,37 @@ class Token {
     std::string string;
 };
 
-typedef std::unordered_map<std::string, type_t>::iterator word_iterator;
+typedef std::unordered_map<std::string, type_t>::const_iterator word_iterator;
 typedef std::unordered_map<std::string, type_t> word_map;
 
 class Scanner {
   public:
-    Scanner(std::string filename);
+    Scanner(Compilation& compilation);
     ~Scanner();
   
     bool init(std::string filename);
     
-    static void report_warning(std::string message);
+    void report_warning(int line, std::string message);
     void syntax_error(std::string mesg);
     
-    static std::string& print_token(type_t type, std::string& string);
-    static std::ifstream input_file;
-    static int line_number;
-    static int num_errors;
+    bool quiet; // Don't print syntax errors, used when pre-scanning
     
-    static bool warnings;
-    static int num_warnings;
+    static std::string& print_token(type_t type, std::string& string);
+    std::istream* open();
+    std::istream* input;
   
-    Token* get_token(std::ifstream& ifs);
+    Token* get_token(std::istream& ifs);
     
   protected:
-    void reserve(type_t type, std::string word);
+    static const word_map& keywords();
     bool is_reserved(std::string word);
     type_t get_reserved_type(std::string word);
   
   private:
+    Compilation& context;
     std::string file_name;
     
-    word_map reserved_words;
+    const word_map& reserved_words;
     word_iterator reserved_words_iterator;
 };
 
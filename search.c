@@ -0,0 +1,178 @@
+#include "runtime.h"
+
+long long static_data();
+
+int main() {
+	goto start;
+	void* ret1;		// Return address of getbool
+	bool lv2;		// getbool bb
+	long long lv2_address;
+getbool:
+	lv2 = getBool();
+	goto *ret1;
+	void* ret3;		// Return address of getinteger
+	int lv4;		// getinteger ii
+	long long lv4_address;
+getinteger:
+	lv4 = getInteger();
+	goto *ret3;
+	void* ret5;		// Return address of getfloat
+	double lv6;		// getfloat ff
+	long long lv6_address;
+getfloat:
+	lv6 = getFloat();
+	goto *ret5;
+	void* ret7;		// Return address of getstring
+	long long lv8;		// getstring ss
+	long long lv8_address;
+getstring:
+	lv8 = (long long)getString();
+	goto *ret7;
+	void* ret9;		// Return address of putbool
+	bool lv10;		// putbool b
+putbool:
+	putBool(lv10);
+	goto *ret9;
+	void* ret11;		// Return address of putinteger
+	int lv12;		// putinteger i
+putinteger:
+	putInteger(lv12);
+	goto *ret11;
+	void* ret13;		// Return address of putfloat
+	double lv14;		// putfloat f
+putfloat:
+	putFloat(lv14);
+	goto *ret13;
+	void* ret15;		// Return address of putstring
+	long long lv16;		// putstring s
+putstring:
+	putString((char*)lv16);
+	goto *ret15;
+	void* ret17;		// Return address of linear_search
+	long long lv18;		// linear_search list
+	int lv19;		// linear_search search_id
+	long long lv20;		// linear_search aname
+	long long lv20_address;
+	int lv21;		// linear_search curr_id
+	int lv22;		// linear_search index
+	long long lv23;		// linear_search msg
+linear_search:
+	lv23 = (long long)&MEM(char, 64);		// assign local variable
+	lv22 = 0;		// assign local variable
+	{		// Loop invariants
+	long long iv24;
+	long long ptr25;
+	long long ptr27;
+	iv24 = lv22;		// Induction variable
+	Reg[0] = iv24 * 4;		// expression = operand1 op operand2
+	Reg[0] = (lv18) + Reg[0];		// expression = operand1 op operand2
+	ptr25 = Reg[0];		// Address stepped by the loop
+	Reg[0] = iv24 * 8;		// expression = operand1 op operand2
+	Reg[0] = 0 + Reg[0];		// expression = operand1 op operand2
+	ptr27 = Reg[0];		// Address stepped by the loop
+	if (iv24 < 8) {
+	do {
+	Reg[0] = ptr25;		// operand
+	Reg[0] = MEM(int, Reg[0]);		// Get array operand
+	lv21 = Reg[0];		// assign local variable
+	if (!((long long)lv21 == (long long)lv19)) goto else1;
+	Reg[0] = ptr27;		// operand
+	Reg[0] = MEM(long long, Reg[0]);		// Get array operand
+	lv20 = Reg[0];		// assign parameter
+	lv22 = iv24;
+	goto *ret17;		// Return from leaf
+else1:
+	Reg[0] = iv24 + 1;		// expression = operand1 op operand2
+	iv24 = Reg[0];		// assign local variable
+	ptr25 = ptr25 + 4;
+	ptr27 = ptr27 + 8;
+	} while (iv24 < 8);
+	}
+	lv22 = iv24;
+	}
+	lv20 = lv23;		// assign parameter
+	goto *ret17;		// Return from leaf
+start:
+	init(static_data());		// Static memory is only known once the whole program is parsed
+	Reg[SP] = Reg[FP] - 40;		// Allocate the frame
+	Reg[0] = 0 * 4;		// expression = operand1 op operand2
+	Reg[0] = (Reg[FP] - 32) + Reg[0];		// expression = operand1 op operand2
+	MEM(int, Reg[0]) = 3729;		// id + offset = expression
+	Reg[0] = 1 * 4;		// expression = operand1 op operand2
+	Reg[0] = (Reg[FP] - 32) + Reg[0];		// expression = operand1 op operand2
+	MEM(int, Reg[0]) = 9837;		// id + offset = expression
+	Reg[0] = 2 * 4;		// expression = operand1 op operand2
+	Reg[0] = (Reg[FP] - 32) + Reg[0];		// expression = operand1 op operand2
+	MEM(int, Reg[0]) = 2094;		// id + offset = expression
+	Reg[0] = 3 * 4;		// expression = operand1 op operand2
+	Reg[0] = (Reg[FP] - 32) + Reg[0];		// expression = operand1 op operand2
+	MEM(int, Reg[0]) = 3043;		// id + offset = expression
+	Reg[0] = 4 * 4;		// expression = operand1 op operand2
+	Reg[0] = (Reg[FP] - 32) + Reg[0];		// expression = operand1 op operand2
+	MEM(int, Reg[0]) = 283;		// id + offset = expression
+	Reg[0] = 5 * 4;		// expression = operand1 op operand2
+	Reg[0] = (Reg[FP] - 32) + Reg[0];		// expression = operand1 op operand2
+	MEM(int, Reg[0]) = 5049;		// id + offset = expression
+	Reg[0] = 6 * 4;		// expression = operand1 op operand2
+	Reg[0] = (Reg[FP] - 32) + Reg[0];		// expression = operand1 op operand2
+	MEM(int, Reg[0]) = 2424;		// id + offset = expression
+	Reg[0] = 7 * 4;		// expression = operand1 op operand2
+	Reg[0] = (Reg[FP] - 32) + Reg[0];		// expression = operand1 op operand2
+	MEM(int, Reg[0]) = 9134;		// id + offset = expression
+	Reg[0] = 0 * 8;		// expression = operand1 op operand2
+	Reg[0] = 0 + Reg[0];		// expression = operand1 op operand2
+	MEM(long long, Reg[0]) = (long long)&MEM(char, 74);		// name + offset = expression
+	Reg[0] = 1 * 8;		// expression = operand1 op operand2
+	Reg[0] = 0 + Reg[0];		// expression = operand1 op operand2
+	MEM(long long, Reg[0]) = (long long)&MEM(char, 78);		// name + offset = expression
+	Reg[0] = 2 * 8;		// expression = operand1 op operand2
+	Reg[0] = 0 + Reg[0];		// expression = operand1 op operand2
+	MEM(long long, Reg[0]) = (long long)&MEM(char, 85);		// name + offset = expression
+	Reg[0] = 3 * 8;		// expression = operand1 op operand2
+	Reg[0] = 0 + Reg[0];		// expression = operand1 op operand2
+	MEM(long long, Reg[0]) = (long long)&MEM(char, 90);		// name + offset = expression
+	Reg[0] = 4 * 8;		// expression = operand1 op operand2
+	Reg[0] = 0 + Reg[0];		// expression = operand1 op operand2
+	MEM(long long, Reg[0]) = (long long)&MEM(char, 94);		// name + offset = expression
+	Reg[0] = 5 * 8;		// expression = operand1 op operand2
+	Reg[0] = 0 + Reg[0];		// expression = operand1 op operand2
+	MEM(long long, Reg[0]) = (long long)&MEM(char, 102);		// name + offset = expression
+	Reg[0] = 6 * 8;		// expression = operand1 op operand2
+	Reg[0] = 0 + Reg[0];		// expression = operand1 op operand2
+	MEM(long long, Reg[0]) = (long long)&MEM(char, 108);		// name + offset = expression
+	Reg[0] = 7 * 8;		// expression = operand1 op operand2
+	Reg[0] = 0 + Reg[0];		// expression = operand1 op operand2
+	MEM(long long, Reg[0]) = (long long)&MEM(char, 116);		// name + offset = expression
+	Reg[0] = (Reg[FP] - 32);		// operand
+	Reg[1] = 5049;		// operand
+	Reg[2] = (Reg[FP] - 40);		// operand
+	Reg[3] = MEM(long long, Reg[2]);		// Value of out argument
+	lv20 = Reg[3];		// Pass argument
+	lv20_address = Reg[2];
+	lv19 = Reg[1];		// Pass argument
+	lv18 = Reg[0];		// Pass array by reference
+	ret17 = &&postlinear_search2;
+	goto linear_search;		// jump to leaf procedure
+postlinear_search2:
+	MEM(long long, lv20_address) = lv20;		// Store out argument
+	Reg[0] = MEM(long long, Reg[FP] - 40);		// operand
+	lv16 = Reg[0];		// Pass argument
+	ret15 = &&postputstring3;
+	goto putstring;		// jump to leaf procedure
+postputstring3:
+	return 0;
+}
+
+long long static_data()
+{
+	strcpy(&MEM(char, 74), "Bob");
+	strcpy(&MEM(char, 116), "Elizabeth");
+	strcpy(&MEM(char, 78), "George");
+	strcpy(&MEM(char, 102), "Jerry");
+	strcpy(&MEM(char, 90), "Joe");
+	strcpy(&MEM(char, 85), "Mary");
+	strcpy(&MEM(char, 94), "Melinda");
+	strcpy(&MEM(char, 64), "Not found");
+	strcpy(&MEM(char, 108), "Richard");
+	return 126;
+}
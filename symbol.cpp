@@ -8,12 +8,17 @@ Symbol::Symbol(std::string nm, bool global, bool isarray, type_t typ, unsigned i
   symbol_type.set_type(typ);
   symbol_type.set_array(isarray);
   symbol_type.set_arraysize(size);
-  width = size;
+  symbol_type.set_size(Type::natural_size(typ));
+  width = size * symbol_type.size();
   used = false;
   initialized = false;
+  modified = false;
+  reference = false;
+  leaf = false;
   direction = DIRECTION_UNSPECIFIED;
   params = NULL;
   next = NULL;
+  body = NULL;
   address = 0;
   ref_count = 0;
   line_declared = 0;
@@ -27,12 +32,17 @@ Symbol::Symbol(std::string nm, bool isarray, type_t typ, unsigned int size)
   symbol_type.set_type(typ);
   symbol_type.set_array(isarray);
   symbol_type.set_arraysize(size);
-  width = size;
+  symbol_type.set_size(Type::natural_size(typ));
+  width = size * symbol_type.size();
   used = false;
   initialized = false;
+  modified = false;
+  reference = false;
+  leaf = false;
   direction = DIRECTION_UNSPECIFIED;
   params = NULL;
   next = NULL;
+  body = NULL;
   address = 0;
   ref_count = 0;
   line_declared = 0;
@@ -45,21 +55,35 @@ Symbol::Symbol(std::string nm, bool global)
   is_global = global;
   symbol_type.set_array(false);
   symbol_type.set_arraysize(1);
+  symbol_type.set_size(0);
+  width = 0;
   used = false;
   initialized = false;
+  modified = false;
+  reference = false;
+  leaf = false;
   direction = DIRECTION_UNSPECIFIED;
   params = NULL;
   next = NULL;
+  body = NULL;
   address = 0;
   ref_count = 0;
   line_declared = 0;
 }
 
+// Sized integers are narrower, see Symbol::set_element_size
+void Symbol::set_element_size(unsigned int size)
+{
+  symbol_type.set_size(size);
+  width = symbol_type.arraysize() * size;
+}
+
 Type::Type(type_t t, bool array, unsigned int size)
 { 
   variable_type = t;
   is_array = array;
   array_size = size;
+  element_size = natural_size(t);
   symbol = false;
 }
 
@@ -67,20 +91,38 @@ Type::Type(const Type& type)
 {
   is_array = type.is_array;
   variable_type = type.variable_type;
-  array_size = array_size;
+  array_size = type.array_size;
+  element_size = type.element_size;
+  symbol = type.symbol;
 }
     
 Type& Type::operator=(const Type& type)
 {
   is_array = type.is_array;
   variable_type = type.variable_type;
-  array_size = array_size;
+  array_size = type.array_size;
+  element_size = type.element_size;
+  symbol = type.symbol;
   return *this;
 }
+
+unsigned int Type::natural_size(type_t t)
+{
+  switch (t) {
+    case TYPE_BOOL:
+      return 1;
+    case TYPE_INT:
+      return 4;
+    default: // Floats are doubles, strings are addresses
+      return 8;
+  }
+}
       
+// Scalars of any size convert on assignment, arrays share memory so their elements must be the same size
 bool Type::operator==(const Type& type)
 {
-  return ((is_array == type.is_array) && (variable_type == type.variable_type) && (array_size == type.array_size));
+  return ((is_array == type.is_array) && (variable_type == type.variable_type) && (array_size == type.array_size)
+    && (!is_array || element_size == type.element_size));
 }
 
 bool Type::operator!=(const Type& type) 
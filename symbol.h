@@ -52,6 +52,8 @@ enum type_t {
   RESERVED_BEGIN = 287,
   RESERVED_RETURN = 288,
   RESERVED_END = 289,
+  RESERVED_MODULE = 300,
+  RESERVED_IMPORT = 301,
   
   // Identifiers, and types
   TOK_IDENTIFIER = 290,
@@ -63,6 +65,8 @@ enum type_t {
   TOK_EOF = 310,
 };
 
+struct Procedure_body;
+
 enum id_type_t {
   ID_VARIABLE,
   ID_PROCEDURE,
@@ -88,16 +92,21 @@ struct Type {
     bool array() { return is_array; }
     type_t type() { return variable_type; }
     unsigned int arraysize() { return array_size; }
+    unsigned int size() { return element_size; }
     bool is_symbol() { return symbol; }
 
     void set_array(bool arr) { is_array = arr; }
     void set_type(type_t t) { variable_type = t; }
     void set_arraysize(unsigned int size) { array_size = size; }
+    void set_size(unsigned int size) { element_size = size; }
+    
+    static unsigned int natural_size(type_t t);
 
   private:
     type_t variable_type;
     bool is_array;
     unsigned int array_size;
+    unsigned int element_size; // Bytes in memory for one value
     bool symbol;
 };
 
@@ -110,21 +119,29 @@ class Symbol {
     
     ~Symbol(){}
     
+    void set_element_size(unsigned int size);
+    
     std::string name;
     int line_declared;
     
     int ref_count; // For deleting
     bool used;
     bool initialized;
+    bool modified;  // Assigned or passed as an out argument
+    bool reference; // Array whose storage holds the address of the elements
+    bool leaf;      // Procedure that makes no calls and keeps its frame in C variables
+    std::string variable; // C variable holding the value, or a leaf procedure's return address
+    std::string module;   // C name of the module an imported procedure is entered through, or whose data holds a global
     id_type_t id_type;
     bool is_global;
     Type symbol_type;
     int address;
-    int width;
+    int width; // Bytes in memory
     direction_t direction;
 
     Symbol* params; // To build linked list for params
     Symbol* next;
+    Procedure_body* body; // Recorded for inlining, procedures only
 };
 
 typedef std::unordered_map<std::string, Symbol*> symbol_map;
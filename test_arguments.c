@@ -0,0 +1,1372 @@
+#include "runtime.h"
+
+long long static_data();
+
+int main() {
+	goto start;
+	void* ret1;		// Return address of getbool
+	bool lv2;		// getbool bb
+	long long lv2_address;
+getbool:
+	lv2 = getBool();
+	goto *ret1;
+	void* ret3;		// Return address of getinteger
+	int lv4;		// getinteger ii
+	long long lv4_address;
+getinteger:
+	lv4 = getInteger();
+	goto *ret3;
+	void* ret5;		// Return address of getfloat
+	double lv6;		// getfloat ff
+	long long lv6_address;
+getfloat:
+	lv6 = getFloat();
+	goto *ret5;
+	void* ret7;		// Return address of getstring
+	long long lv8;		// getstring ss
+	long long lv8_address;
+getstring:
+	lv8 = (long long)getString();
+	goto *ret7;
+	void* ret9;		// Return address of putbool
+	bool lv10;		// putbool b
+putbool:
+	putBool(lv10);
+	goto *ret9;
+	void* ret11;		// Return address of putinteger
+	int lv12;		// putinteger i
+putinteger:
+	putInteger(lv12);
+	goto *ret11;
+	void* ret13;		// Return address of putfloat
+	double lv14;		// putfloat f
+putfloat:
+	putFloat(lv14);
+	goto *ret13;
+	void* ret15;		// Return address of putstring
+	long long lv16;		// putstring s
+putstring:
+	putString((char*)lv16);
+	goto *ret15;
+	static int v17;		// a
+	static double v18;		// f
+framed:
+	Reg[0] = (long long)MEM(int, Reg[FP] + 16) * 1;		// expression = operand1 op operand2
+	Reg[1] = (long long)MEM(int, Reg[FP] + 24) * 2;		// expression = operand1 op operand2
+	Reg[0] = Reg[0] + Reg[1];		// expression = operand1 op operand2
+	Reg[1] = (long long)MEM(int, Reg[FP] + 32) * 3;		// expression = operand1 op operand2
+	Reg[0] = Reg[0] + Reg[1];		// expression = operand1 op operand2
+	Reg[1] = (long long)MEM(int, Reg[FP] + 40) * 4;		// expression = operand1 op operand2
+	Reg[0] = Reg[0] + Reg[1];		// expression = operand1 op operand2
+	Reg[1] = (long long)MEM(int, Reg[FP] + 48) * 5;		// expression = operand1 op operand2
+	Reg[0] = Reg[0] + Reg[1];		// expression = operand1 op operand2
+	Reg[1] = (long long)MEM(int, Reg[FP] + 56) * 6;		// expression = operand1 op operand2
+	Reg[0] = Reg[0] + Reg[1];		// expression = operand1 op operand2
+	Reg[1] = (long long)MEM(int, Reg[FP] + 64) * 7;		// expression = operand1 op operand2
+	Reg[0] = Reg[0] + Reg[1];		// expression = operand1 op operand2
+	Reg[1] = (long long)MEM(int, Reg[FP] + 72) * 8;		// expression = operand1 op operand2
+	Reg[0] = Reg[0] + Reg[1];		// expression = operand1 op operand2
+	Reg[1] = (long long)MEM(int, Reg[FP] + 80) * 9;		// expression = operand1 op operand2
+	Reg[0] = Reg[0] + Reg[1];		// expression = operand1 op operand2
+	Reg[1] = (long long)MEM(int, Reg[FP] + 88) * 10;		// expression = operand1 op operand2
+	Reg[0] = Reg[0] + Reg[1];		// expression = operand1 op operand2
+	Reg[1] = (long long)MEM(int, Reg[FP] + 96) * 11;		// expression = operand1 op operand2
+	Reg[0] = Reg[0] + Reg[1];		// expression = operand1 op operand2
+	Reg[1] = (long long)MEM(int, Reg[FP] + 104) * 12;		// expression = operand1 op operand2
+	Reg[0] = Reg[0] + Reg[1];		// expression = operand1 op operand2
+	Reg[1] = (long long)MEM(int, Reg[FP] + 112) * 13;		// expression = operand1 op operand2
+	Reg[0] = Reg[0] + Reg[1];		// expression = operand1 op operand2
+	Reg[1] = (long long)MEM(int, Reg[FP] + 120) * 14;		// expression = operand1 op operand2
+	Reg[0] = Reg[0] + Reg[1];		// expression = operand1 op operand2
+	Reg[1] = (long long)MEM(int, Reg[FP] + 128) * 15;		// expression = operand1 op operand2
+	Reg[0] = Reg[0] + Reg[1];		// expression = operand1 op operand2
+	Reg[1] = (long long)MEM(int, Reg[FP] + 136) * 16;		// expression = operand1 op operand2
+	Reg[0] = Reg[0] + Reg[1];		// expression = operand1 op operand2
+	Reg[1] = (long long)MEM(int, Reg[FP] + 144) * 17;		// expression = operand1 op operand2
+	Reg[0] = Reg[0] + Reg[1];		// expression = operand1 op operand2
+	Reg[1] = (long long)MEM(int, Reg[FP] + 152) * 18;		// expression = operand1 op operand2
+	Reg[0] = Reg[0] + Reg[1];		// expression = operand1 op operand2
+	Reg[1] = (long long)MEM(int, Reg[FP] + 160) * 19;		// expression = operand1 op operand2
+	Reg[0] = Reg[0] + Reg[1];		// expression = operand1 op operand2
+	Reg[1] = (long long)MEM(int, Reg[FP] + 168) * 20;		// expression = operand1 op operand2
+	Reg[0] = Reg[0] + Reg[1];		// expression = operand1 op operand2
+	Reg[1] = (long long)MEM(int, Reg[FP] + 176) * 21;		// expression = operand1 op operand2
+	Reg[0] = Reg[0] + Reg[1];		// expression = operand1 op operand2
+	Reg[1] = (long long)MEM(int, Reg[FP] + 184) * 22;		// expression = operand1 op operand2
+	Reg[0] = Reg[0] + Reg[1];		// expression = operand1 op operand2
+	Reg[1] = (long long)MEM(int, Reg[FP] + 192) * 23;		// expression = operand1 op operand2
+	Reg[0] = Reg[0] + Reg[1];		// expression = operand1 op operand2
+	Reg[1] = (long long)MEM(int, Reg[FP] + 200) * 24;		// expression = operand1 op operand2
+	Reg[0] = Reg[0] + Reg[1];		// expression = operand1 op operand2
+	Reg[1] = (long long)MEM(int, Reg[FP] + 208) * 25;		// expression = operand1 op operand2
+	Reg[0] = Reg[0] + Reg[1];		// expression = operand1 op operand2
+	Reg[1] = (long long)MEM(int, Reg[FP] + 216) * 26;		// expression = operand1 op operand2
+	Reg[0] = Reg[0] + Reg[1];		// expression = operand1 op operand2
+	Reg[1] = (long long)MEM(int, Reg[FP] + 224) * 27;		// expression = operand1 op operand2
+	Reg[0] = Reg[0] + Reg[1];		// expression = operand1 op operand2
+	Reg[1] = (long long)MEM(int, Reg[FP] + 232) * 28;		// expression = operand1 op operand2
+	Reg[0] = Reg[0] + Reg[1];		// expression = operand1 op operand2
+	Reg[1] = (long long)MEM(int, Reg[FP] + 240) * 29;		// expression = operand1 op operand2
+	Reg[0] = Reg[0] + Reg[1];		// expression = operand1 op operand2
+	Reg[1] = (long long)MEM(int, Reg[FP] + 248) * 30;		// expression = operand1 op operand2
+	Reg[0] = Reg[0] + Reg[1];		// expression = operand1 op operand2
+	Reg[1] = 1 * 4;		// expression = operand1 op operand2
+	Reg[1] = (MEM(long long, Reg[FP] + 256)) + Reg[1];		// expression = operand1 op operand2
+	Reg[1] = MEM(int, Reg[1]);		// Get array operand
+	Reg[1] = Reg[1] * (long long)MEM(int, Reg[FP] + 288);		// expression = operand1 op operand2
+	Reg[0] = Reg[0] + Reg[1];		// expression = operand1 op operand2
+	MEM(int, Reg[FP] + 280) = Reg[0];		// assign parameter
+	*((double*)&Reg[0]) = MEM(double, Reg[FP] + 264);		// operand
+	lv14 = *((double*)&Reg[0]);		// Pass argument
+	ret13 = &&postputfloat1;
+	goto putfloat;		// jump to leaf procedure
+postputfloat1:
+	Reg[0] = (long long)MEM(int, Reg[FP] + 280);		// operand
+	lv12 = Reg[0];		// Pass argument
+	ret11 = &&postputinteger2;
+	goto putinteger;		// jump to leaf procedure
+postputinteger2:
+	Reg[SP] = Reg[FP];		// Free local variables
+	Reg[FP] = MEM(long long, Reg[FP]);		// Restore Frame pointer
+	Reg[SP] = Reg[SP] + 8;		// Free space for FP
+	Reg[0] = MEM(long long, Reg[SP]);		// Pop return address off the stack
+	Reg[SP] = Reg[SP] + 8;		// Free return address space
+	goto *(void*)Reg[0];		// Return
+	void* ret83;		// Return address of leaf
+	int lv84;		// leaf p0
+	int lv85;		// leaf p1
+	int lv86;		// leaf p2
+	int lv87;		// leaf p3
+	int lv88;		// leaf p4
+	int lv89;		// leaf p5
+	int lv90;		// leaf p6
+	int lv91;		// leaf p7
+	int lv92;		// leaf p8
+	int lv93;		// leaf p9
+	int lv94;		// leaf p10
+	int lv95;		// leaf p11
+	int lv96;		// leaf p12
+	int lv97;		// leaf p13
+	int lv98;		// leaf p14
+	int lv99;		// leaf p15
+	int lv100;		// leaf p16
+	int lv101;		// leaf p17
+	int lv102;		// leaf p18
+	int lv103;		// leaf p19
+	int lv104;		// leaf p20
+	int lv105;		// leaf p21
+	int lv106;		// leaf p22
+	int lv107;		// leaf p23
+	int lv108;		// leaf p24
+	int lv109;		// leaf p25
+	int lv110;		// leaf p26
+	int lv111;		// leaf p27
+	int lv112;		// leaf p28
+	int lv113;		// leaf p29
+	long long lv114;		// leaf arr
+	double lv115;		// leaf q
+	int lv116;		// leaf total
+	long long lv116_address;
+	int lv117;		// leaf n
+leaf:
+	Reg[0] = (long long)lv84 * 1;		// expression = operand1 op operand2
+	Reg[1] = (long long)lv85 * 2;		// expression = operand1 op operand2
+	Reg[0] = Reg[0] + Reg[1];		// expression = operand1 op operand2
+	Reg[1] = (long long)lv86 * 3;		// expression = operand1 op operand2
+	Reg[0] = Reg[0] + Reg[1];		// expression = operand1 op operand2
+	Reg[1] = (long long)lv87 * 4;		// expression = operand1 op operand2
+	Reg[0] = Reg[0] + Reg[1];		// expression = operand1 op operand2
+	Reg[1] = (long long)lv88 * 5;		// expression = operand1 op operand2
+	Reg[0] = Reg[0] + Reg[1];		// expression = operand1 op operand2
+	Reg[1] = (long long)lv89 * 6;		// expression = operand1 op operand2
+	Reg[0] = Reg[0] + Reg[1];		// expression = operand1 op operand2
+	Reg[1] = (long long)lv90 * 7;		// expression = operand1 op operand2
+	Reg[0] = Reg[0] + Reg[1];		// expression = operand1 op operand2
+	Reg[1] = (long long)lv91 * 8;		// expression = operand1 op operand2
+	Reg[0] = Reg[0] + Reg[1];		// expression = operand1 op operand2
+	Reg[1] = (long long)lv92 * 9;		// expression = operand1 op operand2
+	Reg[0] = Reg[0] + Reg[1];		// expression = operand1 op operand2
+	Reg[1] = (long long)lv93 * 10;		// expression = operand1 op operand2
+	Reg[0] = Reg[0] + Reg[1];		// expression = operand1 op operand2
+	Reg[1] = (long long)lv94 * 11;		// expression = operand1 op operand2
+	Reg[0] = Reg[0] + Reg[1];		// expression = operand1 op operand2
+	Reg[1] = (long long)lv95 * 12;		// expression = operand1 op operand2
+	Reg[0] = Reg[0] + Reg[1];		// expression = operand1 op operand2
+	Reg[1] = (long long)lv96 * 13;		// expression = operand1 op operand2
+	Reg[0] = Reg[0] + Reg[1];		// expression = operand1 op operand2
+	Reg[1] = (long long)lv97 * 14;		// expression = operand1 op operand2
+	Reg[0] = Reg[0] + Reg[1];		// expression = operand1 op operand2
+	Reg[1] = (long long)lv98 * 15;		// expression = operand1 op operand2
+	Reg[0] = Reg[0] + Reg[1];		// expression = operand1 op operand2
+	Reg[1] = (long long)lv99 * 16;		// expression = operand1 op operand2
+	Reg[0] = Reg[0] + Reg[1];		// expression = operand1 op operand2
+	Reg[1] = (long long)lv100 * 17;		// expression = operand1 op operand2
+	Reg[0] = Reg[0] + Reg[1];		// expression = operand1 op operand2
+	Reg[1] = (long long)lv101 * 18;		// expression = operand1 op operand2
+	Reg[0] = Reg[0] + Reg[1];		// expression = operand1 op operand2
+	Reg[1] = (long long)lv102 * 19;		// expression = operand1 op operand2
+	Reg[0] = Reg[0] + Reg[1];		// expression = operand1 op operand2
+	Reg[1] = (long long)lv103 * 20;		// expression = operand1 op operand2
+	Reg[0] = Reg[0] + Reg[1];		// expression = operand1 op operand2
+	Reg[1] = (long long)lv104 * 21;		// expression = operand1 op operand2
+	Reg[0] = Reg[0] + Reg[1];		// expression = operand1 op operand2
+	Reg[1] = (long long)lv105 * 22;		// expression = operand1 op operand2
+	Reg[0] = Reg[0] + Reg[1];		// expression = operand1 op operand2
+	Reg[1] = (long long)lv106 * 23;		// expression = operand1 op operand2
+	Reg[0] = Reg[0] + Reg[1];		// expression = operand1 op operand2
+	Reg[1] = (long long)lv107 * 24;		// expression = operand1 op operand2
+	Reg[0] = Reg[0] + Reg[1];		// expression = operand1 op operand2
+	Reg[1] = (long long)lv108 * 25;		// expression = operand1 op operand2
+	Reg[0] = Reg[0] + Reg[1];		// expression = operand1 op operand2
+	Reg[1] = (long long)lv109 * 26;		// expression = operand1 op operand2
+	Reg[0] = Reg[0] + Reg[1];		// expression = operand1 op operand2
+	Reg[1] = (long long)lv110 * 27;		// expression = operand1 op operand2
+	Reg[0] = Reg[0] + Reg[1];		// expression = operand1 op operand2
+	Reg[1] = (long long)lv111 * 28;		// expression = operand1 op operand2
+	Reg[0] = Reg[0] + Reg[1];		// expression = operand1 op operand2
+	Reg[1] = (long long)lv112 * 29;		// expression = operand1 op operand2
+	Reg[0] = Reg[0] + Reg[1];		// expression = operand1 op operand2
+	Reg[1] = (long long)lv113 * 30;		// expression = operand1 op operand2
+	Reg[0] = Reg[0] + Reg[1];		// expression = operand1 op operand2
+	Reg[1] = 2 * 4;		// expression = operand1 op operand2
+	Reg[1] = (lv114) + Reg[1];		// expression = operand1 op operand2
+	Reg[1] = MEM(int, Reg[1]);		// Get array operand
+	Reg[1] = Reg[1] * (long long)lv117;		// expression = operand1 op operand2
+	Reg[0] = Reg[0] + Reg[1];		// expression = operand1 op operand2
+	lv116 = Reg[0];		// assign parameter
+	goto *ret83;		// Return from leaf
+	void* ret182;		// Return address of once
+	int lv183;		// once p0
+	int lv184;		// once p1
+	int lv185;		// once p2
+	int lv186;		// once p3
+	int lv187;		// once p4
+	int lv188;		// once p5
+	int lv189;		// once p6
+	int lv190;		// once p7
+	int lv191;		// once p8
+	int lv192;		// once p9
+	int lv193;		// once p10
+	int lv194;		// once p11
+	int lv195;		// once p12
+	int lv196;		// once p13
+	int lv197;		// once p14
+	int lv198;		// once p15
+	int lv199;		// once p16
+	int lv200;		// once p17
+	int lv201;		// once p18
+	int lv202;		// once p19
+	int lv203;		// once p20
+	int lv204;		// once p21
+	int lv205;		// once p22
+	int lv206;		// once p23
+	int lv207;		// once p24
+	int lv208;		// once p25
+	int lv209;		// once p26
+	int lv210;		// once p27
+	int lv211;		// once p28
+	int lv212;		// once p29
+	long long lv213;		// once arr
+	double lv214;		// once q
+	int lv215;		// once total
+	long long lv215_address;
+	int lv216;		// once n
+once:
+	Reg[0] = (long long)lv183 * 1;		// expression = operand1 op operand2
+	Reg[1] = (long long)lv184 * 2;		// expression = operand1 op operand2
+	Reg[0] = Reg[0] + Reg[1];		// expression = operand1 op operand2
+	Reg[1] = (long long)lv185 * 3;		// expression = operand1 op operand2
+	Reg[0] = Reg[0] + Reg[1];		// expression = operand1 op operand2
+	Reg[1] = (long long)lv186 * 4;		// expression = operand1 op operand2
+	Reg[0] = Reg[0] + Reg[1];		// expression = operand1 op operand2
+	Reg[1] = (long long)lv187 * 5;		// expression = operand1 op operand2
+	Reg[0] = Reg[0] + Reg[1];		// expression = operand1 op operand2
+	Reg[1] = (long long)lv188 * 6;		// expression = operand1 op operand2
+	Reg[0] = Reg[0] + Reg[1];		// expression = operand1 op operand2
+	Reg[1] = (long long)lv189 * 7;		// expression = operand1 op operand2
+	Reg[0] = Reg[0] + Reg[1];		// expression = operand1 op operand2
+	Reg[1] = (long long)lv190 * 8;		// expression = operand1 op operand2
+	Reg[0] = Reg[0] + Reg[1];		// expression = operand1 op operand2
+	Reg[1] = (long long)lv191 * 9;		// expression = operand1 op operand2
+	Reg[0] = Reg[0] + Reg[1];		// expression = operand1 op operand2
+	Reg[1] = (long long)lv192 * 10;		// expression = operand1 op operand2
+	Reg[0] = Reg[0] + Reg[1];		// expression = operand1 op operand2
+	Reg[1] = (long long)lv193 * 11;		// expression = operand1 op operand2
+	Reg[0] = Reg[0] + Reg[1];		// expression = operand1 op operand2
+	Reg[1] = (long long)lv194 * 12;		// expression = operand1 op operand2
+	Reg[0] = Reg[0] + Reg[1];		// expression = operand1 op operand2
+	Reg[1] = (long long)lv195 * 13;		// expression = operand1 op operand2
+	Reg[0] = Reg[0] + Reg[1];		// expression = operand1 op operand2
+	Reg[1] = (long long)lv196 * 14;		// expression = operand1 op operand2
+	Reg[0] = Reg[0] + Reg[1];		// expression = operand1 op operand2
+	Reg[1] = (long long)lv197 * 15;		// expression = operand1 op operand2
+	Reg[0] = Reg[0] + Reg[1];		// expression = operand1 op operand2
+	Reg[1] = (long long)lv198 * 16;		// expression = operand1 op operand2
+	Reg[0] = Reg[0] + Reg[1];		// expression = operand1 op operand2
+	Reg[1] = (long long)lv199 * 17;		// expression = operand1 op operand2
+	Reg[0] = Reg[0] + Reg[1];		// expression = operand1 op operand2
+	Reg[1] = (long long)lv200 * 18;		// expression = operand1 op operand2
+	Reg[0] = Reg[0] + Reg[1];		// expression = operand1 op operand2
+	Reg[1] = (long long)lv201 * 19;		// expression = operand1 op operand2
+	Reg[0] = Reg[0] + Reg[1];		// expression = operand1 op operand2
+	Reg[1] = (long long)lv202 * 20;		// expression = operand1 op operand2
+	Reg[0] = Reg[0] + Reg[1];		// expression = operand1 op operand2
+	Reg[1] = (long long)lv203 * 21;		// expression = operand1 op operand2
+	Reg[0] = Reg[0] + Reg[1];		// expression = operand1 op operand2
+	Reg[1] = (long long)lv204 * 22;		// expression = operand1 op operand2
+	Reg[0] = Reg[0] + Reg[1];		// expression = operand1 op operand2
+	Reg[1] = (long long)lv205 * 23;		// expression = operand1 op operand2
+	Reg[0] = Reg[0] + Reg[1];		// expression = operand1 op operand2
+	Reg[1] = (long long)lv206 * 24;		// expression = operand1 op operand2
+	Reg[0] = Reg[0] + Reg[1];		// expression = operand1 op operand2
+	Reg[1] = (long long)lv207 * 25;		// expression = operand1 op operand2
+	Reg[0] = Reg[0] + Reg[1];		// expression = operand1 op operand2
+	Reg[1] = (long long)lv208 * 26;		// expression = operand1 op operand2
+	Reg[0] = Reg[0] + Reg[1];		// expression = operand1 op operand2
+	Reg[1] = (long long)lv209 * 27;		// expression = operand1 op operand2
+	Reg[0] = Reg[0] + Reg[1];		// expression = operand1 op operand2
+	Reg[1] = (long long)lv210 * 28;		// expression = operand1 op operand2
+	Reg[0] = Reg[0] + Reg[1];		// expression = operand1 op operand2
+	Reg[1] = (long long)lv211 * 29;		// expression = operand1 op operand2
+	Reg[0] = Reg[0] + Reg[1];		// expression = operand1 op operand2
+	Reg[1] = (long long)lv212 * 30;		// expression = operand1 op operand2
+	Reg[0] = Reg[0] + Reg[1];		// expression = operand1 op operand2
+	Reg[1] = 3 * 4;		// expression = operand1 op operand2
+	Reg[1] = (lv213) + Reg[1];		// expression = operand1 op operand2
+	Reg[1] = MEM(int, Reg[1]);		// Get array operand
+	Reg[1] = Reg[1] * (long long)lv216;		// expression = operand1 op operand2
+	Reg[0] = Reg[0] + Reg[1];		// expression = operand1 op operand2
+	lv215 = Reg[0];		// assign parameter
+	goto *ret182;		// Return from leaf
+rotate:
+	if (!((long long)MEM(int, Reg[FP] + 288) > 0)) goto else3;
+	Reg[0] = (long long)MEM(int, Reg[FP] + 24);		// operand
+	Reg[1] = (long long)MEM(int, Reg[FP] + 32);		// operand
+	Reg[2] = (long long)MEM(int, Reg[FP] + 40);		// operand
+	Reg[3] = (long long)MEM(int, Reg[FP] + 48);		// operand
+	Reg[4] = (long long)MEM(int, Reg[FP] + 56);		// operand
+	Reg[5] = (long long)MEM(int, Reg[FP] + 64);		// operand
+	Reg[6] = (long long)MEM(int, Reg[FP] + 72);		// operand
+	Reg[7] = (long long)MEM(int, Reg[FP] + 80);		// operand
+	Reg[8] = (long long)MEM(int, Reg[FP] + 88);		// operand
+	Reg[9] = (long long)MEM(int, Reg[FP] + 96);		// operand
+	Reg[10] = (long long)MEM(int, Reg[FP] + 104);		// operand
+	Reg[11] = (long long)MEM(int, Reg[FP] + 112);		// operand
+	Reg[12] = (long long)MEM(int, Reg[FP] + 120);		// operand
+	Reg[13] = (long long)MEM(int, Reg[FP] + 128);		// operand
+	Reg[14] = (long long)MEM(int, Reg[FP] + 136);		// operand
+	Reg[15] = (long long)MEM(int, Reg[FP] + 144);		// operand
+	Reg[16] = (long long)MEM(int, Reg[FP] + 152);		// operand
+	Reg[17] = (long long)MEM(int, Reg[FP] + 160);		// operand
+	Reg[18] = (long long)MEM(int, Reg[FP] + 168);		// operand
+	Reg[19] = (long long)MEM(int, Reg[FP] + 176);		// operand
+	Reg[20] = (long long)MEM(int, Reg[FP] + 184);		// operand
+	Reg[21] = (long long)MEM(int, Reg[FP] + 192);		// operand
+	Reg[22] = (long long)MEM(int, Reg[FP] + 200);		// operand
+	Reg[23] = (long long)MEM(int, Reg[FP] + 208);		// operand
+	Reg[24] = (long long)MEM(int, Reg[FP] + 216);		// operand
+	Reg[SP] = Reg[SP] - 8;
+	MEM(long long, Reg[SP]) = Reg[24];		// Pass argument on the stack, registers are full
+	Reg[24] = (long long)MEM(int, Reg[FP] + 224);		// operand
+	Reg[SP] = Reg[SP] - 8;
+	MEM(long long, Reg[SP]) = Reg[24];		// Pass argument on the stack, registers are full
+	Reg[24] = (long long)MEM(int, Reg[FP] + 232);		// operand
+	Reg[SP] = Reg[SP] - 8;
+	MEM(long long, Reg[SP]) = Reg[24];		// Pass argument on the stack, registers are full
+	Reg[24] = (long long)MEM(int, Reg[FP] + 240);		// operand
+	Reg[SP] = Reg[SP] - 8;
+	MEM(long long, Reg[SP]) = Reg[24];		// Pass argument on the stack, registers are full
+	Reg[24] = (long long)MEM(int, Reg[FP] + 248);		// operand
+	Reg[SP] = Reg[SP] - 8;
+	MEM(long long, Reg[SP]) = Reg[24];		// Pass argument on the stack, registers are full
+	Reg[24] = (long long)MEM(int, Reg[FP] + 16);		// operand
+	Reg[SP] = Reg[SP] - 8;
+	MEM(long long, Reg[SP]) = Reg[24];		// Pass argument on the stack, registers are full
+	Reg[24] = (MEM(long long, Reg[FP] + 256));		// operand
+	Reg[SP] = Reg[SP] - 8;
+	MEM(long long, Reg[SP]) = Reg[24];		// Pass argument on the stack, registers are full
+	*((double*)&Reg[24]) = MEM(double, Reg[FP] + 264) + 1;		// expression = operand1 op operand2
+	Reg[SP] = Reg[SP] - 8;
+	MEM(long long, Reg[SP]) = Reg[24];		// Pass argument on the stack, registers are full
+	Reg[24] = (Reg[FP] + 280);		// operand
+	Reg[25] = MEM(int, Reg[24]);		// Value of out argument
+	Reg[SP] = Reg[SP] - 8;
+	MEM(long long, Reg[SP]) = Reg[24];		// Pass argument on the stack, registers are full
+	Reg[SP] = Reg[SP] - 8;
+	MEM(long long, Reg[SP]) = Reg[25];		// Pass argument on the stack, registers are full
+	Reg[24] = (long long)MEM(int, Reg[FP] + 288) - 1;		// expression = operand1 op operand2
+	Reg[SP] = Reg[SP] - 8;
+	MEM(long long, Reg[SP]) = Reg[24];		// Pass argument on the stack, registers are full
+	Reg[24] = Reg[SP];		// Arguments passed on the stack
+	MEM(int, Reg[FP] + 288) = MEM(long long, Reg[24] + 0);		// Overwrite parameter in own frame
+	MEM(double, Reg[FP] + 264) = MEM(double, Reg[24] + 24);		// Overwrite parameter in own frame
+	MEM(int, Reg[FP] + 248) = MEM(long long, Reg[24] + 40);		// Overwrite parameter in own frame
+	MEM(int, Reg[FP] + 240) = MEM(long long, Reg[24] + 48);		// Overwrite parameter in own frame
+	MEM(int, Reg[FP] + 232) = MEM(long long, Reg[24] + 56);		// Overwrite parameter in own frame
+	MEM(int, Reg[FP] + 224) = MEM(long long, Reg[24] + 64);		// Overwrite parameter in own frame
+	MEM(int, Reg[FP] + 216) = MEM(long long, Reg[24] + 72);		// Overwrite parameter in own frame
+	MEM(int, Reg[FP] + 208) = MEM(long long, Reg[24] + 80);		// Overwrite parameter in own frame
+	MEM(int, Reg[FP] + 200) = Reg[23];		// Overwrite parameter in own frame
+	MEM(int, Reg[FP] + 192) = Reg[22];		// Overwrite parameter in own frame
+	MEM(int, Reg[FP] + 184) = Reg[21];		// Overwrite parameter in own frame
+	MEM(int, Reg[FP] + 176) = Reg[20];		// Overwrite parameter in own frame
+	MEM(int, Reg[FP] + 168) = Reg[19];		// Overwrite parameter in own frame
+	MEM(int, Reg[FP] + 160) = Reg[18];		// Overwrite parameter in own frame
+	MEM(int, Reg[FP] + 152) = Reg[17];		// Overwrite parameter in own frame
+	MEM(int, Reg[FP] + 144) = Reg[16];		// Overwrite parameter in own frame
+	MEM(int, Reg[FP] + 136) = Reg[15];		// Overwrite parameter in own frame
+	MEM(int, Reg[FP] + 128) = Reg[14];		// Overwrite parameter in own frame
+	MEM(int, Reg[FP] + 120) = Reg[13];		// Overwrite parameter in own frame
+	MEM(int, Reg[FP] + 112) = Reg[12];		// Overwrite parameter in own frame
+	MEM(int, Reg[FP] + 104) = Reg[11];		// Overwrite parameter in own frame
+	MEM(int, Reg[FP] + 96) = Reg[10];		// Overwrite parameter in own frame
+	MEM(int, Reg[FP] + 88) = Reg[9];		// Overwrite parameter in own frame
+	MEM(int, Reg[FP] + 80) = Reg[8];		// Overwrite parameter in own frame
+	MEM(int, Reg[FP] + 72) = Reg[7];		// Overwrite parameter in own frame
+	MEM(int, Reg[FP] + 64) = Reg[6];		// Overwrite parameter in own frame
+	MEM(int, Reg[FP] + 56) = Reg[5];		// Overwrite parameter in own frame
+	MEM(int, Reg[FP] + 48) = Reg[4];		// Overwrite parameter in own frame
+	MEM(int, Reg[FP] + 40) = Reg[3];		// Overwrite parameter in own frame
+	MEM(int, Reg[FP] + 32) = Reg[2];		// Overwrite parameter in own frame
+	MEM(int, Reg[FP] + 24) = Reg[1];		// Overwrite parameter in own frame
+	MEM(int, Reg[FP] + 16) = Reg[0];		// Overwrite parameter in own frame
+	Reg[SP] = Reg[FP];		// Free local variables
+	goto rotate;		// Tail call, reuse frame
+	goto next5;
+else3:
+	Reg[0] = (long long)MEM(int, Reg[FP] + 16) * 1;		// expression = operand1 op operand2
+	Reg[1] = (long long)MEM(int, Reg[FP] + 24) * 2;		// expression = operand1 op operand2
+	Reg[0] = Reg[0] + Reg[1];		// expression = operand1 op operand2
+	Reg[1] = (long long)MEM(int, Reg[FP] + 32) * 3;		// expression = operand1 op operand2
+	Reg[0] = Reg[0] + Reg[1];		// expression = operand1 op operand2
+	Reg[1] = (long long)MEM(int, Reg[FP] + 40) * 4;		// expression = operand1 op operand2
+	Reg[0] = Reg[0] + Reg[1];		// expression = operand1 op operand2
+	Reg[1] = (long long)MEM(int, Reg[FP] + 48) * 5;		// expression = operand1 op operand2
+	Reg[0] = Reg[0] + Reg[1];		// expression = operand1 op operand2
+	Reg[1] = (long long)MEM(int, Reg[FP] + 56) * 6;		// expression = operand1 op operand2
+	Reg[0] = Reg[0] + Reg[1];		// expression = operand1 op operand2
+	Reg[1] = (long long)MEM(int, Reg[FP] + 64) * 7;		// expression = operand1 op operand2
+	Reg[0] = Reg[0] + Reg[1];		// expression = operand1 op operand2
+	Reg[1] = (long long)MEM(int, Reg[FP] + 72) * 8;		// expression = operand1 op operand2
+	Reg[0] = Reg[0] + Reg[1];		// expression = operand1 op operand2
+	Reg[1] = (long long)MEM(int, Reg[FP] + 80) * 9;		// expression = operand1 op operand2
+	Reg[0] = Reg[0] + Reg[1];		// expression = operand1 op operand2
+	Reg[1] = (long long)MEM(int, Reg[FP] + 88) * 10;		// expression = operand1 op operand2
+	Reg[0] = Reg[0] + Reg[1];		// expression = operand1 op operand2
+	Reg[1] = (long long)MEM(int, Reg[FP] + 96) * 11;		// expression = operand1 op operand2
+	Reg[0] = Reg[0] + Reg[1];		// expression = operand1 op operand2
+	Reg[1] = (long long)MEM(int, Reg[FP] + 104) * 12;		// expression = operand1 op operand2
+	Reg[0] = Reg[0] + Reg[1];		// expression = operand1 op operand2
+	Reg[1] = (long long)MEM(int, Reg[FP] + 112) * 13;		// expression = operand1 op operand2
+	Reg[0] = Reg[0] + Reg[1];		// expression = operand1 op operand2
+	Reg[1] = (long long)MEM(int, Reg[FP] + 120) * 14;		// expression = operand1 op operand2
+	Reg[0] = Reg[0] + Reg[1];		// expression = operand1 op operand2
+	Reg[1] = (long long)MEM(int, Reg[FP] + 128) * 15;		// expression = operand1 op operand2
+	Reg[0] = Reg[0] + Reg[1];		// expression = operand1 op operand2
+	Reg[1] = (long long)MEM(int, Reg[FP] + 136) * 16;		// expression = operand1 op operand2
+	Reg[0] = Reg[0] + Reg[1];		// expression = operand1 op operand2
+	Reg[1] = (long long)MEM(int, Reg[FP] + 144) * 17;		// expression = operand1 op operand2
+	Reg[0] = Reg[0] + Reg[1];		// expression = operand1 op operand2
+	Reg[1] = (long long)MEM(int, Reg[FP] + 152) * 18;		// expression = operand1 op operand2
+	Reg[0] = Reg[0] + Reg[1];		// expression = operand1 op operand2
+	Reg[1] = (long long)MEM(int, Reg[FP] + 160) * 19;		// expression = operand1 op operand2
+	Reg[0] = Reg[0] + Reg[1];		// expression = operand1 op operand2
+	Reg[1] = (long long)MEM(int, Reg[FP] + 168) * 20;		// expression = operand1 op operand2
+	Reg[0] = Reg[0] + Reg[1];		// expression = operand1 op operand2
+	Reg[1] = (long long)MEM(int, Reg[FP] + 176) * 21;		// expression = operand1 op operand2
+	Reg[0] = Reg[0] + Reg[1];		// expression = operand1 op operand2
+	Reg[1] = (long long)MEM(int, Reg[FP] + 184) * 22;		// expression = operand1 op operand2
+	Reg[0] = Reg[0] + Reg[1];		// expression = operand1 op operand2
+	Reg[1] = (long long)MEM(int, Reg[FP] + 192) * 23;		// expression = operand1 op operand2
+	Reg[0] = Reg[0] + Reg[1];		// expression = operand1 op operand2
+	Reg[1] = (long long)MEM(int, Reg[FP] + 200) * 24;		// expression = operand1 op operand2
+	Reg[0] = Reg[0] + Reg[1];		// expression = operand1 op operand2
+	Reg[1] = (long long)MEM(int, Reg[FP] + 208) * 25;		// expression = operand1 op operand2
+	Reg[0] = Reg[0] + Reg[1];		// expression = operand1 op operand2
+	Reg[1] = (long long)MEM(int, Reg[FP] + 216) * 26;		// expression = operand1 op operand2
+	Reg[0] = Reg[0] + Reg[1];		// expression = operand1 op operand2
+	Reg[1] = (long long)MEM(int, Reg[FP] + 224) * 27;		// expression = operand1 op operand2
+	Reg[0] = Reg[0] + Reg[1];		// expression = operand1 op operand2
+	Reg[1] = (long long)MEM(int, Reg[FP] + 232) * 28;		// expression = operand1 op operand2
+	Reg[0] = Reg[0] + Reg[1];		// expression = operand1 op operand2
+	Reg[1] = (long long)MEM(int, Reg[FP] + 240) * 29;		// expression = operand1 op operand2
+	Reg[0] = Reg[0] + Reg[1];		// expression = operand1 op operand2
+	Reg[1] = (long long)MEM(int, Reg[FP] + 248) * 30;		// expression = operand1 op operand2
+	Reg[0] = Reg[0] + Reg[1];		// expression = operand1 op operand2
+	Reg[1] = 0 * 4;		// expression = operand1 op operand2
+	Reg[1] = (MEM(long long, Reg[FP] + 256)) + Reg[1];		// expression = operand1 op operand2
+	Reg[1] = MEM(int, Reg[1]);		// Get array operand
+	Reg[0] = Reg[0] + Reg[1];		// expression = operand1 op operand2
+	MEM(int, Reg[FP] + 280) = Reg[0];		// assign parameter
+next5:
+	Reg[SP] = Reg[FP];		// Free local variables
+	Reg[FP] = MEM(long long, Reg[FP]);		// Restore Frame pointer
+	Reg[SP] = Reg[SP] + 8;		// Free space for FP
+	Reg[0] = MEM(long long, Reg[SP]);		// Pop return address off the stack
+	Reg[SP] = Reg[SP] + 8;		// Free return address space
+	goto *(void*)Reg[0];		// Return
+start:
+	init(static_data());		// Static memory is only known once the whole program is parsed
+	Reg[SP] = Reg[FP] - 24;		// Allocate the frame
+	v17 = 1;		// assign local variable
+	v18 = 0.5;		// assign local variable
+	Reg[0] = 0 * 4;		// expression = operand1 op operand2
+	Reg[0] = (Reg[FP] - 24) + Reg[0];		// expression = operand1 op operand2
+	MEM(int, Reg[0]) = 7;		// v + offset = expression
+	Reg[0] = 1 * 4;		// expression = operand1 op operand2
+	Reg[0] = (Reg[FP] - 24) + Reg[0];		// expression = operand1 op operand2
+	MEM(int, Reg[0]) = 11;		// v + offset = expression
+	Reg[0] = 2 * 4;		// expression = operand1 op operand2
+	Reg[0] = (Reg[FP] - 24) + Reg[0];		// expression = operand1 op operand2
+	MEM(int, Reg[0]) = 13;		// v + offset = expression
+	Reg[0] = 3 * 4;		// expression = operand1 op operand2
+	Reg[0] = (Reg[FP] - 24) + Reg[0];		// expression = operand1 op operand2
+	MEM(int, Reg[0]) = 17;		// v + offset = expression
+	Reg[0] = (long long)v17 + 0;		// expression = operand1 op operand2
+	Reg[1] = (long long)v17 + 1;		// expression = operand1 op operand2
+	Reg[2] = (long long)v17 + 2;		// expression = operand1 op operand2
+	Reg[3] = (long long)v17 + 3;		// expression = operand1 op operand2
+	Reg[4] = (long long)v17 + 4;		// expression = operand1 op operand2
+	Reg[5] = (long long)v17 + 5;		// expression = operand1 op operand2
+	Reg[6] = (long long)v17 + 6;		// expression = operand1 op operand2
+	Reg[7] = (long long)v17 + 7;		// expression = operand1 op operand2
+	Reg[8] = (long long)v17 + 8;		// expression = operand1 op operand2
+	Reg[9] = (long long)v17 + 9;		// expression = operand1 op operand2
+	Reg[10] = (long long)v17 + 10;		// expression = operand1 op operand2
+	Reg[11] = (long long)v17 + 11;		// expression = operand1 op operand2
+	Reg[12] = (long long)v17 + 12;		// expression = operand1 op operand2
+	Reg[13] = (long long)v17 + 13;		// expression = operand1 op operand2
+	Reg[14] = (long long)v17 + 14;		// expression = operand1 op operand2
+	Reg[15] = (long long)v17 + 15;		// expression = operand1 op operand2
+	Reg[16] = (long long)v17 + 16;		// expression = operand1 op operand2
+	Reg[17] = (long long)v17 + 17;		// expression = operand1 op operand2
+	Reg[18] = (long long)v17 + 18;		// expression = operand1 op operand2
+	Reg[19] = (long long)v17 + 19;		// expression = operand1 op operand2
+	Reg[20] = (long long)v17 + 20;		// expression = operand1 op operand2
+	Reg[21] = (long long)v17 + 21;		// expression = operand1 op operand2
+	Reg[22] = (long long)v17 + 22;		// expression = operand1 op operand2
+	Reg[23] = (long long)v17 + 23;		// expression = operand1 op operand2
+	Reg[24] = (long long)v17 + 24;		// expression = operand1 op operand2
+	Reg[SP] = Reg[SP] - 8;
+	MEM(long long, Reg[SP]) = Reg[24];		// Pass argument on the stack, registers are full
+	Reg[24] = (long long)v17 + 25;		// expression = operand1 op operand2
+	Reg[SP] = Reg[SP] - 8;
+	MEM(long long, Reg[SP]) = Reg[24];		// Pass argument on the stack, registers are full
+	Reg[24] = (long long)v17 + 26;		// expression = operand1 op operand2
+	Reg[SP] = Reg[SP] - 8;
+	MEM(long long, Reg[SP]) = Reg[24];		// Pass argument on the stack, registers are full
+	Reg[24] = (long long)v17 + 27;		// expression = operand1 op operand2
+	Reg[SP] = Reg[SP] - 8;
+	MEM(long long, Reg[SP]) = Reg[24];		// Pass argument on the stack, registers are full
+	Reg[24] = (long long)v17 + 28;		// expression = operand1 op operand2
+	Reg[SP] = Reg[SP] - 8;
+	MEM(long long, Reg[SP]) = Reg[24];		// Pass argument on the stack, registers are full
+	Reg[24] = (long long)v17 + 29;		// expression = operand1 op operand2
+	Reg[SP] = Reg[SP] - 8;
+	MEM(long long, Reg[SP]) = Reg[24];		// Pass argument on the stack, registers are full
+	Reg[24] = (Reg[FP] - 24);		// operand
+	Reg[SP] = Reg[SP] - 8;
+	MEM(long long, Reg[SP]) = Reg[24];		// Pass argument on the stack, registers are full
+	*((double*)&Reg[24]) = v18;		// operand
+	Reg[SP] = Reg[SP] - 8;
+	MEM(long long, Reg[SP]) = Reg[24];		// Pass argument on the stack, registers are full
+	Reg[24] = (Reg[FP] - 8);		// operand
+	Reg[25] = MEM(int, Reg[24]);		// Value of out argument
+	Reg[SP] = Reg[SP] - 8;
+	MEM(long long, Reg[SP]) = Reg[24];		// Pass argument on the stack, registers are full
+	Reg[SP] = Reg[SP] - 8;
+	MEM(long long, Reg[SP]) = Reg[25];		// Pass argument on the stack, registers are full
+	Reg[24] = 2;		// operand
+	Reg[SP] = Reg[SP] - 8;
+	MEM(long long, Reg[SP]) = Reg[24];		// Pass argument on the stack, registers are full
+	Reg[24] = Reg[SP];		// Arguments passed on the stack
+	Reg[SP] = Reg[SP] - 8;		// Make space on stack for argument
+	MEM(int, Reg[SP]) = MEM(long long, Reg[24] + 0);		// Move argument to stack
+	Reg[SP] = Reg[SP] - 8;		// Make space on stack for argument
+	MEM(int, Reg[SP]) = MEM(long long, Reg[24] + 8);		// Move argument to stack
+	Reg[SP] = Reg[SP] - 8;		// Allocate space for out param address
+	MEM(long long, Reg[SP]) = MEM(long long, Reg[24] + 16);		// Push address for out parameter onto stack
+	Reg[SP] = Reg[SP] - 8;		// Make space on stack for argument
+	MEM(double, Reg[SP]) = MEM(double, Reg[24] + 24);		// Move argument to stack
+	Reg[SP] = Reg[SP] - 8;
+	MEM(long long, Reg[SP]) = MEM(long long, Reg[24] + 32);		// Pass array by reference
+	Reg[SP] = Reg[SP] - 8;		// Make space on stack for argument
+	MEM(int, Reg[SP]) = MEM(long long, Reg[24] + 40);		// Move argument to stack
+	Reg[SP] = Reg[SP] - 8;		// Make space on stack for argument
+	MEM(int, Reg[SP]) = MEM(long long, Reg[24] + 48);		// Move argument to stack
+	Reg[SP] = Reg[SP] - 8;		// Make space on stack for argument
+	MEM(int, Reg[SP]) = MEM(long long, Reg[24] + 56);		// Move argument to stack
+	Reg[SP] = Reg[SP] - 8;		// Make space on stack for argument
+	MEM(int, Reg[SP]) = MEM(long long, Reg[24] + 64);		// Move argument to stack
+	Reg[SP] = Reg[SP] - 8;		// Make space on stack for argument
+	MEM(int, Reg[SP]) = MEM(long long, Reg[24] + 72);		// Move argument to stack
+	Reg[SP] = Reg[SP] - 8;		// Make space on stack for argument
+	MEM(int, Reg[SP]) = MEM(long long, Reg[24] + 80);		// Move argument to stack
+	Reg[SP] = Reg[SP] - 8;		// Make space on stack for argument
+	MEM(int, Reg[SP]) = Reg[23];		// Move argument to stack
+	Reg[SP] = Reg[SP] - 8;		// Make space on stack for argument
+	MEM(int, Reg[SP]) = Reg[22];		// Move argument to stack
+	Reg[SP] = Reg[SP] - 8;		// Make space on stack for argument
+	MEM(int, Reg[SP]) = Reg[21];		// Move argument to stack
+	Reg[SP] = Reg[SP] - 8;		// Make space on stack for argument
+	MEM(int, Reg[SP]) = Reg[20];		// Move argument to stack
+	Reg[SP] = Reg[SP] - 8;		// Make space on stack for argument
+	MEM(int, Reg[SP]) = Reg[19];		// Move argument to stack
+	Reg[SP] = Reg[SP] - 8;		// Make space on stack for argument
+	MEM(int, Reg[SP]) = Reg[18];		// Move argument to stack
+	Reg[SP] = Reg[SP] - 8;		// Make space on stack for argument
+	MEM(int, Reg[SP]) = Reg[17];		// Move argument to stack
+	Reg[SP] = Reg[SP] - 8;		// Make space on stack for argument
+	MEM(int, Reg[SP]) = Reg[16];		// Move argument to stack
+	Reg[SP] = Reg[SP] - 8;		// Make space on stack for argument
+	MEM(int, Reg[SP]) = Reg[15];		// Move argument to stack
+	Reg[SP] = Reg[SP] - 8;		// Make space on stack for argument
+	MEM(int, Reg[SP]) = Reg[14];		// Move argument to stack
+	Reg[SP] = Reg[SP] - 8;		// Make space on stack for argument
+	MEM(int, Reg[SP]) = Reg[13];		// Move argument to stack
+	Reg[SP] = Reg[SP] - 8;		// Make space on stack for argument
+	MEM(int, Reg[SP]) = Reg[12];		// Move argument to stack
+	Reg[SP] = Reg[SP] - 8;		// Make space on stack for argument
+	MEM(int, Reg[SP]) = Reg[11];		// Move argument to stack
+	Reg[SP] = Reg[SP] - 8;		// Make space on stack for argument
+	MEM(int, Reg[SP]) = Reg[10];		// Move argument to stack
+	Reg[SP] = Reg[SP] - 8;		// Make space on stack for argument
+	MEM(int, Reg[SP]) = Reg[9];		// Move argument to stack
+	Reg[SP] = Reg[SP] - 8;		// Make space on stack for argument
+	MEM(int, Reg[SP]) = Reg[8];		// Move argument to stack
+	Reg[SP] = Reg[SP] - 8;		// Make space on stack for argument
+	MEM(int, Reg[SP]) = Reg[7];		// Move argument to stack
+	Reg[SP] = Reg[SP] - 8;		// Make space on stack for argument
+	MEM(int, Reg[SP]) = Reg[6];		// Move argument to stack
+	Reg[SP] = Reg[SP] - 8;		// Make space on stack for argument
+	MEM(int, Reg[SP]) = Reg[5];		// Move argument to stack
+	Reg[SP] = Reg[SP] - 8;		// Make space on stack for argument
+	MEM(int, Reg[SP]) = Reg[4];		// Move argument to stack
+	Reg[SP] = Reg[SP] - 8;		// Make space on stack for argument
+	MEM(int, Reg[SP]) = Reg[3];		// Move argument to stack
+	Reg[SP] = Reg[SP] - 8;		// Make space on stack for argument
+	MEM(int, Reg[SP]) = Reg[2];		// Move argument to stack
+	Reg[SP] = Reg[SP] - 8;		// Make space on stack for argument
+	MEM(int, Reg[SP]) = Reg[1];		// Move argument to stack
+	Reg[SP] = Reg[SP] - 8;		// Make space on stack for argument
+	MEM(int, Reg[SP]) = Reg[0];		// Move argument to stack
+	Reg[SP] = Reg[SP] - 8;		// Allocate space for return address
+	Reg[0] = (long long)&&postframed6;
+	MEM(long long, Reg[SP]) = Reg[0];		// save return address
+	Reg[SP] = Reg[SP] - 8;		// Allocate space for FP
+	MEM(long long, Reg[SP]) = Reg[FP];		// Save frame pointer
+	Reg[FP] = Reg[SP];		// Move frame pointer to new position
+	goto framed;		// jump to procedure
+postframed6:
+	Reg[SP] = Reg[SP] + 8;		// Free input parameter
+	Reg[SP] = Reg[SP] + 8;		// Free input parameter
+	Reg[SP] = Reg[SP] + 8;		// Free input parameter
+	Reg[SP] = Reg[SP] + 8;		// Free input parameter
+	Reg[SP] = Reg[SP] + 8;		// Free input parameter
+	Reg[SP] = Reg[SP] + 8;		// Free input parameter
+	Reg[SP] = Reg[SP] + 8;		// Free input parameter
+	Reg[SP] = Reg[SP] + 8;		// Free input parameter
+	Reg[SP] = Reg[SP] + 8;		// Free input parameter
+	Reg[SP] = Reg[SP] + 8;		// Free input parameter
+	Reg[SP] = Reg[SP] + 8;		// Free input parameter
+	Reg[SP] = Reg[SP] + 8;		// Free input parameter
+	Reg[SP] = Reg[SP] + 8;		// Free input parameter
+	Reg[SP] = Reg[SP] + 8;		// Free input parameter
+	Reg[SP] = Reg[SP] + 8;		// Free input parameter
+	Reg[SP] = Reg[SP] + 8;		// Free input parameter
+	Reg[SP] = Reg[SP] + 8;		// Free input parameter
+	Reg[SP] = Reg[SP] + 8;		// Free input parameter
+	Reg[SP] = Reg[SP] + 8;		// Free input parameter
+	Reg[SP] = Reg[SP] + 8;		// Free input parameter
+	Reg[SP] = Reg[SP] + 8;		// Free input parameter
+	Reg[SP] = Reg[SP] + 8;		// Free input parameter
+	Reg[SP] = Reg[SP] + 8;		// Free input parameter
+	Reg[SP] = Reg[SP] + 8;		// Free input parameter
+	Reg[SP] = Reg[SP] + 8;		// Free input parameter
+	Reg[SP] = Reg[SP] + 8;		// Free input parameter
+	Reg[SP] = Reg[SP] + 8;		// Free input parameter
+	Reg[SP] = Reg[SP] + 8;		// Free input parameter
+	Reg[SP] = Reg[SP] + 8;		// Free input parameter
+	Reg[SP] = Reg[SP] + 8;		// Free input parameter
+	Reg[SP] = Reg[SP] + 8;		// Free array reference
+	Reg[SP] = Reg[SP] + 8;		// Free input parameter
+	Reg[0] = MEM(long long, Reg[SP]);		// Get address of out param off stack
+	Reg[SP] = Reg[SP] + 8;
+	MEM(int, Reg[0]) = MEM(int, Reg[SP]);		// Get out param off stack
+	Reg[SP] = Reg[SP] + 8;		// Free output parameter
+	Reg[SP] = Reg[SP] + 8;		// Free input parameter
+	Reg[SP] = Reg[SP] + 88;		// Free arguments passed on the stack
+	Reg[0] = (long long)MEM(int, Reg[FP] - 8);		// operand
+	lv12 = Reg[0];		// Pass argument
+	ret11 = &&postputinteger7;
+	goto putinteger;		// jump to leaf procedure
+postputinteger7:
+	Reg[0] = (long long)v17 + 0;		// expression = operand1 op operand2
+	Reg[1] = (long long)v17 + 1;		// expression = operand1 op operand2
+	Reg[2] = (long long)v17 + 2;		// expression = operand1 op operand2
+	Reg[3] = (long long)v17 + 3;		// expression = operand1 op operand2
+	Reg[4] = (long long)v17 + 4;		// expression = operand1 op operand2
+	Reg[5] = (long long)v17 + 5;		// expression = operand1 op operand2
+	Reg[6] = (long long)v17 + 6;		// expression = operand1 op operand2
+	Reg[7] = (long long)v17 + 7;		// expression = operand1 op operand2
+	Reg[8] = (long long)v17 + 8;		// expression = operand1 op operand2
+	Reg[9] = (long long)v17 + 9;		// expression = operand1 op operand2
+	Reg[10] = (long long)v17 + 10;		// expression = operand1 op operand2
+	Reg[11] = (long long)v17 + 11;		// expression = operand1 op operand2
+	Reg[12] = (long long)v17 + 12;		// expression = operand1 op operand2
+	Reg[13] = (long long)v17 + 13;		// expression = operand1 op operand2
+	Reg[14] = (long long)v17 + 14;		// expression = operand1 op operand2
+	Reg[15] = (long long)v17 + 15;		// expression = operand1 op operand2
+	Reg[16] = (long long)v17 + 16;		// expression = operand1 op operand2
+	Reg[17] = (long long)v17 + 17;		// expression = operand1 op operand2
+	Reg[18] = (long long)v17 + 18;		// expression = operand1 op operand2
+	Reg[19] = (long long)v17 + 19;		// expression = operand1 op operand2
+	Reg[20] = (long long)v17 + 20;		// expression = operand1 op operand2
+	Reg[21] = (long long)v17 + 21;		// expression = operand1 op operand2
+	Reg[22] = (long long)v17 + 22;		// expression = operand1 op operand2
+	Reg[23] = (long long)v17 + 23;		// expression = operand1 op operand2
+	Reg[24] = (long long)v17 + 24;		// expression = operand1 op operand2
+	Reg[SP] = Reg[SP] - 8;
+	MEM(long long, Reg[SP]) = Reg[24];		// Pass argument on the stack, registers are full
+	Reg[24] = (long long)v17 + 25;		// expression = operand1 op operand2
+	Reg[SP] = Reg[SP] - 8;
+	MEM(long long, Reg[SP]) = Reg[24];		// Pass argument on the stack, registers are full
+	Reg[24] = (long long)v17 + 26;		// expression = operand1 op operand2
+	Reg[SP] = Reg[SP] - 8;
+	MEM(long long, Reg[SP]) = Reg[24];		// Pass argument on the stack, registers are full
+	Reg[24] = (long long)v17 + 27;		// expression = operand1 op operand2
+	Reg[SP] = Reg[SP] - 8;
+	MEM(long long, Reg[SP]) = Reg[24];		// Pass argument on the stack, registers are full
+	Reg[24] = (long long)v17 + 28;		// expression = operand1 op operand2
+	Reg[SP] = Reg[SP] - 8;
+	MEM(long long, Reg[SP]) = Reg[24];		// Pass argument on the stack, registers are full
+	Reg[24] = (long long)v17 + 29;		// expression = operand1 op operand2
+	Reg[SP] = Reg[SP] - 8;
+	MEM(long long, Reg[SP]) = Reg[24];		// Pass argument on the stack, registers are full
+	Reg[24] = (Reg[FP] - 24);		// operand
+	Reg[SP] = Reg[SP] - 8;
+	MEM(long long, Reg[SP]) = Reg[24];		// Pass argument on the stack, registers are full
+	*((double*)&Reg[24]) = v18 + 1;		// expression = operand1 op operand2
+	Reg[SP] = Reg[SP] - 8;
+	MEM(long long, Reg[SP]) = Reg[24];		// Pass argument on the stack, registers are full
+	Reg[24] = (Reg[FP] - 8);		// operand
+	Reg[25] = MEM(int, Reg[24]);		// Value of out argument
+	Reg[SP] = Reg[SP] - 8;
+	MEM(long long, Reg[SP]) = Reg[24];		// Pass argument on the stack, registers are full
+	Reg[SP] = Reg[SP] - 8;
+	MEM(long long, Reg[SP]) = Reg[25];		// Pass argument on the stack, registers are full
+	Reg[24] = 3;		// operand
+	Reg[SP] = Reg[SP] - 8;
+	MEM(long long, Reg[SP]) = Reg[24];		// Pass argument on the stack, registers are full
+	Reg[24] = Reg[SP];		// Arguments passed on the stack
+	Reg[SP] = Reg[SP] - 8;		// Make space on stack for argument
+	MEM(int, Reg[SP]) = MEM(long long, Reg[24] + 0);		// Move argument to stack
+	Reg[SP] = Reg[SP] - 8;		// Make space on stack for argument
+	MEM(int, Reg[SP]) = MEM(long long, Reg[24] + 8);		// Move argument to stack
+	Reg[SP] = Reg[SP] - 8;		// Allocate space for out param address
+	MEM(long long, Reg[SP]) = MEM(long long, Reg[24] + 16);		// Push address for out parameter onto stack
+	Reg[SP] = Reg[SP] - 8;		// Make space on stack for argument
+	MEM(double, Reg[SP]) = MEM(double, Reg[24] + 24);		// Move argument to stack
+	Reg[SP] = Reg[SP] - 8;
+	MEM(long long, Reg[SP]) = MEM(long long, Reg[24] + 32);		// Pass array by reference
+	Reg[SP] = Reg[SP] - 8;		// Make space on stack for argument
+	MEM(int, Reg[SP]) = MEM(long long, Reg[24] + 40);		// Move argument to stack
+	Reg[SP] = Reg[SP] - 8;		// Make space on stack for argument
+	MEM(int, Reg[SP]) = MEM(long long, Reg[24] + 48);		// Move argument to stack
+	Reg[SP] = Reg[SP] - 8;		// Make space on stack for argument
+	MEM(int, Reg[SP]) = MEM(long long, Reg[24] + 56);		// Move argument to stack
+	Reg[SP] = Reg[SP] - 8;		// Make space on stack for argument
+	MEM(int, Reg[SP]) = MEM(long long, Reg[24] + 64);		// Move argument to stack
+	Reg[SP] = Reg[SP] - 8;		// Make space on stack for argument
+	MEM(int, Reg[SP]) = MEM(long long, Reg[24] + 72);		// Move argument to stack
+	Reg[SP] = Reg[SP] - 8;		// Make space on stack for argument
+	MEM(int, Reg[SP]) = MEM(long long, Reg[24] + 80);		// Move argument to stack
+	Reg[SP] = Reg[SP] - 8;		// Make space on stack for argument
+	MEM(int, Reg[SP]) = Reg[23];		// Move argument to stack
+	Reg[SP] = Reg[SP] - 8;		// Make space on stack for argument
+	MEM(int, Reg[SP]) = Reg[22];		// Move argument to stack
+	Reg[SP] = Reg[SP] - 8;		// Make space on stack for argument
+	MEM(int, Reg[SP]) = Reg[21];		// Move argument to stack
+	Reg[SP] = Reg[SP] - 8;		// Make space on stack for argument
+	MEM(int, Reg[SP]) = Reg[20];		// Move argument to stack
+	Reg[SP] = Reg[SP] - 8;		// Make space on stack for argument
+	MEM(int, Reg[SP]) = Reg[19];		// Move argument to stack
+	Reg[SP] = Reg[SP] - 8;		// Make space on stack for argument
+	MEM(int, Reg[SP]) = Reg[18];		// Move argument to stack
+	Reg[SP] = Reg[SP] - 8;		// Make space on stack for argument
+	MEM(int, Reg[SP]) = Reg[17];		// Move argument to stack
+	Reg[SP] = Reg[SP] - 8;		// Make space on stack for argument
+	MEM(int, Reg[SP]) = Reg[16];		// Move argument to stack
+	Reg[SP] = Reg[SP] - 8;		// Make space on stack for argument
+	MEM(int, Reg[SP]) = Reg[15];		// Move argument to stack
+	Reg[SP] = Reg[SP] - 8;		// Make space on stack for argument
+	MEM(int, Reg[SP]) = Reg[14];		// Move argument to stack
+	Reg[SP] = Reg[SP] - 8;		// Make space on stack for argument
+	MEM(int, Reg[SP]) = Reg[13];		// Move argument to stack
+	Reg[SP] = Reg[SP] - 8;		// Make space on stack for argument
+	MEM(int, Reg[SP]) = Reg[12];		// Move argument to stack
+	Reg[SP] = Reg[SP] - 8;		// Make space on stack for argument
+	MEM(int, Reg[SP]) = Reg[11];		// Move argument to stack
+	Reg[SP] = Reg[SP] - 8;		// Make space on stack for argument
+	MEM(int, Reg[SP]) = Reg[10];		// Move argument to stack
+	Reg[SP] = Reg[SP] - 8;		// Make space on stack for argument
+	MEM(int, Reg[SP]) = Reg[9];		// Move argument to stack
+	Reg[SP] = Reg[SP] - 8;		// Make space on stack for argument
+	MEM(int, Reg[SP]) = Reg[8];		// Move argument to stack
+	Reg[SP] = Reg[SP] - 8;		// Make space on stack for argument
+	MEM(int, Reg[SP]) = Reg[7];		// Move argument to stack
+	Reg[SP] = Reg[SP] - 8;		// Make space on stack for argument
+	MEM(int, Reg[SP]) = Reg[6];		// Move argument to stack
+	Reg[SP] = Reg[SP] - 8;		// Make space on stack for argument
+	MEM(int, Reg[SP]) = Reg[5];		// Move argument to stack
+	Reg[SP] = Reg[SP] - 8;		// Make space on stack for argument
+	MEM(int, Reg[SP]) = Reg[4];		// Move argument to stack
+	Reg[SP] = Reg[SP] - 8;		// Make space on stack for argument
+	MEM(int, Reg[SP]) = Reg[3];		// Move argument to stack
+	Reg[SP] = Reg[SP] - 8;		// Make space on stack for argument
+	MEM(int, Reg[SP]) = Reg[2];		// Move argument to stack
+	Reg[SP] = Reg[SP] - 8;		// Make space on stack for argument
+	MEM(int, Reg[SP]) = Reg[1];		// Move argument to stack
+	Reg[SP] = Reg[SP] - 8;		// Make space on stack for argument
+	MEM(int, Reg[SP]) = Reg[0];		// Move argument to stack
+	Reg[SP] = Reg[SP] - 8;		// Allocate space for return address
+	Reg[0] = (long long)&&postframed8;
+	MEM(long long, Reg[SP]) = Reg[0];		// save return address
+	Reg[SP] = Reg[SP] - 8;		// Allocate space for FP
+	MEM(long long, Reg[SP]) = Reg[FP];		// Save frame pointer
+	Reg[FP] = Reg[SP];		// Move frame pointer to new position
+	goto framed;		// jump to procedure
+postframed8:
+	Reg[SP] = Reg[SP] + 8;		// Free input parameter
+	Reg[SP] = Reg[SP] + 8;		// Free input parameter
+	Reg[SP] = Reg[SP] + 8;		// Free input parameter
+	Reg[SP] = Reg[SP] + 8;		// Free input parameter
+	Reg[SP] = Reg[SP] + 8;		// Free input parameter
+	Reg[SP] = Reg[SP] + 8;		// Free input parameter
+	Reg[SP] = Reg[SP] + 8;		// Free input parameter
+	Reg[SP] = Reg[SP] + 8;		// Free input parameter
+	Reg[SP] = Reg[SP] + 8;		// Free input parameter
+	Reg[SP] = Reg[SP] + 8;		// Free input parameter
+	Reg[SP] = Reg[SP] + 8;		// Free input parameter
+	Reg[SP] = Reg[SP] + 8;		// Free input parameter
+	Reg[SP] = Reg[SP] + 8;		// Free input parameter
+	Reg[SP] = Reg[SP] + 8;		// Free input parameter
+	Reg[SP] = Reg[SP] + 8;		// Free input parameter
+	Reg[SP] = Reg[SP] + 8;		// Free input parameter
+	Reg[SP] = Reg[SP] + 8;		// Free input parameter
+	Reg[SP] = Reg[SP] + 8;		// Free input parameter
+	Reg[SP] = Reg[SP] + 8;		// Free input parameter
+	Reg[SP] = Reg[SP] + 8;		// Free input parameter
+	Reg[SP] = Reg[SP] + 8;		// Free input parameter
+	Reg[SP] = Reg[SP] + 8;		// Free input parameter
+	Reg[SP] = Reg[SP] + 8;		// Free input parameter
+	Reg[SP] = Reg[SP] + 8;		// Free input parameter
+	Reg[SP] = Reg[SP] + 8;		// Free input parameter
+	Reg[SP] = Reg[SP] + 8;		// Free input parameter
+	Reg[SP] = Reg[SP] + 8;		// Free input parameter
+	Reg[SP] = Reg[SP] + 8;		// Free input parameter
+	Reg[SP] = Reg[SP] + 8;		// Free input parameter
+	Reg[SP] = Reg[SP] + 8;		// Free input parameter
+	Reg[SP] = Reg[SP] + 8;		// Free array reference
+	Reg[SP] = Reg[SP] + 8;		// Free input parameter
+	Reg[0] = MEM(long long, Reg[SP]);		// Get address of out param off stack
+	Reg[SP] = Reg[SP] + 8;
+	MEM(int, Reg[0]) = MEM(int, Reg[SP]);		// Get out param off stack
+	Reg[SP] = Reg[SP] + 8;		// Free output parameter
+	Reg[SP] = Reg[SP] + 8;		// Free input parameter
+	Reg[SP] = Reg[SP] + 88;		// Free arguments passed on the stack
+	Reg[0] = (long long)v17 + 0;		// expression = operand1 op operand2
+	Reg[1] = (long long)v17 + 1;		// expression = operand1 op operand2
+	Reg[2] = (long long)v17 + 2;		// expression = operand1 op operand2
+	Reg[3] = (long long)v17 + 3;		// expression = operand1 op operand2
+	Reg[4] = (long long)v17 + 4;		// expression = operand1 op operand2
+	Reg[5] = (long long)v17 + 5;		// expression = operand1 op operand2
+	Reg[6] = (long long)v17 + 6;		// expression = operand1 op operand2
+	Reg[7] = (long long)v17 + 7;		// expression = operand1 op operand2
+	Reg[8] = (long long)v17 + 8;		// expression = operand1 op operand2
+	Reg[9] = (long long)v17 + 9;		// expression = operand1 op operand2
+	Reg[10] = (long long)v17 + 10;		// expression = operand1 op operand2
+	Reg[11] = (long long)v17 + 11;		// expression = operand1 op operand2
+	Reg[12] = (long long)v17 + 12;		// expression = operand1 op operand2
+	Reg[13] = (long long)v17 + 13;		// expression = operand1 op operand2
+	Reg[14] = (long long)v17 + 14;		// expression = operand1 op operand2
+	Reg[15] = (long long)v17 + 15;		// expression = operand1 op operand2
+	Reg[16] = (long long)v17 + 16;		// expression = operand1 op operand2
+	Reg[17] = (long long)v17 + 17;		// expression = operand1 op operand2
+	Reg[18] = (long long)v17 + 18;		// expression = operand1 op operand2
+	Reg[19] = (long long)v17 + 19;		// expression = operand1 op operand2
+	Reg[20] = (long long)v17 + 20;		// expression = operand1 op operand2
+	Reg[21] = (long long)v17 + 21;		// expression = operand1 op operand2
+	Reg[22] = (long long)v17 + 22;		// expression = operand1 op operand2
+	Reg[23] = (long long)v17 + 23;		// expression = operand1 op operand2
+	Reg[24] = (long long)v17 + 24;		// expression = operand1 op operand2
+	Reg[SP] = Reg[SP] - 8;
+	MEM(long long, Reg[SP]) = Reg[24];		// Pass argument on the stack, registers are full
+	Reg[24] = (long long)v17 + 25;		// expression = operand1 op operand2
+	Reg[SP] = Reg[SP] - 8;
+	MEM(long long, Reg[SP]) = Reg[24];		// Pass argument on the stack, registers are full
+	Reg[24] = (long long)v17 + 26;		// expression = operand1 op operand2
+	Reg[SP] = Reg[SP] - 8;
+	MEM(long long, Reg[SP]) = Reg[24];		// Pass argument on the stack, registers are full
+	Reg[24] = (long long)v17 + 27;		// expression = operand1 op operand2
+	Reg[SP] = Reg[SP] - 8;
+	MEM(long long, Reg[SP]) = Reg[24];		// Pass argument on the stack, registers are full
+	Reg[24] = (long long)v17 + 28;		// expression = operand1 op operand2
+	Reg[SP] = Reg[SP] - 8;
+	MEM(long long, Reg[SP]) = Reg[24];		// Pass argument on the stack, registers are full
+	Reg[24] = (long long)v17 + 29;		// expression = operand1 op operand2
+	Reg[SP] = Reg[SP] - 8;
+	MEM(long long, Reg[SP]) = Reg[24];		// Pass argument on the stack, registers are full
+	Reg[24] = (Reg[FP] - 24);		// operand
+	Reg[SP] = Reg[SP] - 8;
+	MEM(long long, Reg[SP]) = Reg[24];		// Pass argument on the stack, registers are full
+	*((double*)&Reg[24]) = v18;		// operand
+	Reg[SP] = Reg[SP] - 8;
+	MEM(long long, Reg[SP]) = Reg[24];		// Pass argument on the stack, registers are full
+	Reg[24] = (Reg[FP] - 8);		// operand
+	Reg[25] = MEM(int, Reg[24]);		// Value of out argument
+	Reg[SP] = Reg[SP] - 8;
+	MEM(long long, Reg[SP]) = Reg[24];		// Pass argument on the stack, registers are full
+	Reg[SP] = Reg[SP] - 8;
+	MEM(long long, Reg[SP]) = Reg[25];		// Pass argument on the stack, registers are full
+	Reg[24] = 4;		// operand
+	Reg[SP] = Reg[SP] - 8;
+	MEM(long long, Reg[SP]) = Reg[24];		// Pass argument on the stack, registers are full
+	Reg[24] = Reg[SP];		// Arguments passed on the stack
+	lv117 = MEM(long long, Reg[24] + 0);		// Pass argument
+	lv116 = MEM(long long, Reg[24] + 8);		// Pass argument
+	lv116_address = MEM(long long, Reg[24] + 16);
+	lv115 = MEM(double, Reg[24] + 24);		// Pass argument
+	lv114 = MEM(long long, Reg[24] + 32);		// Pass array by reference
+	lv113 = MEM(long long, Reg[24] + 40);		// Pass argument
+	lv112 = MEM(long long, Reg[24] + 48);		// Pass argument
+	lv111 = MEM(long long, Reg[24] + 56);		// Pass argument
+	lv110 = MEM(long long, Reg[24] + 64);		// Pass argument
+	lv109 = MEM(long long, Reg[24] + 72);		// Pass argument
+	lv108 = MEM(long long, Reg[24] + 80);		// Pass argument
+	lv107 = Reg[23];		// Pass argument
+	lv106 = Reg[22];		// Pass argument
+	lv105 = Reg[21];		// Pass argument
+	lv104 = Reg[20];		// Pass argument
+	lv103 = Reg[19];		// Pass argument
+	lv102 = Reg[18];		// Pass argument
+	lv101 = Reg[17];		// Pass argument
+	lv100 = Reg[16];		// Pass argument
+	lv99 = Reg[15];		// Pass argument
+	lv98 = Reg[14];		// Pass argument
+	lv97 = Reg[13];		// Pass argument
+	lv96 = Reg[12];		// Pass argument
+	lv95 = Reg[11];		// Pass argument
+	lv94 = Reg[10];		// Pass argument
+	lv93 = Reg[9];		// Pass argument
+	lv92 = Reg[8];		// Pass argument
+	lv91 = Reg[7];		// Pass argument
+	lv90 = Reg[6];		// Pass argument
+	lv89 = Reg[5];		// Pass argument
+	lv88 = Reg[4];		// Pass argument
+	lv87 = Reg[3];		// Pass argument
+	lv86 = Reg[2];		// Pass argument
+	lv85 = Reg[1];		// Pass argument
+	lv84 = Reg[0];		// Pass argument
+	ret83 = &&postleaf9;
+	goto leaf;		// jump to leaf procedure
+postleaf9:
+	MEM(int, lv116_address) = lv116;		// Store out argument
+	Reg[SP] = Reg[SP] + 88;		// Free arguments passed on the stack
+	Reg[0] = (long long)MEM(int, Reg[FP] - 8);		// operand
+	lv12 = Reg[0];		// Pass argument
+	ret11 = &&postputinteger10;
+	goto putinteger;		// jump to leaf procedure
+postputinteger10:
+	Reg[0] = (long long)v17 + 0;		// expression = operand1 op operand2
+	Reg[1] = (long long)v17 + 1;		// expression = operand1 op operand2
+	Reg[2] = (long long)v17 + 2;		// expression = operand1 op operand2
+	Reg[3] = (long long)v17 + 3;		// expression = operand1 op operand2
+	Reg[4] = (long long)v17 + 4;		// expression = operand1 op operand2
+	Reg[5] = (long long)v17 + 5;		// expression = operand1 op operand2
+	Reg[6] = (long long)v17 + 6;		// expression = operand1 op operand2
+	Reg[7] = (long long)v17 + 7;		// expression = operand1 op operand2
+	Reg[8] = (long long)v17 + 8;		// expression = operand1 op operand2
+	Reg[9] = (long long)v17 + 9;		// expression = operand1 op operand2
+	Reg[10] = (long long)v17 + 10;		// expression = operand1 op operand2
+	Reg[11] = (long long)v17 + 11;		// expression = operand1 op operand2
+	Reg[12] = (long long)v17 + 12;		// expression = operand1 op operand2
+	Reg[13] = (long long)v17 + 13;		// expression = operand1 op operand2
+	Reg[14] = (long long)v17 + 14;		// expression = operand1 op operand2
+	Reg[15] = (long long)v17 + 15;		// expression = operand1 op operand2
+	Reg[16] = (long long)v17 + 16;		// expression = operand1 op operand2
+	Reg[17] = (long long)v17 + 17;		// expression = operand1 op operand2
+	Reg[18] = (long long)v17 + 18;		// expression = operand1 op operand2
+	Reg[19] = (long long)v17 + 19;		// expression = operand1 op operand2
+	Reg[20] = (long long)v17 + 20;		// expression = operand1 op operand2
+	Reg[21] = (long long)v17 + 21;		// expression = operand1 op operand2
+	Reg[22] = (long long)v17 + 22;		// expression = operand1 op operand2
+	Reg[23] = (long long)v17 + 23;		// expression = operand1 op operand2
+	Reg[24] = (long long)v17 + 24;		// expression = operand1 op operand2
+	Reg[SP] = Reg[SP] - 8;
+	MEM(long long, Reg[SP]) = Reg[24];		// Pass argument on the stack, registers are full
+	Reg[24] = (long long)v17 + 25;		// expression = operand1 op operand2
+	Reg[SP] = Reg[SP] - 8;
+	MEM(long long, Reg[SP]) = Reg[24];		// Pass argument on the stack, registers are full
+	Reg[24] = (long long)v17 + 26;		// expression = operand1 op operand2
+	Reg[SP] = Reg[SP] - 8;
+	MEM(long long, Reg[SP]) = Reg[24];		// Pass argument on the stack, registers are full
+	Reg[24] = (long long)v17 + 27;		// expression = operand1 op operand2
+	Reg[SP] = Reg[SP] - 8;
+	MEM(long long, Reg[SP]) = Reg[24];		// Pass argument on the stack, registers are full
+	Reg[24] = (long long)v17 + 28;		// expression = operand1 op operand2
+	Reg[SP] = Reg[SP] - 8;
+	MEM(long long, Reg[SP]) = Reg[24];		// Pass argument on the stack, registers are full
+	Reg[24] = (long long)v17 + 29;		// expression = operand1 op operand2
+	Reg[SP] = Reg[SP] - 8;
+	MEM(long long, Reg[SP]) = Reg[24];		// Pass argument on the stack, registers are full
+	Reg[24] = (Reg[FP] - 24);		// operand
+	Reg[SP] = Reg[SP] - 8;
+	MEM(long long, Reg[SP]) = Reg[24];		// Pass argument on the stack, registers are full
+	*((double*)&Reg[24]) = v18;		// operand
+	Reg[SP] = Reg[SP] - 8;
+	MEM(long long, Reg[SP]) = Reg[24];		// Pass argument on the stack, registers are full
+	Reg[24] = (Reg[FP] - 8);		// operand
+	Reg[25] = MEM(int, Reg[24]);		// Value of out argument
+	Reg[SP] = Reg[SP] - 8;
+	MEM(long long, Reg[SP]) = Reg[24];		// Pass argument on the stack, registers are full
+	Reg[SP] = Reg[SP] - 8;
+	MEM(long long, Reg[SP]) = Reg[25];		// Pass argument on the stack, registers are full
+	Reg[24] = 5;		// operand
+	Reg[SP] = Reg[SP] - 8;
+	MEM(long long, Reg[SP]) = Reg[24];		// Pass argument on the stack, registers are full
+	Reg[24] = Reg[SP];		// Arguments passed on the stack
+	lv117 = MEM(long long, Reg[24] + 0);		// Pass argument
+	lv116 = MEM(long long, Reg[24] + 8);		// Pass argument
+	lv116_address = MEM(long long, Reg[24] + 16);
+	lv115 = MEM(double, Reg[24] + 24);		// Pass argument
+	lv114 = MEM(long long, Reg[24] + 32);		// Pass array by reference
+	lv113 = MEM(long long, Reg[24] + 40);		// Pass argument
+	lv112 = MEM(long long, Reg[24] + 48);		// Pass argument
+	lv111 = MEM(long long, Reg[24] + 56);		// Pass argument
+	lv110 = MEM(long long, Reg[24] + 64);		// Pass argument
+	lv109 = MEM(long long, Reg[24] + 72);		// Pass argument
+	lv108 = MEM(long long, Reg[24] + 80);		// Pass argument
+	lv107 = Reg[23];		// Pass argument
+	lv106 = Reg[22];		// Pass argument
+	lv105 = Reg[21];		// Pass argument
+	lv104 = Reg[20];		// Pass argument
+	lv103 = Reg[19];		// Pass argument
+	lv102 = Reg[18];		// Pass argument
+	lv101 = Reg[17];		// Pass argument
+	lv100 = Reg[16];		// Pass argument
+	lv99 = Reg[15];		// Pass argument
+	lv98 = Reg[14];		// Pass argument
+	lv97 = Reg[13];		// Pass argument
+	lv96 = Reg[12];		// Pass argument
+	lv95 = Reg[11];		// Pass argument
+	lv94 = Reg[10];		// Pass argument
+	lv93 = Reg[9];		// Pass argument
+	lv92 = Reg[8];		// Pass argument
+	lv91 = Reg[7];		// Pass argument
+	lv90 = Reg[6];		// Pass argument
+	lv89 = Reg[5];		// Pass argument
+	lv88 = Reg[4];		// Pass argument
+	lv87 = Reg[3];		// Pass argument
+	lv86 = Reg[2];		// Pass argument
+	lv85 = Reg[1];		// Pass argument
+	lv84 = Reg[0];		// Pass argument
+	ret83 = &&postleaf11;
+	goto leaf;		// jump to leaf procedure
+postleaf11:
+	MEM(int, lv116_address) = lv116;		// Store out argument
+	Reg[SP] = Reg[SP] + 88;		// Free arguments passed on the stack
+	Reg[0] = (long long)MEM(int, Reg[FP] - 8);		// operand
+	lv12 = Reg[0];		// Pass argument
+	ret11 = &&postputinteger12;
+	goto putinteger;		// jump to leaf procedure
+postputinteger12:
+	Reg[0] = (long long)v17 + 0;		// expression = operand1 op operand2
+	Reg[1] = (long long)v17 + 1;		// expression = operand1 op operand2
+	Reg[2] = (long long)v17 + 2;		// expression = operand1 op operand2
+	Reg[3] = (long long)v17 + 3;		// expression = operand1 op operand2
+	Reg[4] = (long long)v17 + 4;		// expression = operand1 op operand2
+	Reg[5] = (long long)v17 + 5;		// expression = operand1 op operand2
+	Reg[6] = (long long)v17 + 6;		// expression = operand1 op operand2
+	Reg[7] = (long long)v17 + 7;		// expression = operand1 op operand2
+	Reg[8] = (long long)v17 + 8;		// expression = operand1 op operand2
+	Reg[9] = (long long)v17 + 9;		// expression = operand1 op operand2
+	Reg[10] = (long long)v17 + 10;		// expression = operand1 op operand2
+	Reg[11] = (long long)v17 + 11;		// expression = operand1 op operand2
+	Reg[12] = (long long)v17 + 12;		// expression = operand1 op operand2
+	Reg[13] = (long long)v17 + 13;		// expression = operand1 op operand2
+	Reg[14] = (long long)v17 + 14;		// expression = operand1 op operand2
+	Reg[15] = (long long)v17 + 15;		// expression = operand1 op operand2
+	Reg[16] = (long long)v17 + 16;		// expression = operand1 op operand2
+	Reg[17] = (long long)v17 + 17;		// expression = operand1 op operand2
+	Reg[18] = (long long)v17 + 18;		// expression = operand1 op operand2
+	Reg[19] = (long long)v17 + 19;		// expression = operand1 op operand2
+	Reg[20] = (long long)v17 + 20;		// expression = operand1 op operand2
+	Reg[21] = (long long)v17 + 21;		// expression = operand1 op operand2
+	Reg[22] = (long long)v17 + 22;		// expression = operand1 op operand2
+	Reg[23] = (long long)v17 + 23;		// expression = operand1 op operand2
+	Reg[24] = (long long)v17 + 24;		// expression = operand1 op operand2
+	Reg[SP] = Reg[SP] - 8;
+	MEM(long long, Reg[SP]) = Reg[24];		// Pass argument on the stack, registers are full
+	Reg[24] = (long long)v17 + 25;		// expression = operand1 op operand2
+	Reg[SP] = Reg[SP] - 8;
+	MEM(long long, Reg[SP]) = Reg[24];		// Pass argument on the stack, registers are full
+	Reg[24] = (long long)v17 + 26;		// expression = operand1 op operand2
+	Reg[SP] = Reg[SP] - 8;
+	MEM(long long, Reg[SP]) = Reg[24];		// Pass argument on the stack, registers are full
+	Reg[24] = (long long)v17 + 27;		// expression = operand1 op operand2
+	Reg[SP] = Reg[SP] - 8;
+	MEM(long long, Reg[SP]) = Reg[24];		// Pass argument on the stack, registers are full
+	Reg[24] = (long long)v17 + 28;		// expression = operand1 op operand2
+	Reg[SP] = Reg[SP] - 8;
+	MEM(long long, Reg[SP]) = Reg[24];		// Pass argument on the stack, registers are full
+	Reg[24] = (long long)v17 + 29;		// expression = operand1 op operand2
+	Reg[SP] = Reg[SP] - 8;
+	MEM(long long, Reg[SP]) = Reg[24];		// Pass argument on the stack, registers are full
+	Reg[24] = (Reg[FP] - 24);		// operand
+	Reg[SP] = Reg[SP] - 8;
+	MEM(long long, Reg[SP]) = Reg[24];		// Pass argument on the stack, registers are full
+	*((double*)&Reg[24]) = v18;		// operand
+	Reg[SP] = Reg[SP] - 8;
+	MEM(long long, Reg[SP]) = Reg[24];		// Pass argument on the stack, registers are full
+	Reg[24] = (Reg[FP] - 8);		// operand
+	Reg[25] = MEM(int, Reg[24]);		// Value of out argument
+	Reg[SP] = Reg[SP] - 8;
+	MEM(long long, Reg[SP]) = Reg[24];		// Pass argument on the stack, registers are full
+	Reg[SP] = Reg[SP] - 8;
+	MEM(long long, Reg[SP]) = Reg[25];		// Pass argument on the stack, registers are full
+	Reg[24] = 6;		// operand
+	Reg[SP] = Reg[SP] - 8;
+	MEM(long long, Reg[SP]) = Reg[24];		// Pass argument on the stack, registers are full
+	Reg[24] = Reg[SP];		// Arguments passed on the stack
+	lv216 = MEM(long long, Reg[24] + 0);		// Pass argument
+	lv215 = MEM(long long, Reg[24] + 8);		// Pass argument
+	lv215_address = MEM(long long, Reg[24] + 16);
+	lv214 = MEM(double, Reg[24] + 24);		// Pass argument
+	lv213 = MEM(long long, Reg[24] + 32);		// Pass array by reference
+	lv212 = MEM(long long, Reg[24] + 40);		// Pass argument
+	lv211 = MEM(long long, Reg[24] + 48);		// Pass argument
+	lv210 = MEM(long long, Reg[24] + 56);		// Pass argument
+	lv209 = MEM(long long, Reg[24] + 64);		// Pass argument
+	lv208 = MEM(long long, Reg[24] + 72);		// Pass argument
+	lv207 = MEM(long long, Reg[24] + 80);		// Pass argument
+	lv206 = Reg[23];		// Pass argument
+	lv205 = Reg[22];		// Pass argument
+	lv204 = Reg[21];		// Pass argument
+	lv203 = Reg[20];		// Pass argument
+	lv202 = Reg[19];		// Pass argument
+	lv201 = Reg[18];		// Pass argument
+	lv200 = Reg[17];		// Pass argument
+	lv199 = Reg[16];		// Pass argument
+	lv198 = Reg[15];		// Pass argument
+	lv197 = Reg[14];		// Pass argument
+	lv196 = Reg[13];		// Pass argument
+	lv195 = Reg[12];		// Pass argument
+	lv194 = Reg[11];		// Pass argument
+	lv193 = Reg[10];		// Pass argument
+	lv192 = Reg[9];		// Pass argument
+	lv191 = Reg[8];		// Pass argument
+	lv190 = Reg[7];		// Pass argument
+	lv189 = Reg[6];		// Pass argument
+	lv188 = Reg[5];		// Pass argument
+	lv187 = Reg[4];		// Pass argument
+	lv186 = Reg[3];		// Pass argument
+	lv185 = Reg[2];		// Pass argument
+	lv184 = Reg[1];		// Pass argument
+	lv183 = Reg[0];		// Pass argument
+	ret182 = &&postonce13;
+	goto once;		// jump to leaf procedure
+postonce13:
+	MEM(int, lv215_address) = lv215;		// Store out argument
+	Reg[SP] = Reg[SP] + 88;		// Free arguments passed on the stack
+	Reg[0] = (long long)MEM(int, Reg[FP] - 8);		// operand
+	lv12 = Reg[0];		// Pass argument
+	ret11 = &&postputinteger14;
+	goto putinteger;		// jump to leaf procedure
+postputinteger14:
+	Reg[0] = (long long)v17 + 0;		// expression = operand1 op operand2
+	Reg[1] = (long long)v17 + 1;		// expression = operand1 op operand2
+	Reg[2] = (long long)v17 + 2;		// expression = operand1 op operand2
+	Reg[3] = (long long)v17 + 3;		// expression = operand1 op operand2
+	Reg[4] = (long long)v17 + 4;		// expression = operand1 op operand2
+	Reg[5] = (long long)v17 + 5;		// expression = operand1 op operand2
+	Reg[6] = (long long)v17 + 6;		// expression = operand1 op operand2
+	Reg[7] = (long long)v17 + 7;		// expression = operand1 op operand2
+	Reg[8] = (long long)v17 + 8;		// expression = operand1 op operand2
+	Reg[9] = (long long)v17 + 9;		// expression = operand1 op operand2
+	Reg[10] = (long long)v17 + 10;		// expression = operand1 op operand2
+	Reg[11] = (long long)v17 + 11;		// expression = operand1 op operand2
+	Reg[12] = (long long)v17 + 12;		// expression = operand1 op operand2
+	Reg[13] = (long long)v17 + 13;		// expression = operand1 op operand2
+	Reg[14] = (long long)v17 + 14;		// expression = operand1 op operand2
+	Reg[15] = (long long)v17 + 15;		// expression = operand1 op operand2
+	Reg[16] = (long long)v17 + 16;		// expression = operand1 op operand2
+	Reg[17] = (long long)v17 + 17;		// expression = operand1 op operand2
+	Reg[18] = (long long)v17 + 18;		// expression = operand1 op operand2
+	Reg[19] = (long long)v17 + 19;		// expression = operand1 op operand2
+	Reg[20] = (long long)v17 + 20;		// expression = operand1 op operand2
+	Reg[21] = (long long)v17 + 21;		// expression = operand1 op operand2
+	Reg[22] = (long long)v17 + 22;		// expression = operand1 op operand2
+	Reg[23] = (long long)v17 + 23;		// expression = operand1 op operand2
+	Reg[24] = (long long)v17 + 24;		// expression = operand1 op operand2
+	Reg[SP] = Reg[SP] - 8;
+	MEM(long long, Reg[SP]) = Reg[24];		// Pass argument on the stack, registers are full
+	Reg[24] = (long long)v17 + 25;		// expression = operand1 op operand2
+	Reg[SP] = Reg[SP] - 8;
+	MEM(long long, Reg[SP]) = Reg[24];		// Pass argument on the stack, registers are full
+	Reg[24] = (long long)v17 + 26;		// expression = operand1 op operand2
+	Reg[SP] = Reg[SP] - 8;
+	MEM(long long, Reg[SP]) = Reg[24];		// Pass argument on the stack, registers are full
+	Reg[24] = (long long)v17 + 27;		// expression = operand1 op operand2
+	Reg[SP] = Reg[SP] - 8;
+	MEM(long long, Reg[SP]) = Reg[24];		// Pass argument on the stack, registers are full
+	Reg[24] = (long long)v17 + 28;		// expression = operand1 op operand2
+	Reg[SP] = Reg[SP] - 8;
+	MEM(long long, Reg[SP]) = Reg[24];		// Pass argument on the stack, registers are full
+	Reg[24] = (long long)v17 + 29;		// expression = operand1 op operand2
+	Reg[SP] = Reg[SP] - 8;
+	MEM(long long, Reg[SP]) = Reg[24];		// Pass argument on the stack, registers are full
+	Reg[24] = (Reg[FP] - 24);		// operand
+	Reg[SP] = Reg[SP] - 8;
+	MEM(long long, Reg[SP]) = Reg[24];		// Pass argument on the stack, registers are full
+	*((double*)&Reg[24]) = v18;		// operand
+	Reg[SP] = Reg[SP] - 8;
+	MEM(long long, Reg[SP]) = Reg[24];		// Pass argument on the stack, registers are full
+	Reg[24] = (Reg[FP] - 8);		// operand
+	Reg[25] = MEM(int, Reg[24]);		// Value of out argument
+	Reg[SP] = Reg[SP] - 8;
+	MEM(long long, Reg[SP]) = Reg[24];		// Pass argument on the stack, registers are full
+	Reg[SP] = Reg[SP] - 8;
+	MEM(long long, Reg[SP]) = Reg[25];		// Pass argument on the stack, registers are full
+	Reg[24] = 7;		// operand
+	Reg[SP] = Reg[SP] - 8;
+	MEM(long long, Reg[SP]) = Reg[24];		// Pass argument on the stack, registers are full
+	Reg[24] = Reg[SP];		// Arguments passed on the stack
+	Reg[SP] = Reg[SP] - 8;		// Make space on stack for argument
+	MEM(int, Reg[SP]) = MEM(long long, Reg[24] + 0);		// Move argument to stack
+	Reg[SP] = Reg[SP] - 8;		// Make space on stack for argument
+	MEM(int, Reg[SP]) = MEM(long long, Reg[24] + 8);		// Move argument to stack
+	Reg[SP] = Reg[SP] - 8;		// Allocate space for out param address
+	MEM(long long, Reg[SP]) = MEM(long long, Reg[24] + 16);		// Push address for out parameter onto stack
+	Reg[SP] = Reg[SP] - 8;		// Make space on stack for argument
+	MEM(double, Reg[SP]) = MEM(double, Reg[24] + 24);		// Move argument to stack
+	Reg[SP] = Reg[SP] - 8;
+	MEM(long long, Reg[SP]) = MEM(long long, Reg[24] + 32);		// Pass array by reference
+	Reg[SP] = Reg[SP] - 8;		// Make space on stack for argument
+	MEM(int, Reg[SP]) = MEM(long long, Reg[24] + 40);		// Move argument to stack
+	Reg[SP] = Reg[SP] - 8;		// Make space on stack for argument
+	MEM(int, Reg[SP]) = MEM(long long, Reg[24] + 48);		// Move argument to stack
+	Reg[SP] = Reg[SP] - 8;		// Make space on stack for argument
+	MEM(int, Reg[SP]) = MEM(long long, Reg[24] + 56);		// Move argument to stack
+	Reg[SP] = Reg[SP] - 8;		// Make space on stack for argument
+	MEM(int, Reg[SP]) = MEM(long long, Reg[24] + 64);		// Move argument to stack
+	Reg[SP] = Reg[SP] - 8;		// Make space on stack for argument
+	MEM(int, Reg[SP]) = MEM(long long, Reg[24] + 72);		// Move argument to stack
+	Reg[SP] = Reg[SP] - 8;		// Make space on stack for argument
+	MEM(int, Reg[SP]) = MEM(long long, Reg[24] + 80);		// Move argument to stack
+	Reg[SP] = Reg[SP] - 8;		// Make space on stack for argument
+	MEM(int, Reg[SP]) = Reg[23];		// Move argument to stack
+	Reg[SP] = Reg[SP] - 8;		// Make space on stack for argument
+	MEM(int, Reg[SP]) = Reg[22];		// Move argument to stack
+	Reg[SP] = Reg[SP] - 8;		// Make space on stack for argument
+	MEM(int, Reg[SP]) = Reg[21];		// Move argument to stack
+	Reg[SP] = Reg[SP] - 8;		// Make space on stack for argument
+	MEM(int, Reg[SP]) = Reg[20];		// Move argument to stack
+	Reg[SP] = Reg[SP] - 8;		// Make space on stack for argument
+	MEM(int, Reg[SP]) = Reg[19];		// Move argument to stack
+	Reg[SP] = Reg[SP] - 8;		// Make space on stack for argument
+	MEM(int, Reg[SP]) = Reg[18];		// Move argument to stack
+	Reg[SP] = Reg[SP] - 8;		// Make space on stack for argument
+	MEM(int, Reg[SP]) = Reg[17];		// Move argument to stack
+	Reg[SP] = Reg[SP] - 8;		// Make space on stack for argument
+	MEM(int, Reg[SP]) = Reg[16];		// Move argument to stack
+	Reg[SP] = Reg[SP] - 8;		// Make space on stack for argument
+	MEM(int, Reg[SP]) = Reg[15];		// Move argument to stack
+	Reg[SP] = Reg[SP] - 8;		// Make space on stack for argument
+	MEM(int, Reg[SP]) = Reg[14];		// Move argument to stack
+	Reg[SP] = Reg[SP] - 8;		// Make space on stack for argument
+	MEM(int, Reg[SP]) = Reg[13];		// Move argument to stack
+	Reg[SP] = Reg[SP] - 8;		// Make space on stack for argument
+	MEM(int, Reg[SP]) = Reg[12];		// Move argument to stack
+	Reg[SP] = Reg[SP] - 8;		// Make space on stack for argument
+	MEM(int, Reg[SP]) = Reg[11];		// Move argument to stack
+	Reg[SP] = Reg[SP] - 8;		// Make space on stack for argument
+	MEM(int, Reg[SP]) = Reg[10];		// Move argument to stack
+	Reg[SP] = Reg[SP] - 8;		// Make space on stack for argument
+	MEM(int, Reg[SP]) = Reg[9];		// Move argument to stack
+	Reg[SP] = Reg[SP] - 8;		// Make space on stack for argument
+	MEM(int, Reg[SP]) = Reg[8];		// Move argument to stack
+	Reg[SP] = Reg[SP] - 8;		// Make space on stack for argument
+	MEM(int, Reg[SP]) = Reg[7];		// Move argument to stack
+	Reg[SP] = Reg[SP] - 8;		// Make space on stack for argument
+	MEM(int, Reg[SP]) = Reg[6];		// Move argument to stack
+	Reg[SP] = Reg[SP] - 8;		// Make space on stack for argument
+	MEM(int, Reg[SP]) = Reg[5];		// Move argument to stack
+	Reg[SP] = Reg[SP] - 8;		// Make space on stack for argument
+	MEM(int, Reg[SP]) = Reg[4];		// Move argument to stack
+	Reg[SP] = Reg[SP] - 8;		// Make space on stack for argument
+	MEM(int, Reg[SP]) = Reg[3];		// Move argument to stack
+	Reg[SP] = Reg[SP] - 8;		// Make space on stack for argument
+	MEM(int, Reg[SP]) = Reg[2];		// Move argument to stack
+	Reg[SP] = Reg[SP] - 8;		// Make space on stack for argument
+	MEM(int, Reg[SP]) = Reg[1];		// Move argument to stack
+	Reg[SP] = Reg[SP] - 8;		// Make space on stack for argument
+	MEM(int, Reg[SP]) = Reg[0];		// Move argument to stack
+	Reg[SP] = Reg[SP] - 8;		// Allocate space for return address
+	Reg[0] = (long long)&&postrotate15;
+	MEM(long long, Reg[SP]) = Reg[0];		// save return address
+	Reg[SP] = Reg[SP] - 8;		// Allocate space for FP
+	MEM(long long, Reg[SP]) = Reg[FP];		// Save frame pointer
+	Reg[FP] = Reg[SP];		// Move frame pointer to new position
+	goto rotate;		// jump to procedure
+postrotate15:
+	Reg[SP] = Reg[SP] + 8;		// Free input parameter
+	Reg[SP] = Reg[SP] + 8;		// Free input parameter
+	Reg[SP] = Reg[SP] + 8;		// Free input parameter
+	Reg[SP] = Reg[SP] + 8;		// Free input parameter
+	Reg[SP] = Reg[SP] + 8;		// Free input parameter
+	Reg[SP] = Reg[SP] + 8;		// Free input parameter
+	Reg[SP] = Reg[SP] + 8;		// Free input parameter
+	Reg[SP] = Reg[SP] + 8;		// Free input parameter
+	Reg[SP] = Reg[SP] + 8;		// Free input parameter
+	Reg[SP] = Reg[SP] + 8;		// Free input parameter
+	Reg[SP] = Reg[SP] + 8;		// Free input parameter
+	Reg[SP] = Reg[SP] + 8;		// Free input parameter
+	Reg[SP] = Reg[SP] + 8;		// Free input parameter
+	Reg[SP] = Reg[SP] + 8;		// Free input parameter
+	Reg[SP] = Reg[SP] + 8;		// Free input parameter
+	Reg[SP] = Reg[SP] + 8;		// Free input parameter
+	Reg[SP] = Reg[SP] + 8;		// Free input parameter
+	Reg[SP] = Reg[SP] + 8;		// Free input parameter
+	Reg[SP] = Reg[SP] + 8;		// Free input parameter
+	Reg[SP] = Reg[SP] + 8;		// Free input parameter
+	Reg[SP] = Reg[SP] + 8;		// Free input parameter
+	Reg[SP] = Reg[SP] + 8;		// Free input parameter
+	Reg[SP] = Reg[SP] + 8;		// Free input parameter
+	Reg[SP] = Reg[SP] + 8;		// Free input parameter
+	Reg[SP] = Reg[SP] + 8;		// Free input parameter
+	Reg[SP] = Reg[SP] + 8;		// Free input parameter
+	Reg[SP] = Reg[SP] + 8;		// Free input parameter
+	Reg[SP] = Reg[SP] + 8;		// Free input parameter
+	Reg[SP] = Reg[SP] + 8;		// Free input parameter
+	Reg[SP] = Reg[SP] + 8;		// Free input parameter
+	Reg[SP] = Reg[SP] + 8;		// Free array reference
+	Reg[SP] = Reg[SP] + 8;		// Free input parameter
+	Reg[0] = MEM(long long, Reg[SP]);		// Get address of out param off stack
+	Reg[SP] = Reg[SP] + 8;
+	MEM(int, Reg[0]) = MEM(int, Reg[SP]);		// Get out param off stack
+	Reg[SP] = Reg[SP] + 8;		// Free output parameter
+	Reg[SP] = Reg[SP] + 8;		// Free input parameter
+	Reg[SP] = Reg[SP] + 88;		// Free arguments passed on the stack
+	Reg[0] = (long long)MEM(int, Reg[FP] - 8);		// operand
+	lv12 = Reg[0];		// Pass argument
+	ret11 = &&postputinteger16;
+	goto putinteger;		// jump to leaf procedure
+postputinteger16:
+	return 0;
+}
+
+long long static_data()
+{
+	return 0;
+}
@@ -0,0 +1,4 @@
+#include "runtime.h"
+
+void shard_1(int entry);
+void shard_2(int entry);
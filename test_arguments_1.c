@@ -0,0 +1,310 @@
+#include "test_arguments.h"
+
+void shard_1(int entry) {
+	goto enter_function;
+	void* ret1;		// Return address of getbool
+	bool lv2;		// getbool bb
+	long long lv2_address;
+getbool:
+	lv2 = getBool();
+	goto *ret1;
+	void* ret3;		// Return address of getinteger
+	int lv4;		// getinteger ii
+	long long lv4_address;
+getinteger:
+	lv4 = getInteger();
+	goto *ret3;
+	void* ret5;		// Return address of getfloat
+	double lv6;		// getfloat ff
+	long long lv6_address;
+getfloat:
+	lv6 = getFloat();
+	goto *ret5;
+	void* ret7;		// Return address of getstring
+	long long lv8;		// getstring ss
+	long long lv8_address;
+getstring:
+	lv8 = (long long)getString();
+	goto *ret7;
+	void* ret9;		// Return address of putbool
+	bool lv10;		// putbool b
+putbool:
+	putBool(lv10);
+	goto *ret9;
+	void* ret11;		// Return address of putinteger
+	int lv12;		// putinteger i
+putinteger:
+	putInteger(lv12);
+	goto *ret11;
+	void* ret13;		// Return address of putfloat
+	double lv14;		// putfloat f
+putfloat:
+	putFloat(lv14);
+	goto *ret13;
+	void* ret15;		// Return address of putstring
+	long long lv16;		// putstring s
+putstring:
+	putString((char*)lv16);
+	goto *ret15;
+framed:
+	Reg[0] = (long long)MEM(int, Reg[FP] + 16) * 1;		// expression = operand1 op operand2
+	Reg[1] = (long long)MEM(int, Reg[FP] + 24) * 2;		// expression = operand1 op operand2
+	Reg[0] = Reg[0] + Reg[1];		// expression = operand1 op operand2
+	Reg[1] = (long long)MEM(int, Reg[FP] + 32) * 3;		// expression = operand1 op operand2
+	Reg[0] = Reg[0] + Reg[1];		// expression = operand1 op operand2
+	Reg[1] = (long long)MEM(int, Reg[FP] + 40) * 4;		// expression = operand1 op operand2
+	Reg[0] = Reg[0] + Reg[1];		// expression = operand1 op operand2
+	Reg[1] = (long long)MEM(int, Reg[FP] + 48) * 5;		// expression = operand1 op operand2
+	Reg[0] = Reg[0] + Reg[1];		// expression = operand1 op operand2
+	Reg[1] = (long long)MEM(int, Reg[FP] + 56) * 6;		// expression = operand1 op operand2
+	Reg[0] = Reg[0] + Reg[1];		// expression = operand1 op operand2
+	Reg[1] = (long long)MEM(int, Reg[FP] + 64) * 7;		// expression = operand1 op operand2
+	Reg[0] = Reg[0] + Reg[1];		// expression = operand1 op operand2
+	Reg[1] = (long long)MEM(int, Reg[FP] + 72) * 8;		// expression = operand1 op operand2
+	Reg[0] = Reg[0] + Reg[1];		// expression = operand1 op operand2
+	Reg[1] = (long long)MEM(int, Reg[FP] + 80) * 9;		// expression = operand1 op operand2
+	Reg[0] = Reg[0] + Reg[1];		// expression = operand1 op operand2
+	Reg[1] = (long long)MEM(int, Reg[FP] + 88) * 10;		// expression = operand1 op operand2
+	Reg[0] = Reg[0] + Reg[1];		// expression = operand1 op operand2
+	Reg[1] = (long long)MEM(int, Reg[FP] + 96) * 11;		// expression = operand1 op operand2
+	Reg[0] = Reg[0] + Reg[1];		// expression = operand1 op operand2
+	Reg[1] = (long long)MEM(int, Reg[FP] + 104) * 12;		// expression = operand1 op operand2
+	Reg[0] = Reg[0] + Reg[1];		// expression = operand1 op operand2
+	Reg[1] = (long long)MEM(int, Reg[FP] + 112) * 13;		// expression = operand1 op operand2
+	Reg[0] = Reg[0] + Reg[1];		// expression = operand1 op operand2
+	Reg[1] = (long long)MEM(int, Reg[FP] + 120) * 14;		// expression = operand1 op operand2
+	Reg[0] = Reg[0] + Reg[1];		// expression = operand1 op operand2
+	Reg[1] = (long long)MEM(int, Reg[FP] + 128) * 15;		// expression = operand1 op operand2
+	Reg[0] = Reg[0] + Reg[1];		// expression = operand1 op operand2
+	Reg[1] = (long long)MEM(int, Reg[FP] + 136) * 16;		// expression = operand1 op operand2
+	Reg[0] = Reg[0] + Reg[1];		// expression = operand1 op operand2
+	Reg[1] = (long long)MEM(int, Reg[FP] + 144) * 17;		// expression = operand1 op operand2
+	Reg[0] = Reg[0] + Reg[1];		// expression = operand1 op operand2
+	Reg[1] = (long long)MEM(int, Reg[FP] + 152) * 18;		// expression = operand1 op operand2
+	Reg[0] = Reg[0] + Reg[1];		// expression = operand1 op operand2
+	Reg[1] = (long long)MEM(int, Reg[FP] + 160) * 19;		// expression = operand1 op operand2
+	Reg[0] = Reg[0] + Reg[1];		// expression = operand1 op operand2
+	Reg[1] = (long long)MEM(int, Reg[FP] + 168) * 20;		// expression = operand1 op operand2
+	Reg[0] = Reg[0] + Reg[1];		// expression = operand1 op operand2
+	Reg[1] = (long long)MEM(int, Reg[FP] + 176) * 21;		// expression = operand1 op operand2
+	Reg[0] = Reg[0] + Reg[1];		// expression = operand1 op operand2
+	Reg[1] = (long long)MEM(int, Reg[FP] + 184) * 22;		// expression = operand1 op operand2
+	Reg[0] = Reg[0] + Reg[1];		// expression = operand1 op operand2
+	Reg[1] = (long long)MEM(int, Reg[FP] + 192) * 23;		// expression = operand1 op operand2
+	Reg[0] = Reg[0] + Reg[1];		// expression = operand1 op operand2
+	Reg[1] = (long long)MEM(int, Reg[FP] + 200) * 24;		// expression = operand1 op operand2
+	Reg[0] = Reg[0] + Reg[1];		// expression = operand1 op operand2
+	Reg[1] = (long long)MEM(int, Reg[FP] + 208) * 25;		// expression = operand1 op operand2
+	Reg[0] = Reg[0] + Reg[1];		// expression = operand1 op operand2
+	Reg[1] = (long long)MEM(int, Reg[FP] + 216) * 26;		// expression = operand1 op operand2
+	Reg[0] = Reg[0] + Reg[1];		// expression = operand1 op operand2
+	Reg[1] = (long long)MEM(int, Reg[FP] + 224) * 27;		// expression = operand1 op operand2
+	Reg[0] = Reg[0] + Reg[1];		// expression = operand1 op operand2
+	Reg[1] = (long long)MEM(int, Reg[FP] + 232) * 28;		// expression = operand1 op operand2
+	Reg[0] = Reg[0] + Reg[1];		// expression = operand1 op operand2
+	Reg[1] = (long long)MEM(int, Reg[FP] + 240) * 29;		// expression = operand1 op operand2
+	Reg[0] = Reg[0] + Reg[1];		// expression = operand1 op operand2
+	Reg[1] = (long long)MEM(int, Reg[FP] + 248) * 30;		// expression = operand1 op operand2
+	Reg[0] = Reg[0] + Reg[1];		// expression = operand1 op operand2
+	Reg[1] = 1 * 4;		// expression = operand1 op operand2
+	Reg[1] = (MEM(long long, Reg[FP] + 256)) + Reg[1];		// expression = operand1 op operand2
+	Reg[1] = MEM(int, Reg[1]);		// Get array operand
+	Reg[1] = Reg[1] * (long long)MEM(int, Reg[FP] + 288);		// expression = operand1 op operand2
+	Reg[0] = Reg[0] + Reg[1];		// expression = operand1 op operand2
+	MEM(int, Reg[FP] + 280) = Reg[0];		// assign parameter
+	*((double*)&Reg[0]) = MEM(double, Reg[FP] + 264);		// operand
+	lv14 = *((double*)&Reg[0]);		// Pass argument
+	ret13 = &&postputfloat1;
+	goto putfloat;		// jump to leaf procedure
+postputfloat1:
+	Reg[0] = (long long)MEM(int, Reg[FP] + 280);		// operand
+	lv12 = Reg[0];		// Pass argument
+	ret11 = &&postputinteger2;
+	goto putinteger;		// jump to leaf procedure
+postputinteger2:
+	Reg[SP] = Reg[FP];		// Free local variables
+	Reg[FP] = MEM(long long, Reg[FP]);		// Restore Frame pointer
+	Reg[SP] = Reg[SP] + 8;		// Free space for FP
+	Reg[0] = MEM(long long, Reg[SP]);		// Pop return address off the stack
+	Reg[SP] = Reg[SP] + 8;		// Free return address space
+	goto *(void*)Reg[0];		// Return
+rotate:
+	if (!((long long)MEM(int, Reg[FP] + 288) > 0)) goto else3;
+	Reg[0] = (long long)MEM(int, Reg[FP] + 24);		// operand
+	Reg[1] = (long long)MEM(int, Reg[FP] + 32);		// operand
+	Reg[2] = (long long)MEM(int, Reg[FP] + 40);		// operand
+	Reg[3] = (long long)MEM(int, Reg[FP] + 48);		// operand
+	Reg[4] = (long long)MEM(int, Reg[FP] + 56);		// operand
+	Reg[5] = (long long)MEM(int, Reg[FP] + 64);		// operand
+	Reg[6] = (long long)MEM(int, Reg[FP] + 72);		// operand
+	Reg[7] = (long long)MEM(int, Reg[FP] + 80);		// operand
+	Reg[8] = (long long)MEM(int, Reg[FP] + 88);		// operand
+	Reg[9] = (long long)MEM(int, Reg[FP] + 96);		// operand
+	Reg[10] = (long long)MEM(int, Reg[FP] + 104);		// operand
+	Reg[11] = (long long)MEM(int, Reg[FP] + 112);		// operand
+	Reg[12] = (long long)MEM(int, Reg[FP] + 120);		// operand
+	Reg[13] = (long long)MEM(int, Reg[FP] + 128);		// operand
+	Reg[14] = (long long)MEM(int, Reg[FP] + 136);		// operand
+	Reg[15] = (long long)MEM(int, Reg[FP] + 144);		// operand
+	Reg[16] = (long long)MEM(int, Reg[FP] + 152);		// operand
+	Reg[17] = (long long)MEM(int, Reg[FP] + 160);		// operand
+	Reg[18] = (long long)MEM(int, Reg[FP] + 168);		// operand
+	Reg[19] = (long long)MEM(int, Reg[FP] + 176);		// operand
+	Reg[20] = (long long)MEM(int, Reg[FP] + 184);		// operand
+	Reg[21] = (long long)MEM(int, Reg[FP] + 192);		// operand
+	Reg[22] = (long long)MEM(int, Reg[FP] + 200);		// operand
+	Reg[23] = (long long)MEM(int, Reg[FP] + 208);		// operand
+	Reg[24] = (long long)MEM(int, Reg[FP] + 216);		// operand
+	Reg[SP] = Reg[SP] - 8;
+	MEM(long long, Reg[SP]) = Reg[24];		// Pass argument on the stack, registers are full
+	Reg[24] = (long long)MEM(int, Reg[FP] + 224);		// operand
+	Reg[SP] = Reg[SP] - 8;
+	MEM(long long, Reg[SP]) = Reg[24];		// Pass argument on the stack, registers are full
+	Reg[24] = (long long)MEM(int, Reg[FP] + 232);		// operand
+	Reg[SP] = Reg[SP] - 8;
+	MEM(long long, Reg[SP]) = Reg[24];		// Pass argument on the stack, registers are full
+	Reg[24] = (long long)MEM(int, Reg[FP] + 240);		// operand
+	Reg[SP] = Reg[SP] - 8;
+	MEM(long long, Reg[SP]) = Reg[24];		// Pass argument on the stack, registers are full
+	Reg[24] = (long long)MEM(int, Reg[FP] + 248);		// operand
+	Reg[SP] = Reg[SP] - 8;
+	MEM(long long, Reg[SP]) = Reg[24];		// Pass argument on the stack, registers are full
+	Reg[24] = (long long)MEM(int, Reg[FP] + 16);		// operand
+	Reg[SP] = Reg[SP] - 8;
+	MEM(long long, Reg[SP]) = Reg[24];		// Pass argument on the stack, registers are full
+	Reg[24] = (MEM(long long, Reg[FP] + 256));		// operand
+	Reg[SP] = Reg[SP] - 8;
+	MEM(long long, Reg[SP]) = Reg[24];		// Pass argument on the stack, registers are full
+	*((double*)&Reg[24]) = MEM(double, Reg[FP] + 264) + 1;		// expression = operand1 op operand2
+	Reg[SP] = Reg[SP] - 8;
+	MEM(long long, Reg[SP]) = Reg[24];		// Pass argument on the stack, registers are full
+	Reg[24] = (Reg[FP] + 280);		// operand
+	Reg[25] = MEM(int, Reg[24]);		// Value of out argument
+	Reg[SP] = Reg[SP] - 8;
+	MEM(long long, Reg[SP]) = Reg[24];		// Pass argument on the stack, registers are full
+	Reg[SP] = Reg[SP] - 8;
+	MEM(long long, Reg[SP]) = Reg[25];		// Pass argument on the stack, registers are full
+	Reg[24] = (long long)MEM(int, Reg[FP] + 288) - 1;		// expression = operand1 op operand2
+	Reg[SP] = Reg[SP] - 8;
+	MEM(long long, Reg[SP]) = Reg[24];		// Pass argument on the stack, registers are full
+	Reg[24] = Reg[SP];		// Arguments passed on the stack
+	MEM(int, Reg[FP] + 288) = MEM(long long, Reg[24] + 0);		// Overwrite parameter in own frame
+	MEM(double, Reg[FP] + 264) = MEM(double, Reg[24] + 24);		// Overwrite parameter in own frame
+	MEM(int, Reg[FP] + 248) = MEM(long long, Reg[24] + 40);		// Overwrite parameter in own frame
+	MEM(int, Reg[FP] + 240) = MEM(long long, Reg[24] + 48);		// Overwrite parameter in own frame
+	MEM(int, Reg[FP] + 232) = MEM(long long, Reg[24] + 56);		// Overwrite parameter in own frame
+	MEM(int, Reg[FP] + 224) = MEM(long long, Reg[24] + 64);		// Overwrite parameter in own frame
+	MEM(int, Reg[FP] + 216) = MEM(long long, Reg[24] + 72);		// Overwrite parameter in own frame
+	MEM(int, Reg[FP] + 208) = MEM(long long, Reg[24] + 80);		// Overwrite parameter in own frame
+	MEM(int, Reg[FP] + 200) = Reg[23];		// Overwrite parameter in own frame
+	MEM(int, Reg[FP] + 192) = Reg[22];		// Overwrite parameter in own frame
+	MEM(int, Reg[FP] + 184) = Reg[21];		// Overwrite parameter in own frame
+	MEM(int, Reg[FP] + 176) = Reg[20];		// Overwrite parameter in own frame
+	MEM(int, Reg[FP] + 168) = Reg[19];		// Overwrite parameter in own frame
+	MEM(int, Reg[FP] + 160) = Reg[18];		// Overwrite parameter in own frame
+	MEM(int, Reg[FP] + 152) = Reg[17];		// Overwrite parameter in own frame
+	MEM(int, Reg[FP] + 144) = Reg[16];		// Overwrite parameter in own frame
+	MEM(int, Reg[FP] + 136) = Reg[15];		// Overwrite parameter in own frame
+	MEM(int, Reg[FP] + 128) = Reg[14];		// Overwrite parameter in own frame
+	MEM(int, Reg[FP] + 120) = Reg[13];		// Overwrite parameter in own frame
+	MEM(int, Reg[FP] + 112) = Reg[12];		// Overwrite parameter in own frame
+	MEM(int, Reg[FP] + 104) = Reg[11];		// Overwrite parameter in own frame
+	MEM(int, Reg[FP] + 96) = Reg[10];		// Overwrite parameter in own frame
+	MEM(int, Reg[FP] + 88) = Reg[9];		// Overwrite parameter in own frame
+	MEM(int, Reg[FP] + 80) = Reg[8];		// Overwrite parameter in own frame
+	MEM(int, Reg[FP] + 72) = Reg[7];		// Overwrite parameter in own frame
+	MEM(int, Reg[FP] + 64) = Reg[6];		// Overwrite parameter in own frame
+	MEM(int, Reg[FP] + 56) = Reg[5];		// Overwrite parameter in own frame
+	MEM(int, Reg[FP] + 48) = Reg[4];		// Overwrite parameter in own frame
+	MEM(int, Reg[FP] + 40) = Reg[3];		// Overwrite parameter in own frame
+	MEM(int, Reg[FP] + 32) = Reg[2];		// Overwrite parameter in own frame
+	MEM(int, Reg[FP] + 24) = Reg[1];		// Overwrite parameter in own frame
+	MEM(int, Reg[FP] + 16) = Reg[0];		// Overwrite parameter in own frame
+	Reg[SP] = Reg[FP];		// Free local variables
+	goto rotate;		// Tail call, reuse frame
+	goto next5;
+else3:
+	Reg[0] = (long long)MEM(int, Reg[FP] + 16) * 1;		// expression = operand1 op operand2
+	Reg[1] = (long long)MEM(int, Reg[FP] + 24) * 2;		// expression = operand1 op operand2
+	Reg[0] = Reg[0] + Reg[1];		// expression = operand1 op operand2
+	Reg[1] = (long long)MEM(int, Reg[FP] + 32) * 3;		// expression = operand1 op operand2
+	Reg[0] = Reg[0] + Reg[1];		// expression = operand1 op operand2
+	Reg[1] = (long long)MEM(int, Reg[FP] + 40) * 4;		// expression = operand1 op operand2
+	Reg[0] = Reg[0] + Reg[1];		// expression = operand1 op operand2
+	Reg[1] = (long long)MEM(int, Reg[FP] + 48) * 5;		// expression = operand1 op operand2
+	Reg[0] = Reg[0] + Reg[1];		// expression = operand1 op operand2
+	Reg[1] = (long long)MEM(int, Reg[FP] + 56) * 6;		// expression = operand1 op operand2
+	Reg[0] = Reg[0] + Reg[1];		// expression = operand1 op operand2
+	Reg[1] = (long long)MEM(int, Reg[FP] + 64) * 7;		// expression = operand1 op operand2
+	Reg[0] = Reg[0] + Reg[1];		// expression = operand1 op operand2
+	Reg[1] = (long long)MEM(int, Reg[FP] + 72) * 8;		// expression = operand1 op operand2
+	Reg[0] = Reg[0] + Reg[1];		// expression = operand1 op operand2
+	Reg[1] = (long long)MEM(int, Reg[FP] + 80) * 9;		// expression = operand1 op operand2
+	Reg[0] = Reg[0] + Reg[1];		// expression = operand1 op operand2
+	Reg[1] = (long long)MEM(int, Reg[FP] + 88) * 10;		// expression = operand1 op operand2
+	Reg[0] = Reg[0] + Reg[1];		// expression = operand1 op operand2
+	Reg[1] = (long long)MEM(int, Reg[FP] + 96) * 11;		// expression = operand1 op operand2
+	Reg[0] = Reg[0] + Reg[1];		// expression = operand1 op operand2
+	Reg[1] = (long long)MEM(int, Reg[FP] + 104) * 12;		// expression = operand1 op operand2
+	Reg[0] = Reg[0] + Reg[1];		// expression = operand1 op operand2
+	Reg[1] = (long long)MEM(int, Reg[FP] + 112) * 13;		// expression = operand1 op operand2
+	Reg[0] = Reg[0] + Reg[1];		// expression = operand1 op operand2
+	Reg[1] = (long long)MEM(int, Reg[FP] + 120) * 14;		// expression = operand1 op operand2
+	Reg[0] = Reg[0] + Reg[1];		// expression = operand1 op operand2
+	Reg[1] = (long long)MEM(int, Reg[FP] + 128) * 15;		// expression = operand1 op operand2
+	Reg[0] = Reg[0] + Reg[1];		// expression = operand1 op operand2
+	Reg[1] = (long long)MEM(int, Reg[FP] + 136) * 16;		// expression = operand1 op operand2
+	Reg[0] = Reg[0] + Reg[1];		// expression = operand1 op operand2
+	Reg[1] = (long long)MEM(int, Reg[FP] + 144) * 17;		// expression = operand1 op operand2
+	Reg[0] = Reg[0] + Reg[1];		// expression = operand1 op operand2
+	Reg[1] = (long long)MEM(int, Reg[FP] + 152) * 18;		// expression = operand1 op operand2
+	Reg[0] = Reg[0] + Reg[1];		// expression = operand1 op operand2
+	Reg[1] = (long long)MEM(int, Reg[FP] + 160) * 19;		// expression = operand1 op operand2
+	Reg[0] = Reg[0] + Reg[1];		// expression = operand1 op operand2
+	Reg[1] = (long long)MEM(int, Reg[FP] + 168) * 20;		// expression = operand1 op operand2
+	Reg[0] = Reg[0] + Reg[1];		// expression = operand1 op operand2
+	Reg[1] = (long long)MEM(int, Reg[FP] + 176) * 21;		// expression = operand1 op operand2
+	Reg[0] = Reg[0] + Reg[1];		// expression = operand1 op operand2
+	Reg[1] = (long long)MEM(int, Reg[FP] + 184) * 22;		// expression = operand1 op operand2
+	Reg[0] = Reg[0] + Reg[1];		// expression = operand1 op operand2
+	Reg[1] = (long long)MEM(int, Reg[FP] + 192) * 23;		// expression = operand1 op operand2
+	Reg[0] = Reg[0] + Reg[1];		// expression = operand1 op operand2
+	Reg[1] = (long long)MEM(int, Reg[FP] + 200) * 24;		// expression = operand1 op operand2
+	Reg[0] = Reg[0] + Reg[1];		// expression = operand1 op operand2
+	Reg[1] = (long long)MEM(int, Reg[FP] + 208) * 25;		// expression = operand1 op operand2
+	Reg[0] = Reg[0] + Reg[1];		// expression = operand1 op operand2
+	Reg[1] = (long long)MEM(int, Reg[FP] + 216) * 26;		// expression = operand1 op operand2
+	Reg[0] = Reg[0] + Reg[1];		// expression = operand1 op operand2
+	Reg[1] = (long long)MEM(int, Reg[FP] + 224) * 27;		// expression = operand1 op operand2
+	Reg[0] = Reg[0] + Reg[1];		// expression = operand1 op operand2
+	Reg[1] = (long long)MEM(int, Reg[FP] + 232) * 28;		// expression = operand1 op operand2
+	Reg[0] = Reg[0] + Reg[1];		// expression = operand1 op operand2
+	Reg[1] = (long long)MEM(int, Reg[FP] + 240) * 29;		// expression = operand1 op operand2
+	Reg[0] = Reg[0] + Reg[1];		// expression = operand1 op operand2
+	Reg[1] = (long long)MEM(int, Reg[FP] + 248) * 30;		// expression = operand1 op operand2
+	Reg[0] = Reg[0] + Reg[1];		// expression = operand1 op operand2
+	Reg[1] = 0 * 4;		// expression = operand1 op operand2
+	Reg[1] = (MEM(long long, Reg[FP] + 256)) + Reg[1];		// expression = operand1 op operand2
+	Reg[1] = MEM(int, Reg[1]);		// Get array operand
+	Reg[0] = Reg[0] + Reg[1];		// expression = operand1 op operand2
+	MEM(int, Reg[FP] + 280) = Reg[0];		// assign parameter
+next5:
+	Reg[SP] = Reg[FP];		// Free local variables
+	Reg[FP] = MEM(long long, Reg[FP]);		// Restore Frame pointer
+	Reg[SP] = Reg[SP] + 8;		// Free space for FP
+	Reg[0] = MEM(long long, Reg[SP]);		// Pop return address off the stack
+	Reg[SP] = Reg[SP] + 8;		// Free return address space
+	goto *(void*)Reg[0];		// Return
+enter_function:
+	Reg[SP] = Reg[SP] - 8;		// Allocate space for return address
+	MEM(long long, Reg[SP]) = (long long)&&leave_function;		// save return address
+	Reg[SP] = Reg[SP] - 8;		// Allocate space for FP
+	MEM(long long, Reg[SP]) = Reg[FP];		// Save frame pointer
+	Reg[FP] = Reg[SP];		// Move frame pointer to new position
+	switch (entry) {
+		case 0: goto framed;
+		case 1: goto rotate;
+	}
+leave_function:
+	return;
+}
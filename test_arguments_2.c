@@ -0,0 +1,205 @@
+#include "test_arguments.h"
+
+void shard_2(int entry) {
+	goto enter_function;
+	void* ret1;		// Return address of getbool
+	bool lv2;		// getbool bb
+	long long lv2_address;
+getbool:
+	lv2 = getBool();
+	goto *ret1;
+	void* ret3;		// Return address of getinteger
+	int lv4;		// getinteger ii
+	long long lv4_address;
+getinteger:
+	lv4 = getInteger();
+	goto *ret3;
+	void* ret5;		// Return address of getfloat
+	double lv6;		// getfloat ff
+	long long lv6_address;
+getfloat:
+	lv6 = getFloat();
+	goto *ret5;
+	void* ret7;		// Return address of getstring
+	long long lv8;		// getstring ss
+	long long lv8_address;
+getstring:
+	lv8 = (long long)getString();
+	goto *ret7;
+	void* ret9;		// Return address of putbool
+	bool lv10;		// putbool b
+putbool:
+	putBool(lv10);
+	goto *ret9;
+	void* ret11;		// Return address of putinteger
+	int lv12;		// putinteger i
+putinteger:
+	putInteger(lv12);
+	goto *ret11;
+	void* ret13;		// Return address of putfloat
+	double lv14;		// putfloat f
+putfloat:
+	putFloat(lv14);
+	goto *ret13;
+	void* ret15;		// Return address of putstring
+	long long lv16;		// putstring s
+putstring:
+	putString((char*)lv16);
+	goto *ret15;
+leaf:
+	Reg[0] = (long long)MEM(int, Reg[FP] + 16) * 1;		// expression = operand1 op operand2
+	Reg[1] = (long long)MEM(int, Reg[FP] + 24) * 2;		// expression = operand1 op operand2
+	Reg[0] = Reg[0] + Reg[1];		// expression = operand1 op operand2
+	Reg[1] = (long long)MEM(int, Reg[FP] + 32) * 3;		// expression = operand1 op operand2
+	Reg[0] = Reg[0] + Reg[1];		// expression = operand1 op operand2
+	Reg[1] = (long long)MEM(int, Reg[FP] + 40) * 4;		// expression = operand1 op operand2
+	Reg[0] = Reg[0] + Reg[1];		// expression = operand1 op operand2
+	Reg[1] = (long long)MEM(int, Reg[FP] + 48) * 5;		// expression = operand1 op operand2
+	Reg[0] = Reg[0] + Reg[1];		// expression = operand1 op operand2
+	Reg[1] = (long long)MEM(int, Reg[FP] + 56) * 6;		// expression = operand1 op operand2
+	Reg[0] = Reg[0] + Reg[1];		// expression = operand1 op operand2
+	Reg[1] = (long long)MEM(int, Reg[FP] + 64) * 7;		// expression = operand1 op operand2
+	Reg[0] = Reg[0] + Reg[1];		// expression = operand1 op operand2
+	Reg[1] = (long long)MEM(int, Reg[FP] + 72) * 8;		// expression = operand1 op operand2
+	Reg[0] = Reg[0] + Reg[1];		// expression = operand1 op operand2
+	Reg[1] = (long long)MEM(int, Reg[FP] + 80) * 9;		// expression = operand1 op operand2
+	Reg[0] = Reg[0] + Reg[1];		// expression = operand1 op operand2
+	Reg[1] = (long long)MEM(int, Reg[FP] + 88) * 10;		// expression = operand1 op operand2
+	Reg[0] = Reg[0] + Reg[1];		// expression = operand1 op operand2
+	Reg[1] = (long long)MEM(int, Reg[FP] + 96) * 11;		// expression = operand1 op operand2
+	Reg[0] = Reg[0] + Reg[1];		// expression = operand1 op operand2
+	Reg[1] = (long long)MEM(int, Reg[FP] + 104) * 12;		// expression = operand1 op operand2
+	Reg[0] = Reg[0] + Reg[1];		// expression = operand1 op operand2
+	Reg[1] = (long long)MEM(int, Reg[FP] + 112) * 13;		// expression = operand1 op operand2
+	Reg[0] = Reg[0] + Reg[1];		// expression = operand1 op operand2
+	Reg[1] = (long long)MEM(int, Reg[FP] + 120) * 14;		// expression = operand1 op operand2
+	Reg[0] = Reg[0] + Reg[1];		// expression = operand1 op operand2
+	Reg[1] = (long long)MEM(int, Reg[FP] + 128) * 15;		// expression = operand1 op operand2
+	Reg[0] = Reg[0] + Reg[1];		// expression = operand1 op operand2
+	Reg[1] = (long long)MEM(int, Reg[FP] + 136) * 16;		// expression = operand1 op operand2
+	Reg[0] = Reg[0] + Reg[1];		// expression = operand1 op operand2
+	Reg[1] = (long long)MEM(int, Reg[FP] + 144) * 17;		// expression = operand1 op operand2
+	Reg[0] = Reg[0] + Reg[1];		// expression = operand1 op operand2
+	Reg[1] = (long long)MEM(int, Reg[FP] + 152) * 18;		// expression = operand1 op operand2
+	Reg[0] = Reg[0] + Reg[1];		// expression = operand1 op operand2
+	Reg[1] = (long long)MEM(int, Reg[FP] + 160) * 19;		// expression = operand1 op operand2
+	Reg[0] = Reg[0] + Reg[1];		// expression = operand1 op operand2
+	Reg[1] = (long long)MEM(int, Reg[FP] + 168) * 20;		// expression = operand1 op operand2
+	Reg[0] = Reg[0] + Reg[1];		// expression = operand1 op operand2
+	Reg[1] = (long long)MEM(int, Reg[FP] + 176) * 21;		// expression = operand1 op operand2
+	Reg[0] = Reg[0] + Reg[1];		// expression = operand1 op operand2
+	Reg[1] = (long long)MEM(int, Reg[FP] + 184) * 22;		// expression = operand1 op operand2
+	Reg[0] = Reg[0] + Reg[1];		// expression = operand1 op operand2
+	Reg[1] = (long long)MEM(int, Reg[FP] + 192) * 23;		// expression = operand1 op operand2
+	Reg[0] = Reg[0] + Reg[1];		// expression = operand1 op operand2
+	Reg[1] = (long long)MEM(int, Reg[FP] + 200) * 24;		// expression = operand1 op operand2
+	Reg[0] = Reg[0] + Reg[1];		// expression = operand1 op operand2
+	Reg[1] = (long long)MEM(int, Reg[FP] + 208) * 25;		// expression = operand1 op operand2
+	Reg[0] = Reg[0] + Reg[1];		// expression = operand1 op operand2
+	Reg[1] = (long long)MEM(int, Reg[FP] + 216) * 26;		// expression = operand1 op operand2
+	Reg[0] = Reg[0] + Reg[1];		// expression = operand1 op operand2
+	Reg[1] = (long long)MEM(int, Reg[FP] + 224) * 27;		// expression = operand1 op operand2
+	Reg[0] = Reg[0] + Reg[1];		// expression = operand1 op operand2
+	Reg[1] = (long long)MEM(int, Reg[FP] + 232) * 28;		// expression = operand1 op operand2
+	Reg[0] = Reg[0] + Reg[1];		// expression = operand1 op operand2
+	Reg[1] = (long long)MEM(int, Reg[FP] + 240) * 29;		// expression = operand1 op operand2
+	Reg[0] = Reg[0] + Reg[1];		// expression = operand1 op operand2
+	Reg[1] = (long long)MEM(int, Reg[FP] + 248) * 30;		// expression = operand1 op operand2
+	Reg[0] = Reg[0] + Reg[1];		// expression = operand1 op operand2
+	Reg[1] = 2 * 4;		// expression = operand1 op operand2
+	Reg[1] = (MEM(long long, Reg[FP] + 256)) + Reg[1];		// expression = operand1 op operand2
+	Reg[1] = MEM(int, Reg[1]);		// Get array operand
+	Reg[1] = Reg[1] * (long long)MEM(int, Reg[FP] + 288);		// expression = operand1 op operand2
+	Reg[0] = Reg[0] + Reg[1];		// expression = operand1 op operand2
+	MEM(int, Reg[FP] + 280) = Reg[0];		// assign parameter
+	Reg[SP] = Reg[FP];		// Free local variables
+	Reg[FP] = MEM(long long, Reg[FP]);		// Restore Frame pointer
+	Reg[SP] = Reg[SP] + 8;		// Free space for FP
+	Reg[0] = MEM(long long, Reg[SP]);		// Pop return address off the stack
+	Reg[SP] = Reg[SP] + 8;		// Free return address space
+	goto *(void*)Reg[0];		// Return
+once:
+	Reg[0] = (long long)MEM(int, Reg[FP] + 16) * 1;		// expression = operand1 op operand2
+	Reg[1] = (long long)MEM(int, Reg[FP] + 24) * 2;		// expression = operand1 op operand2
+	Reg[0] = Reg[0] + Reg[1];		// expression = operand1 op operand2
+	Reg[1] = (long long)MEM(int, Reg[FP] + 32) * 3;		// expression = operand1 op operand2
+	Reg[0] = Reg[0] + Reg[1];		// expression = operand1 op operand2
+	Reg[1] = (long long)MEM(int, Reg[FP] + 40) * 4;		// expression = operand1 op operand2
+	Reg[0] = Reg[0] + Reg[1];		// expression = operand1 op operand2
+	Reg[1] = (long long)MEM(int, Reg[FP] + 48) * 5;		// expression = operand1 op operand2
+	Reg[0] = Reg[0] + Reg[1];		// expression = operand1 op operand2
+	Reg[1] = (long long)MEM(int, Reg[FP] + 56) * 6;		// expression = operand1 op operand2
+	Reg[0] = Reg[0] + Reg[1];		// expression = operand1 op operand2
+	Reg[1] = (long long)MEM(int, Reg[FP] + 64) * 7;		// expression = operand1 op operand2
+	Reg[0] = Reg[0] + Reg[1];		// expression = operand1 op operand2
+	Reg[1] = (long long)MEM(int, Reg[FP] + 72) * 8;		// expression = operand1 op operand2
+	Reg[0] = Reg[0] + Reg[1];		// expression = operand1 op operand2
+	Reg[1] = (long long)MEM(int, Reg[FP] + 80) * 9;		// expression = operand1 op operand2
+	Reg[0] = Reg[0] + Reg[1];		// expression = operand1 op operand2
+	Reg[1] = (long long)MEM(int, Reg[FP] + 88) * 10;		// expression = operand1 op operand2
+	Reg[0] = Reg[0] + Reg[1];		// expression = operand1 op operand2
+	Reg[1] = (long long)MEM(int, Reg[FP] + 96) * 11;		// expression = operand1 op operand2
+	Reg[0] = Reg[0] + Reg[1];		// expression = operand1 op operand2
+	Reg[1] = (long long)MEM(int, Reg[FP] + 104) * 12;		// expression = operand1 op operand2
+	Reg[0] = Reg[0] + Reg[1];		// expression = operand1 op operand2
+	Reg[1] = (long long)MEM(int, Reg[FP] + 112) * 13;		// expression = operand1 op operand2
+	Reg[0] = Reg[0] + Reg[1];		// expression = operand1 op operand2
+	Reg[1] = (long long)MEM(int, Reg[FP] + 120) * 14;		// expression = operand1 op operand2
+	Reg[0] = Reg[0] + Reg[1];		// expression = operand1 op operand2
+	Reg[1] = (long long)MEM(int, Reg[FP] + 128) * 15;		// expression = operand1 op operand2
+	Reg[0] = Reg[0] + Reg[1];		// expression = operand1 op operand2
+	Reg[1] = (long long)MEM(int, Reg[FP] + 136) * 16;		// expression = operand1 op operand2
+	Reg[0] = Reg[0] + Reg[1];		// expression = operand1 op operand2
+	Reg[1] = (long long)MEM(int, Reg[FP] + 144) * 17;		// expression = operand1 op operand2
+	Reg[0] = Reg[0] + Reg[1];		// expression = operand1 op operand2
+	Reg[1] = (long long)MEM(int, Reg[FP] + 152) * 18;		// expression = operand1 op operand2
+	Reg[0] = Reg[0] + Reg[1];		// expression = operand1 op operand2
+	Reg[1] = (long long)MEM(int, Reg[FP] + 160) * 19;		// expression = operand1 op operand2
+	Reg[0] = Reg[0] + Reg[1];		// expression = operand1 op operand2
+	Reg[1] = (long long)MEM(int, Reg[FP] + 168) * 20;		// expression = operand1 op operand2
+	Reg[0] = Reg[0] + Reg[1];		// expression = operand1 op operand2
+	Reg[1] = (long long)MEM(int, Reg[FP] + 176) * 21;		// expression = operand1 op operand2
+	Reg[0] = Reg[0] + Reg[1];		// expression = operand1 op operand2
+	Reg[1] = (long long)MEM(int, Reg[FP] + 184) * 22;		// expression = operand1 op operand2
+	Reg[0] = Reg[0] + Reg[1];		// expression = operand1 op operand2
+	Reg[1] = (long long)MEM(int, Reg[FP] + 192) * 23;		// expression = operand1 op operand2
+	Reg[0] = Reg[0] + Reg[1];		// expression = operand1 op operand2
+	Reg[1] = (long long)MEM(int, Reg[FP] + 200) * 24;		// expression = operand1 op operand2
+	Reg[0] = Reg[0] + Reg[1];		// expression = operand1 op operand2
+	Reg[1] = (long long)MEM(int, Reg[FP] + 208) * 25;		// expression = operand1 op operand2
+	Reg[0] = Reg[0] + Reg[1];		// expression = operand1 op operand2
+	Reg[1] = (long long)MEM(int, Reg[FP] + 216) * 26;		// expression = operand1 op operand2
+	Reg[0] = Reg[0] + Reg[1];		// expression = operand1 op operand2
+	Reg[1] = (long long)MEM(int, Reg[FP] + 224) * 27;		// expression = operand1 op operand2
+	Reg[0] = Reg[0] + Reg[1];		// expression = operand1 op operand2
+	Reg[1] = (long long)MEM(int, Reg[FP] + 232) * 28;		// expression = operand1 op operand2
+	Reg[0] = Reg[0] + Reg[1];		// expression = operand1 op operand2
+	Reg[1] = (long long)MEM(int, Reg[FP] + 240) * 29;		// expression = operand1 op operand2
+	Reg[0] = Reg[0] + Reg[1];		// expression = operand1 op operand2
+	Reg[1] = (long long)MEM(int, Reg[FP] + 248) * 30;		// expression = operand1 op operand2
+	Reg[0] = Reg[0] + Reg[1];		// expression = operand1 op operand2
+	Reg[1] = 3 * 4;		// expression = operand1 op operand2
+	Reg[1] = (MEM(long long, Reg[FP] + 256)) + Reg[1];		// expression = operand1 op operand2
+	Reg[1] = MEM(int, Reg[1]);		// Get array operand
+	Reg[1] = Reg[1] * (long long)MEM(int, Reg[FP] + 288);		// expression = operand1 op operand2
+	Reg[0] = Reg[0] + Reg[1];		// expression = operand1 op operand2
+	MEM(int, Reg[FP] + 280) = Reg[0];		// assign parameter
+	Reg[SP] = Reg[FP];		// Free local variables
+	Reg[FP] = MEM(long long, Reg[FP]);		// Restore Frame pointer
+	Reg[SP] = Reg[SP] + 8;		// Free space for FP
+	Reg[0] = MEM(long long, Reg[SP]);		// Pop return address off the stack
+	Reg[SP] = Reg[SP] + 8;		// Free return address space
+	goto *(void*)Reg[0];		// Return
+enter_function:
+	Reg[SP] = Reg[SP] - 8;		// Allocate space for return address
+	MEM(long long, Reg[SP]) = (long long)&&leave_function;		// save return address
+	Reg[SP] = Reg[SP] - 8;		// Allocate space for FP
+	MEM(long long, Reg[SP]) = Reg[FP];		// Save frame pointer
+	Reg[FP] = Reg[SP];		// Move frame pointer to new position
+	switch (entry) {
+		case 0: goto leaf;
+		case 1: goto once;
+	}
+leave_function:
+	return;
+}
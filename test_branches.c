@@ -0,0 +1,221 @@
+#include "runtime.h"
+
+long long static_data();
+
+int main() {
+	goto start;
+	void* ret1;		// Return address of getbool
+	bool lv2;		// getbool bb
+	long long lv2_address;
+getbool:
+	lv2 = getBool();
+	goto *ret1;
+	void* ret3;		// Return address of getinteger
+	int lv4;		// getinteger ii
+	long long lv4_address;
+getinteger:
+	lv4 = getInteger();
+	goto *ret3;
+	void* ret5;		// Return address of getfloat
+	double lv6;		// getfloat ff
+	long long lv6_address;
+getfloat:
+	lv6 = getFloat();
+	goto *ret5;
+	void* ret7;		// Return address of getstring
+	long long lv8;		// getstring ss
+	long long lv8_address;
+getstring:
+	lv8 = (long long)getString();
+	goto *ret7;
+	void* ret9;		// Return address of putbool
+	bool lv10;		// putbool b
+putbool:
+	putBool(lv10);
+	goto *ret9;
+	void* ret11;		// Return address of putinteger
+	int lv12;		// putinteger i
+putinteger:
+	putInteger(lv12);
+	goto *ret11;
+	void* ret13;		// Return address of putfloat
+	double lv14;		// putfloat f
+putfloat:
+	putFloat(lv14);
+	goto *ret13;
+	void* ret15;		// Return address of putstring
+	long long lv16;		// putstring s
+putstring:
+	putString((char*)lv16);
+	goto *ret15;
+	static int v17;		// i
+	static int v18;		// d
+	static int v19;		// count
+	static bool v20;		// flag
+	static bool v21;		// seen
+start:
+	init(static_data());		// Static memory is only known once the whole program is parsed
+	long long cse35;
+	long long cse39;
+	Reg[SP] = Reg[FP] - 32;		// Allocate the frame
+	v17 = 0;		// assign local variable
+	{		// Loop invariants
+	long long iv22;
+	long long ptr23;
+	iv22 = v17;		// Induction variable
+	Reg[0] = iv22 * 4;		// expression = operand1 op operand2
+	Reg[0] = (Reg[FP] - 32) + Reg[0];		// expression = operand1 op operand2
+	ptr23 = Reg[0];		// Address stepped by the loop
+	if (iv22 < 8) {
+	do {
+	Reg[0] = iv22 * 5;		// expression = operand1 op operand2
+	Reg[0] = Reg[0] - 12;		// expression = operand1 op operand2
+	MEM(int, ptr23) = Reg[0];		// a + offset = expression
+	Reg[0] = iv22 + 1;		// expression = operand1 op operand2
+	iv22 = Reg[0];		// assign local variable
+	ptr23 = ptr23 + 4;
+	} while (iv22 < 8);
+	}
+	v17 = iv22;
+	}
+	v18 = 0;		// assign local variable
+	if (!((long long)v18 != 0)) goto else1;
+	Reg[0] = 100 / (long long)v18;		// expression = operand1 op operand2
+	if (!(Reg[0] > 3)) goto else1;
+	Reg[0] = (long long)&MEM(char, 0);		// operand
+	lv16 = Reg[0];		// Pass argument
+	ret15 = &&postputstring2;
+	goto putstring;		// jump to leaf procedure
+postputstring2:
+	goto next3;
+else1:
+	Reg[0] = (long long)&MEM(char, 18);		// operand
+	lv16 = Reg[0];		// Pass argument
+	ret15 = &&postputstring4;
+	goto putstring;		// jump to leaf procedure
+postputstring4:
+next3:
+	if (((long long)v18 == 0)) goto skip6;
+	Reg[0] = 100 / (long long)v18;		// expression = operand1 op operand2
+	if (!(Reg[0] > 3)) goto else5;
+skip6:
+	Reg[0] = (long long)&MEM(char, 41);		// operand
+	lv16 = Reg[0];		// Pass argument
+	ret15 = &&postputstring7;
+	goto putstring;		// jump to leaf procedure
+postputstring7:
+else5:
+	v19 = 0;		// assign local variable
+	v17 = 0;		// assign local variable
+	{		// Loop invariants
+	long long iv28;
+	long long ptr29;
+	iv28 = v17;		// Induction variable
+	Reg[0] = iv28 * 4;		// expression = operand1 op operand2
+	Reg[0] = (Reg[FP] - 32) + Reg[0];		// expression = operand1 op operand2
+	ptr29 = Reg[0];		// Address stepped by the loop
+	if (!(iv28 < 8)) goto endloop8;
+	Reg[0] = ptr29;		// operand
+	Reg[0] = MEM(int, Reg[0]);		// Get array operand
+	if ((Reg[0] > 0)) goto endloop8;
+loop8:
+	Reg[0] = (long long)v19 + 1;		// expression = operand1 op operand2
+	v19 = Reg[0];		// assign local variable
+	Reg[0] = iv28 + 1;		// expression = operand1 op operand2
+	iv28 = Reg[0];		// assign local variable
+	ptr29 = ptr29 + 4;
+	if (!(iv28 < 8)) goto skip9;
+	Reg[0] = ptr29;		// operand
+	Reg[0] = MEM(int, Reg[0]);		// Get array operand
+	if (!(Reg[0] > 0)) goto loop8;
+skip9:
+endloop8:
+	;
+	v17 = iv28;
+	}
+	Reg[0] = (long long)v19;		// operand
+	lv12 = Reg[0];		// Pass argument
+	ret11 = &&postputinteger10;
+	goto putinteger;		// jump to leaf procedure
+postputinteger10:
+	Reg[0] = (long long)&MEM(char, 60);		// operand
+	lv16 = Reg[0];		// Pass argument
+	ret15 = &&postputstring11;
+	goto putstring;		// jump to leaf procedure
+postputstring11:
+	v19 = 0;		// assign local variable
+	v17 = 0;		// assign local variable
+	{		// Loop invariants
+	long long iv33;
+	long long ptr34;
+	iv33 = v17;		// Induction variable
+	Reg[0] = iv33 * 4;		// expression = operand1 op operand2
+	Reg[0] = (Reg[FP] - 32) + Reg[0];		// expression = operand1 op operand2
+	ptr34 = Reg[0];		// Address stepped by the loop
+	if (iv33 < 8) {
+	do {
+	Reg[0] = ptr34;		// operand
+	Reg[0] = MEM(int, Reg[0]);		// Get array operand
+	cse35 = Reg[0];		// Value used again
+	if ((Reg[0] < 0)) goto else12;
+	if ((cse35 > 20)) goto else12;
+	if ((cse35 == 3)) goto skip13;
+	if ((cse35 == 8)) goto skip13;
+	if (!(cse35 == 13)) goto else12;
+skip13:
+	Reg[0] = (long long)v19 + 1;		// expression = operand1 op operand2
+	v19 = Reg[0];		// assign local variable
+else12:
+	Reg[0] = iv33 + 1;		// expression = operand1 op operand2
+	iv33 = Reg[0];		// assign local variable
+	ptr34 = ptr34 + 4;
+	} while (iv33 < 8);
+	}
+	v17 = iv33;
+	}
+	Reg[0] = (long long)v19;		// operand
+	lv12 = Reg[0];		// Pass argument
+	ret11 = &&postputinteger14;
+	goto putinteger;		// jump to leaf procedure
+postputinteger14:
+	Reg[0] = (long long)&MEM(char, 60);		// operand
+	lv16 = Reg[0];		// Pass argument
+	ret15 = &&postputstring15;
+	goto putstring;		// jump to leaf procedure
+postputstring15:
+	Reg[0] = 1 * 4;		// expression = operand1 op operand2
+	Reg[0] = (Reg[FP] - 32) + Reg[0];		// expression = operand1 op operand2
+	Reg[0] = MEM(int, Reg[0]);		// Get array operand
+	cse39 = Reg[0];		// Value used again
+	Reg[0] = Reg[0] < 0;		// expression = operand1 op operand2
+	Reg[1] = 7 * 4;		// expression = operand1 op operand2
+	Reg[1] = (Reg[FP] - 32) + Reg[1];		// expression = operand1 op operand2
+	Reg[1] = MEM(int, Reg[1]);		// Get array operand
+	Reg[1] = Reg[1] > 0;		// expression = operand1 op operand2
+	Reg[0] = Reg[0] & Reg[1];		// expression = operand1 op operand2
+	v20 = Reg[0];		// assign local variable
+	Reg[0] = cse39 > 0;		// expression = operand1 op operand2
+	Reg[1] = v20;		// operand
+	Reg[1] = !Reg[1];		// not
+	Reg[0] = Reg[0] | Reg[1];		// expression = operand1 op operand2
+	v21 = Reg[0];		// assign local variable
+	if (!(v20)) goto else16;
+	if ((v21)) goto else16;
+	Reg[0] = (long long)&MEM(char, 63);		// operand
+	lv16 = Reg[0];		// Pass argument
+	ret15 = &&postputstring17;
+	goto putstring;		// jump to leaf procedure
+postputstring17:
+else16:
+	return 0;
+}
+
+long long static_data()
+{
+	strcpy(&MEM(char, 60), "\n");
+	strcpy(&MEM(char, 0), "divided by zero\n");
+	strcpy(&MEM(char, 41), "skipped it again\n");
+	strcpy(&MEM(char, 18), "skipped the division\n");
+	strcpy(&MEM(char, 63), "values kept\n");
+	return 77;
+}
@@ -0,0 +1,183 @@
+#include "runtime.h"
+
+long long static_data();
+
+int main() {
+	goto start;
+	void* ret1;		// Return address of getbool
+	bool lv2;		// getbool bb
+	long long lv2_address;
+getbool:
+	lv2 = getBool();
+	goto *ret1;
+	void* ret3;		// Return address of getinteger
+	int lv4;		// getinteger ii
+	long long lv4_address;
+getinteger:
+	lv4 = getInteger();
+	goto *ret3;
+	void* ret5;		// Return address of getfloat
+	double lv6;		// getfloat ff
+	long long lv6_address;
+getfloat:
+	lv6 = getFloat();
+	goto *ret5;
+	void* ret7;		// Return address of getstring
+	long long lv8;		// getstring ss
+	long long lv8_address;
+getstring:
+	lv8 = (long long)getString();
+	goto *ret7;
+	void* ret9;		// Return address of putbool
+	bool lv10;		// putbool b
+putbool:
+	putBool(lv10);
+	goto *ret9;
+	void* ret11;		// Return address of putinteger
+	int lv12;		// putinteger i
+putinteger:
+	putInteger(lv12);
+	goto *ret11;
+	void* ret13;		// Return address of putfloat
+	double lv14;		// putfloat f
+putfloat:
+	putFloat(lv14);
+	goto *ret13;
+	void* ret15;		// Return address of putstring
+	long long lv16;		// putstring s
+putstring:
+	putString((char*)lv16);
+	goto *ret15;
+	static int v17;		// i
+	static int v18;		// total
+	void* ret19;		// Return address of classify
+	int lv20;		// classify n
+	int lv21;		// classify kind
+	long long lv21_address;
+classify:
+	switch ((long long)lv20) {
+	case -1: goto arm2;
+	case 0: goto arm3;
+	case 1: case 3: case 5: case 7: case 9: goto arm4;
+	case 2: case 4: case 6: case 8: goto arm5;
+	default: goto arm6;
+	}
+arm2:
+	lv21 = 100;		// assign parameter
+	goto *ret19;		// Return from leaf
+arm3:
+	lv21 = 0;		// assign parameter
+	goto endcase1;
+arm4:
+	lv21 = 1;		// assign parameter
+	goto endcase1;
+arm5:
+	lv21 = 2;		// assign parameter
+	goto endcase1;
+arm6:
+	lv21 = 3;		// assign parameter
+endcase1:
+	Reg[0] = (long long)lv21 * 10;		// expression = operand1 op operand2
+	lv21 = Reg[0];		// assign parameter
+	goto *ret19;		// Return from leaf
+start:
+	init(static_data());		// Static memory is only known once the whole program is parsed
+	Reg[SP] = Reg[FP] - 8;		// Allocate the frame
+	v18 = 0;		// assign local variable
+	Reg[0] = 2;		// operand
+	Reg[0] = - Reg[0];		// Change sign
+	v17 = Reg[0];		// assign local variable
+	{		// Loop invariants
+	long long iv24;
+	long long inv25;
+	iv24 = v17;		// Induction variable
+	inv25 = (Reg[FP] - 8);		// Loop invariant
+	if (iv24 < 12) {
+	do {
+	Reg[0] = iv24;		// operand
+	Reg[1] = inv25;		// operand
+	Reg[2] = MEM(int, Reg[1]);		// Value of out argument
+	lv21 = Reg[2];		// Pass argument
+	lv21_address = Reg[1];
+	lv20 = Reg[0];		// Pass argument
+	ret19 = &&postclassify7;
+	goto classify;		// jump to leaf procedure
+postclassify7:
+	MEM(int, lv21_address) = lv21;		// Store out argument
+	Reg[0] = (long long)v18 + (long long)MEM(int, Reg[FP] - 8);		// expression = operand1 op operand2
+	v18 = Reg[0];		// assign local variable
+	Reg[0] = iv24 + 1;		// expression = operand1 op operand2
+	iv24 = Reg[0];		// assign local variable
+	} while (iv24 < 12);
+	}
+	v17 = iv24;
+	}
+	Reg[0] = (long long)v18;		// operand
+	lv12 = Reg[0];		// Pass argument
+	ret11 = &&postputinteger8;
+	goto putinteger;		// jump to leaf procedure
+postputinteger8:
+	Reg[0] = (long long)&MEM(char, 0);		// operand
+	lv16 = Reg[0];		// Pass argument
+	ret15 = &&postputstring9;
+	goto putstring;		// jump to leaf procedure
+postputstring9:
+	v17 = 0;		// assign local variable
+	{		// Loop invariants
+	long long iv27;
+	iv27 = v17;		// Induction variable
+	if (iv27 < 5000) {
+	do {
+	Reg[0] = iv27 * 7;		// expression = operand1 op operand2
+	switch (Reg[0]) {
+	case 7: goto arm11;
+	case 700: goto arm12;
+	case 7000: goto arm13;
+	case 21000: goto arm14;
+	case 34993: goto arm15;
+	default: goto endcase10;
+	}
+arm11:
+	Reg[0] = (long long)v18 + 1;		// expression = operand1 op operand2
+	v18 = Reg[0];		// assign local variable
+	goto endcase10;
+arm12:
+	Reg[0] = (long long)v18 + 2;		// expression = operand1 op operand2
+	v18 = Reg[0];		// assign local variable
+	goto endcase10;
+arm13:
+	Reg[0] = (long long)v18 + 3;		// expression = operand1 op operand2
+	v18 = Reg[0];		// assign local variable
+	goto endcase10;
+arm14:
+	Reg[0] = (long long)v18 + 4;		// expression = operand1 op operand2
+	v18 = Reg[0];		// assign local variable
+	goto endcase10;
+arm15:
+	Reg[0] = (long long)v18 + 5;		// expression = operand1 op operand2
+	v18 = Reg[0];		// assign local variable
+endcase10:
+	Reg[0] = iv27 + 1;		// expression = operand1 op operand2
+	iv27 = Reg[0];		// assign local variable
+	} while (iv27 < 5000);
+	}
+	v17 = iv27;
+	}
+	Reg[0] = (long long)v18;		// operand
+	lv12 = Reg[0];		// Pass argument
+	ret11 = &&postputinteger16;
+	goto putinteger;		// jump to leaf procedure
+postputinteger16:
+	Reg[0] = (long long)&MEM(char, 0);		// operand
+	lv16 = Reg[0];		// Pass argument
+	ret15 = &&postputstring17;
+	goto putstring;		// jump to leaf procedure
+postputstring17:
+	return 0;
+}
+
+long long static_data()
+{
+	strcpy(&MEM(char, 0), "\n");
+	return 3;
+}
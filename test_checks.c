@@ -0,0 +1,143 @@
+#include "runtime.h"
+
+long long static_data();
+
+int main() {
+	goto start;
+	void* ret1;		// Return address of getbool
+	bool lv2;		// getbool bb
+	long long lv2_address;
+getbool:
+	lv2 = getBool();
+	goto *ret1;
+	void* ret3;		// Return address of getinteger
+	int lv4;		// getinteger ii
+	long long lv4_address;
+getinteger:
+	lv4 = getInteger();
+	goto *ret3;
+	void* ret5;		// Return address of getfloat
+	double lv6;		// getfloat ff
+	long long lv6_address;
+getfloat:
+	lv6 = getFloat();
+	goto *ret5;
+	void* ret7;		// Return address of getstring
+	long long lv8;		// getstring ss
+	long long lv8_address;
+getstring:
+	lv8 = (long long)getString();
+	goto *ret7;
+	void* ret9;		// Return address of putbool
+	bool lv10;		// putbool b
+putbool:
+	putBool(lv10);
+	goto *ret9;
+	void* ret11;		// Return address of putinteger
+	int lv12;		// putinteger i
+putinteger:
+	putInteger(lv12);
+	goto *ret11;
+	void* ret13;		// Return address of putfloat
+	double lv14;		// putfloat f
+putfloat:
+	putFloat(lv14);
+	goto *ret13;
+	void* ret15;		// Return address of putstring
+	long long lv16;		// putstring s
+putstring:
+	putString((char*)lv16);
+	goto *ret15;
+	static int v17;		// i
+	static int v18;		// bit
+	static int v19;		// parity
+	static int v20;		// count
+	static bool v21;		// on
+start:
+	init(static_data());		// Static memory is only known once the whole program is parsed
+	long long cse27;
+	Reg[SP] = Reg[FP] - 16;		// Allocate the frame
+	v21 = true;		// assign local variable
+	v20 = 0;		// assign local variable
+	if (!(v21 == 1)) goto else1;
+	Reg[0] = (long long)v20 + 1;		// expression = operand1 op operand2
+	v20 = Reg[0];		// assign local variable
+else1:
+	v17 = 0;		// assign local variable
+	{		// Loop invariants
+	long long iv23;
+	long long ptr24;
+	iv23 = v17;		// Induction variable
+	Reg[0] = iv23 * 4;		// expression = operand1 op operand2
+	Reg[0] = (Reg[FP] - 16) + Reg[0];		// expression = operand1 op operand2
+	ptr24 = Reg[0];		// Address stepped by the loop
+	if (iv23 < 4) {
+	do {
+	MEM(int, ptr24) = iv23;		// flags + offset = expression
+	Reg[0] = iv23 + 1;		// expression = operand1 op operand2
+	iv23 = Reg[0];		// assign local variable
+	ptr24 = ptr24 + 4;
+	} while (iv23 < 4);
+	}
+	v17 = iv23;
+	}
+	v17 = 0;		// assign local variable
+	{		// Loop invariants
+	long long iv25;
+	long long ptr26;
+	iv25 = v17;		// Induction variable
+	Reg[0] = iv25 * 4;		// expression = operand1 op operand2
+	Reg[0] = (Reg[FP] - 16) + Reg[0];		// expression = operand1 op operand2
+	ptr26 = Reg[0];		// Address stepped by the loop
+	if (iv25 < 4) {
+	do {
+	Reg[0] = ptr26;		// operand
+	Reg[0] = MEM(int, Reg[0]);		// Get array operand
+	cse27 = Reg[0];		// Value used again
+	Reg[0] = Reg[0] & 1;		// expression = operand1 op operand2
+	v18 = Reg[0];		// assign local variable
+	if (!((long long)v18 == v21)) goto else2;
+	Reg[0] = (long long)v20 + 10;		// expression = operand1 op operand2
+	v20 = Reg[0];		// assign local variable
+else2:
+	Reg[0] = cse27 / 2;		// expression = operand1 op operand2
+	Reg[0] = Reg[0] & 1;		// expression = operand1 op operand2
+	v19 = Reg[0];		// assign local variable
+	if (!(v21 != (long long)v19)) goto else3;
+	Reg[0] = (long long)v20 + 100;		// expression = operand1 op operand2
+	v20 = Reg[0];		// assign local variable
+else3:
+	Reg[0] = iv25 + 1;		// expression = operand1 op operand2
+	iv25 = Reg[0];		// assign local variable
+	ptr26 = ptr26 + 4;
+	} while (iv25 < 4);
+	}
+	v17 = iv25;
+	}
+	Reg[0] = 2 * 4;		// expression = operand1 op operand2
+	Reg[0] = (Reg[FP] - 16) + Reg[0];		// expression = operand1 op operand2
+	Reg[0] = MEM(int, Reg[0]);		// Get array operand
+	if (__builtin_expect((unsigned long long)Reg[0] > 1, 0))		// Integer compared to a bool
+		dataConversionCheck(Reg[0]);
+	if (!(Reg[0] == v21)) goto else4;
+	Reg[0] = (long long)v20 + 1000;		// expression = operand1 op operand2
+	v20 = Reg[0];		// assign local variable
+else4:
+	Reg[0] = (long long)v20;		// operand
+	lv12 = Reg[0];		// Pass argument
+	ret11 = &&postputinteger5;
+	goto putinteger;		// jump to leaf procedure
+postputinteger5:
+	Reg[0] = (long long)&MEM(char, 0);		// operand
+	lv16 = Reg[0];		// Pass argument
+	ret15 = &&postputstring6;
+	goto putstring;		// jump to leaf procedure
+postputstring6:
+	return 0;
+}
+
+long long static_data()
+{
+	strcpy(&MEM(char, 0), "\n");
+	return 3;
+}
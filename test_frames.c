@@ -0,0 +1,187 @@
+#include "runtime.h"
+
+long long static_data();
+
+int main() {
+	goto start;
+	void* ret1;		// Return address of getbool
+	bool lv2;		// getbool bb
+	long long lv2_address;
+getbool:
+	lv2 = getBool();
+	goto *ret1;
+	void* ret3;		// Return address of getinteger
+	int lv4;		// getinteger ii
+	long long lv4_address;
+getinteger:
+	lv4 = getInteger();
+	goto *ret3;
+	void* ret5;		// Return address of getfloat
+	double lv6;		// getfloat ff
+	long long lv6_address;
+getfloat:
+	lv6 = getFloat();
+	goto *ret5;
+	void* ret7;		// Return address of getstring
+	long long lv8;		// getstring ss
+	long long lv8_address;
+getstring:
+	lv8 = (long long)getString();
+	goto *ret7;
+	void* ret9;		// Return address of putbool
+	bool lv10;		// putbool b
+putbool:
+	putBool(lv10);
+	goto *ret9;
+	void* ret11;		// Return address of putinteger
+	int lv12;		// putinteger i
+putinteger:
+	putInteger(lv12);
+	goto *ret11;
+	void* ret13;		// Return address of putfloat
+	double lv14;		// putfloat f
+putfloat:
+	putFloat(lv14);
+	goto *ret13;
+	void* ret15;		// Return address of putstring
+	long long lv16;		// putstring s
+putstring:
+	putString((char*)lv16);
+	goto *ret15;
+	static int v17;		// n
+	long long cse18;
+walk:
+	Reg[SP] = Reg[FP] - 144;		// Allocate the frame
+	Reg[0] = (long long)MEM(int, Reg[FP] + 16) * (long long)MEM(int, Reg[FP] + 16);		// expression = operand1 op operand2
+	cse18 = Reg[0];		// Value used again
+	MEM(int, Reg[FP] - 8) = Reg[0];		// assign local variable
+	Reg[0] = (long long)MEM(int, Reg[FP] - 8) / 97;		// expression = operand1 op operand2
+	Reg[0] = Reg[0] * 97;		// expression = operand1 op operand2
+	Reg[0] = (long long)MEM(int, Reg[FP] - 8) - Reg[0];		// expression = operand1 op operand2
+	MEM(int, Reg[FP] + 32) = Reg[0];		// assign parameter
+	MEM(int, Reg[FP] - 8) = 0;		// assign local variable
+	{		// Loop invariants
+	long long iv22;
+	long long inv23;
+	long long ptr24;
+	iv22 = MEM(int, Reg[FP] - 8);		// Induction variable
+	inv23 = (long long)MEM(int, Reg[FP] + 16);		// Loop invariant
+	Reg[0] = iv22 * 4;		// expression = operand1 op operand2
+	Reg[0] = (((Reg[FP] - 73) & -64)) + Reg[0];		// expression = operand1 op operand2
+	ptr24 = Reg[0];		// Address stepped by the loop
+	if (iv22 < 16) {
+	do {
+	Reg[0] = iv22 + inv23;		// expression = operand1 op operand2
+	MEM(int, ptr24) = Reg[0];		// buffer + offset = expression
+	Reg[0] = iv22 + 1;		// expression = operand1 op operand2
+	iv22 = Reg[0];		// assign local variable
+	ptr24 = ptr24 + 4;
+	} while (iv22 < 16);
+	}
+	MEM(int, Reg[FP] - 8) = iv22;
+	}
+	MEM(int, Reg[FP] - 8) = 0;		// assign local variable
+	MEM(int, Reg[FP] - 16) = 0;		// assign local variable
+	{		// Loop invariants
+	long long iv26;
+	long long ptr27;
+	iv26 = MEM(int, Reg[FP] - 16);		// Induction variable
+	Reg[0] = iv26 * 4;		// expression = operand1 op operand2
+	Reg[0] = (((Reg[FP] - 73) & -64)) + Reg[0];		// expression = operand1 op operand2
+	ptr27 = Reg[0];		// Address stepped by the loop
+	if (iv26 < 16) {
+	do {
+	Reg[0] = ptr27;		// operand
+	Reg[0] = MEM(int, Reg[0]);		// Get array operand
+	Reg[0] = (long long)MEM(int, Reg[FP] - 8) + Reg[0];		// expression = operand1 op operand2
+	MEM(int, Reg[FP] - 8) = Reg[0];		// assign local variable
+	Reg[0] = iv26 + 1;		// expression = operand1 op operand2
+	iv26 = Reg[0];		// assign local variable
+	ptr27 = ptr27 + 4;
+	} while (iv26 < 16);
+	}
+	MEM(int, Reg[FP] - 16) = iv26;
+	}
+	Reg[0] = (long long)MEM(int, Reg[FP] + 32) + (long long)MEM(int, Reg[FP] - 8);		// expression = operand1 op operand2
+	MEM(int, Reg[FP] + 32) = Reg[0];		// assign parameter
+	Reg[0] = cse18 * (long long)MEM(int, Reg[FP] + 16);		// expression = operand1 op operand2
+	MEM(int, Reg[FP] - 8) = Reg[0];		// assign local variable
+	Reg[0] = (long long)MEM(int, Reg[FP] - 8) / 89;		// expression = operand1 op operand2
+	Reg[0] = Reg[0] * 89;		// expression = operand1 op operand2
+	Reg[0] = (long long)MEM(int, Reg[FP] - 8) - Reg[0];		// expression = operand1 op operand2
+	Reg[0] = (long long)MEM(int, Reg[FP] + 32) + Reg[0];		// expression = operand1 op operand2
+	MEM(int, Reg[FP] + 32) = Reg[0];		// assign parameter
+	if (!((long long)MEM(int, Reg[FP] + 16) > 0)) goto else1;
+	Reg[0] = (long long)MEM(int, Reg[FP] + 16) - 1;		// expression = operand1 op operand2
+	Reg[1] = (Reg[FP] - 144);		// operand
+	Reg[2] = MEM(int, Reg[1]);		// Value of out argument
+	Reg[SP] = Reg[SP] - 8;		// Make space on stack for argument
+	MEM(int, Reg[SP]) = Reg[2];		// Move argument to stack
+	Reg[SP] = Reg[SP] - 8;		// Allocate space for out param address
+	MEM(long long, Reg[SP]) = Reg[1];		// Push address for out parameter onto stack
+	Reg[SP] = Reg[SP] - 8;		// Make space on stack for argument
+	MEM(int, Reg[SP]) = Reg[0];		// Move argument to stack
+	Reg[SP] = Reg[SP] - 8;		// Allocate space for return address
+	Reg[0] = (long long)&&postwalk2;
+	MEM(long long, Reg[SP]) = Reg[0];		// save return address
+	Reg[SP] = Reg[SP] - 8;		// Allocate space for FP
+	MEM(long long, Reg[SP]) = Reg[FP];		// Save frame pointer
+	Reg[FP] = Reg[SP];		// Move frame pointer to new position
+	goto walk;		// jump to procedure
+postwalk2:
+	Reg[SP] = Reg[SP] + 8;		// Free input parameter
+	Reg[0] = MEM(long long, Reg[SP]);		// Get address of out param off stack
+	Reg[SP] = Reg[SP] + 8;
+	MEM(int, Reg[0]) = MEM(int, Reg[SP]);		// Get out param off stack
+	Reg[SP] = Reg[SP] + 8;		// Free output parameter
+	Reg[0] = (long long)MEM(int, Reg[FP] + 32) + (long long)MEM(int, Reg[FP] - 144);		// expression = operand1 op operand2
+	MEM(int, Reg[FP] + 32) = Reg[0];		// assign parameter
+	Reg[0] = (long long)MEM(int, Reg[FP] + 32) / 1000003;		// expression = operand1 op operand2
+	Reg[0] = Reg[0] * 1000003;		// expression = operand1 op operand2
+	Reg[0] = (long long)MEM(int, Reg[FP] + 32) - Reg[0];		// expression = operand1 op operand2
+	MEM(int, Reg[FP] + 32) = Reg[0];		// assign parameter
+else1:
+	Reg[SP] = Reg[FP];		// Free local variables
+	Reg[FP] = MEM(long long, Reg[FP]);		// Restore Frame pointer
+	Reg[SP] = Reg[SP] + 8;		// Free space for FP
+	Reg[0] = MEM(long long, Reg[SP]);		// Pop return address off the stack
+	Reg[SP] = Reg[SP] + 8;		// Free return address space
+	goto *(void*)Reg[0];		// Return
+start:
+	init(static_data());		// Static memory is only known once the whole program is parsed
+	Reg[SP] = Reg[FP] - 8;		// Allocate the frame
+	v17 = 20000;		// assign local variable
+	Reg[0] = (long long)v17;		// operand
+	Reg[1] = (Reg[FP] - 8);		// operand
+	Reg[2] = MEM(int, Reg[1]);		// Value of out argument
+	Reg[SP] = Reg[SP] - 8;		// Make space on stack for argument
+	MEM(int, Reg[SP]) = Reg[2];		// Move argument to stack
+	Reg[SP] = Reg[SP] - 8;		// Allocate space for out param address
+	MEM(long long, Reg[SP]) = Reg[1];		// Push address for out parameter onto stack
+	Reg[SP] = Reg[SP] - 8;		// Make space on stack for argument
+	MEM(int, Reg[SP]) = Reg[0];		// Move argument to stack
+	Reg[SP] = Reg[SP] - 8;		// Allocate space for return address
+	Reg[0] = (long long)&&postwalk3;
+	MEM(long long, Reg[SP]) = Reg[0];		// save return address
+	Reg[SP] = Reg[SP] - 8;		// Allocate space for FP
+	MEM(long long, Reg[SP]) = Reg[FP];		// Save frame pointer
+	Reg[FP] = Reg[SP];		// Move frame pointer to new position
+	goto walk;		// jump to procedure
+postwalk3:
+	Reg[SP] = Reg[SP] + 8;		// Free input parameter
+	Reg[0] = MEM(long long, Reg[SP]);		// Get address of out param off stack
+	Reg[SP] = Reg[SP] + 8;
+	MEM(int, Reg[0]) = MEM(int, Reg[SP]);		// Get out param off stack
+	Reg[SP] = Reg[SP] + 8;		// Free output parameter
+	Reg[0] = (long long)MEM(int, Reg[FP] - 8);		// operand
+	lv12 = Reg[0];		// Pass argument
+	ret11 = &&postputinteger4;
+	goto putinteger;		// jump to leaf procedure
+postputinteger4:
+	return 0;
+}
+
+long long static_data()
+{
+	return 0;
+}
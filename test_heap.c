@@ -0,0 +1,112 @@
+#include "runtime.h"
+
+long long static_data();
+
+int main() {
+	goto start;
+	void* ret1;		// Return address of getbool
+	bool lv2;		// getbool bb
+	long long lv2_address;
+getbool:
+	lv2 = getBool();
+	goto *ret1;
+	void* ret3;		// Return address of getinteger
+	int lv4;		// getinteger ii
+	long long lv4_address;
+getinteger:
+	lv4 = getInteger();
+	goto *ret3;
+	void* ret5;		// Return address of getfloat
+	double lv6;		// getfloat ff
+	long long lv6_address;
+getfloat:
+	lv6 = getFloat();
+	goto *ret5;
+	void* ret7;		// Return address of getstring
+	long long lv8;		// getstring ss
+	long long lv8_address;
+getstring:
+	lv8 = (long long)getString();
+	goto *ret7;
+	void* ret9;		// Return address of putbool
+	bool lv10;		// putbool b
+putbool:
+	putBool(lv10);
+	goto *ret9;
+	void* ret11;		// Return address of putinteger
+	int lv12;		// putinteger i
+putinteger:
+	putInteger(lv12);
+	goto *ret11;
+	void* ret13;		// Return address of putfloat
+	double lv14;		// putfloat f
+putfloat:
+	putFloat(lv14);
+	goto *ret13;
+	void* ret15;		// Return address of putstring
+	long long lv16;		// putstring s
+putstring:
+	putString((char*)lv16);
+	goto *ret15;
+print_string:
+	Reg[SP] = Reg[FP] - 8;		// Allocate the frame
+	Reg[0] = (long long)&MEM(char, 0);		// operand
+	lv16 = Reg[0];		// Pass argument
+	ret15 = &&postputstring1;
+	goto putstring;		// jump to leaf procedure
+postputstring1:
+	Reg[0] = (Reg[FP] - 8);		// operand
+	Reg[1] = MEM(long long, Reg[0]);		// Value of out argument
+	lv8 = Reg[1];		// Pass argument
+	lv8_address = Reg[0];
+	ret7 = &&postgetstring2;
+	goto getstring;		// jump to leaf procedure
+postgetstring2:
+	MEM(long long, lv8_address) = lv8;		// Store out argument
+	if (!((long long)MEM(int, Reg[FP] + 16) < 3)) goto else3;
+	Reg[0] = (long long)MEM(int, Reg[FP] + 16) + 1;		// expression = operand1 op operand2
+	Reg[SP] = Reg[SP] - 8;		// Make space on stack for argument
+	MEM(int, Reg[SP]) = Reg[0];		// Move argument to stack
+	Reg[SP] = Reg[SP] - 8;		// Allocate space for return address
+	Reg[0] = (long long)&&postprint_string4;
+	MEM(long long, Reg[SP]) = Reg[0];		// save return address
+	Reg[SP] = Reg[SP] - 8;		// Allocate space for FP
+	MEM(long long, Reg[SP]) = Reg[FP];		// Save frame pointer
+	Reg[FP] = Reg[SP];		// Move frame pointer to new position
+	goto print_string;		// jump to procedure
+postprint_string4:
+	Reg[SP] = Reg[SP] + 8;		// Free input parameter
+else3:
+	Reg[0] = MEM(long long, Reg[FP] - 8);		// operand
+	lv16 = Reg[0];		// Pass argument
+	ret15 = &&postputstring5;
+	goto putstring;		// jump to leaf procedure
+postputstring5:
+	Reg[SP] = Reg[FP];		// Free local variables
+	Reg[FP] = MEM(long long, Reg[FP]);		// Restore Frame pointer
+	Reg[SP] = Reg[SP] + 8;		// Free space for FP
+	Reg[0] = MEM(long long, Reg[SP]);		// Pop return address off the stack
+	Reg[SP] = Reg[SP] + 8;		// Free return address space
+	goto *(void*)Reg[0];		// Return
+start:
+	init(static_data());		// Static memory is only known once the whole program is parsed
+	Reg[0] = 0;		// operand
+	Reg[SP] = Reg[SP] - 8;		// Make space on stack for argument
+	MEM(int, Reg[SP]) = Reg[0];		// Move argument to stack
+	Reg[SP] = Reg[SP] - 8;		// Allocate space for return address
+	Reg[0] = (long long)&&postprint_string6;
+	MEM(long long, Reg[SP]) = Reg[0];		// save return address
+	Reg[SP] = Reg[SP] - 8;		// Allocate space for FP
+	MEM(long long, Reg[SP]) = Reg[FP];		// Save frame pointer
+	Reg[FP] = Reg[SP];		// Move frame pointer to new position
+	goto print_string;		// jump to procedure
+postprint_string6:
+	Reg[SP] = Reg[SP] + 8;		// Free input parameter
+	return 0;
+}
+
+long long static_data()
+{
+	strcpy(&MEM(char, 0), "Enter a string:");
+	return 16;
+}
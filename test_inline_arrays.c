@@ -0,0 +1,184 @@
+#include "runtime.h"
+
+long long static_data();
+
+int main() {
+	goto start;
+	void* ret1;		// Return address of getbool
+	bool lv2;		// getbool bb
+	long long lv2_address;
+getbool:
+	lv2 = getBool();
+	goto *ret1;
+	void* ret3;		// Return address of getinteger
+	int lv4;		// getinteger ii
+	long long lv4_address;
+getinteger:
+	lv4 = getInteger();
+	goto *ret3;
+	void* ret5;		// Return address of getfloat
+	double lv6;		// getfloat ff
+	long long lv6_address;
+getfloat:
+	lv6 = getFloat();
+	goto *ret5;
+	void* ret7;		// Return address of getstring
+	long long lv8;		// getstring ss
+	long long lv8_address;
+getstring:
+	lv8 = (long long)getString();
+	goto *ret7;
+	void* ret9;		// Return address of putbool
+	bool lv10;		// putbool b
+putbool:
+	putBool(lv10);
+	goto *ret9;
+	void* ret11;		// Return address of putinteger
+	int lv12;		// putinteger i
+putinteger:
+	putInteger(lv12);
+	goto *ret11;
+	void* ret13;		// Return address of putfloat
+	double lv14;		// putfloat f
+putfloat:
+	putFloat(lv14);
+	goto *ret13;
+	void* ret15;		// Return address of putstring
+	long long lv16;		// putstring s
+putstring:
+	putString((char*)lv16);
+	goto *ret15;
+	static int v17;		// i
+	static int v18;		// r
+q:
+	Reg[0] = (long long)MEM(int, Reg[FP] + 24) * 4;		// expression = operand1 op operand2
+	Reg[0] = (MEM(long long, Reg[FP] + 16)) + Reg[0];		// expression = operand1 op operand2
+	Reg[0] = MEM(int, Reg[0]);		// Get array operand
+	Reg[1] = (long long)MEM(int, Reg[FP] + 24) * 2;		// expression = operand1 op operand2
+	Reg[0] = Reg[0] + Reg[1];		// expression = operand1 op operand2
+	v18 = Reg[0];		// assign local variable
+	Reg[0] = (long long)v18;		// operand
+	lv12 = Reg[0];		// Pass argument
+	ret11 = &&postputinteger1;
+	goto putinteger;		// jump to leaf procedure
+postputinteger1:
+	Reg[SP] = Reg[FP];		// Free local variables
+	Reg[FP] = MEM(long long, Reg[FP]);		// Restore Frame pointer
+	Reg[SP] = Reg[SP] + 8;		// Free space for FP
+	Reg[0] = MEM(long long, Reg[SP]);		// Pop return address off the stack
+	Reg[SP] = Reg[SP] + 8;		// Free return address space
+	goto *(void*)Reg[0];		// Return
+	long long cse25;
+fill:
+	Reg[0] = 1 * 4;		// expression = operand1 op operand2
+	Reg[0] = (MEM(long long, Reg[FP] + 16)) + Reg[0];		// expression = operand1 op operand2
+	cse25 = Reg[0];		// Value used again
+	Reg[1] = (long long)MEM(int, Reg[FP] + 24) * 11;		// expression = operand1 op operand2
+	MEM(int, Reg[0]) = Reg[1];		// a1 + offset = expression
+	Reg[0] = cse25;		// operand
+	Reg[0] = MEM(int, Reg[0]);		// Get array operand
+	lv12 = Reg[0];		// Pass argument
+	ret11 = &&postputinteger2;
+	goto putinteger;		// jump to leaf procedure
+postputinteger2:
+	Reg[SP] = Reg[FP];		// Free local variables
+	Reg[FP] = MEM(long long, Reg[FP]);		// Restore Frame pointer
+	Reg[SP] = Reg[SP] + 8;		// Free space for FP
+	Reg[0] = MEM(long long, Reg[SP]);		// Pop return address off the stack
+	Reg[SP] = Reg[SP] + 8;		// Free return address space
+	goto *(void*)Reg[0];		// Return
+start:
+	init(static_data());		// Static memory is only known once the whole program is parsed
+	Reg[SP] = Reg[FP] - 24;		// Allocate the frame
+	Reg[0] = 0 * 4;		// expression = operand1 op operand2
+	Reg[0] = (Reg[FP] - 16) + Reg[0];		// expression = operand1 op operand2
+	MEM(int, Reg[0]) = 5;		// ma + offset = expression
+	Reg[0] = 1 * 4;		// expression = operand1 op operand2
+	Reg[0] = (Reg[FP] - 16) + Reg[0];		// expression = operand1 op operand2
+	MEM(int, Reg[0]) = 6;		// ma + offset = expression
+	Reg[0] = 2 * 4;		// expression = operand1 op operand2
+	Reg[0] = (Reg[FP] - 16) + Reg[0];		// expression = operand1 op operand2
+	MEM(int, Reg[0]) = 7;		// ma + offset = expression
+	Reg[0] = 3 * 4;		// expression = operand1 op operand2
+	Reg[0] = (Reg[FP] - 16) + Reg[0];		// expression = operand1 op operand2
+	MEM(int, Reg[0]) = 8;		// ma + offset = expression
+	v17 = 0;		// assign local variable
+	{		// Loop invariants
+	long long iv36;
+	long long inv37;
+	iv36 = v17;		// Induction variable
+	inv37 = (Reg[FP] - 16);		// Loop invariant
+	if (iv36 < 4) {
+	do {
+	Reg[0] = inv37;		// operand
+	Reg[1] = iv36;		// operand
+	v17 = iv36;
+	Reg[SP] = Reg[SP] - 8;		// Make space on stack for argument
+	MEM(int, Reg[SP]) = Reg[1];		// Move argument to stack
+	Reg[SP] = Reg[SP] - 8;
+	MEM(long long, Reg[SP]) = Reg[0];		// Pass array by reference
+	Reg[SP] = Reg[SP] - 8;		// Allocate space for return address
+	Reg[0] = (long long)&&postq3;
+	MEM(long long, Reg[SP]) = Reg[0];		// save return address
+	Reg[SP] = Reg[SP] - 8;		// Allocate space for FP
+	MEM(long long, Reg[SP]) = Reg[FP];		// Save frame pointer
+	Reg[FP] = Reg[SP];		// Move frame pointer to new position
+	goto q;		// jump to procedure
+postq3:
+	Reg[SP] = Reg[SP] + 8;		// Free array reference
+	Reg[SP] = Reg[SP] + 8;		// Free input parameter
+	iv36 = v17;		// Induction variable
+	inv37 = (Reg[FP] - 16);		// Loop invariant
+	Reg[0] = iv36 + 1;		// expression = operand1 op operand2
+	iv36 = Reg[0];		// assign local variable
+	} while (iv36 < 4);
+	}
+	v17 = iv36;
+	}
+	v17 = 0;		// assign local variable
+	{		// Loop invariants
+	long long iv38;
+	long long inv39;
+	iv38 = v17;		// Induction variable
+	inv39 = (Reg[FP] - 24);		// Loop invariant
+	if (iv38 < 2) {
+	do {
+	Reg[0] = inv39;		// operand
+	Reg[1] = 2;		// operand
+	v17 = iv38;
+	Reg[SP] = Reg[SP] - 8;		// Make space on stack for argument
+	MEM(int, Reg[SP]) = Reg[1];		// Move argument to stack
+	Reg[SP] = Reg[SP] - 8;
+	MEM(long long, Reg[SP]) = Reg[0];		// Pass array by reference
+	Reg[SP] = Reg[SP] - 8;		// Allocate space for return address
+	Reg[0] = (long long)&&postfill4;
+	MEM(long long, Reg[SP]) = Reg[0];		// save return address
+	Reg[SP] = Reg[SP] - 8;		// Allocate space for FP
+	MEM(long long, Reg[SP]) = Reg[FP];		// Save frame pointer
+	Reg[FP] = Reg[SP];		// Move frame pointer to new position
+	goto fill;		// jump to procedure
+postfill4:
+	Reg[SP] = Reg[SP] + 8;		// Free array reference
+	Reg[SP] = Reg[SP] + 8;		// Free input parameter
+	iv38 = v17;		// Induction variable
+	inv39 = (Reg[FP] - 24);		// Loop invariant
+	Reg[0] = iv38 + 1;		// expression = operand1 op operand2
+	iv38 = Reg[0];		// assign local variable
+	} while (iv38 < 2);
+	}
+	v17 = iv38;
+	}
+	Reg[0] = 1 * 4;		// expression = operand1 op operand2
+	Reg[0] = (Reg[FP] - 24) + Reg[0];		// expression = operand1 op operand2
+	Reg[0] = MEM(int, Reg[0]);		// Get array operand
+	lv12 = Reg[0];		// Pass argument
+	ret11 = &&postputinteger5;
+	goto putinteger;		// jump to leaf procedure
+postputinteger5:
+	return 0;
+}
+
+long long static_data()
+{
+	return 0;
+}
@@ -0,0 +1,298 @@
+#include "runtime.h"
+
+long long static_data();
+
+int main() {
+	goto start;
+	void* ret1;		// Return address of getbool
+	bool lv2;		// getbool bb
+	long long lv2_address;
+getbool:
+	lv2 = getBool();
+	goto *ret1;
+	void* ret3;		// Return address of getinteger
+	int lv4;		// getinteger ii
+	long long lv4_address;
+getinteger:
+	lv4 = getInteger();
+	goto *ret3;
+	void* ret5;		// Return address of getfloat
+	double lv6;		// getfloat ff
+	long long lv6_address;
+getfloat:
+	lv6 = getFloat();
+	goto *ret5;
+	void* ret7;		// Return address of getstring
+	long long lv8;		// getstring ss
+	long long lv8_address;
+getstring:
+	lv8 = (long long)getString();
+	goto *ret7;
+	void* ret9;		// Return address of putbool
+	bool lv10;		// putbool b
+putbool:
+	putBool(lv10);
+	goto *ret9;
+	void* ret11;		// Return address of putinteger
+	int lv12;		// putinteger i
+putinteger:
+	putInteger(lv12);
+	goto *ret11;
+	void* ret13;		// Return address of putfloat
+	double lv14;		// putfloat f
+putfloat:
+	putFloat(lv14);
+	goto *ret13;
+	void* ret15;		// Return address of putstring
+	long long lv16;		// putstring s
+putstring:
+	putString((char*)lv16);
+	goto *ret15;
+	static int v17;		// total
+	static int v18;		// n
+	static int v19;		// i
+	static int v20;		// j
+	static double v21;		// f
+walk:
+	Reg[SP] = Reg[FP] - 24;		// Allocate the frame
+	MEM(int, Reg[FP] - 8) = 0;		// assign local variable
+	{		// Loop invariants
+	long long iv22;
+	long long inv23;
+	long long inv24;
+	long long ptr25;
+	long long inv27;
+	long long inv28;
+	long long inv29;
+	iv22 = MEM(int, Reg[FP] - 8);		// Induction variable
+	inv23 = (long long)MEM(int, Reg[FP] + 24);		// Loop invariant
+	Reg[0] = (long long)MEM(int, Reg[FP] + 16) * 10;		// expression = operand1 op operand2
+	inv24 = Reg[0];		// Loop invariant
+	Reg[0] = iv22 * 4;		// expression = operand1 op operand2
+	Reg[0] = (Reg[FP] - 24) + Reg[0];		// expression = operand1 op operand2
+	ptr25 = Reg[0];		// Address stepped by the loop
+	Reg[0] = (long long)MEM(int, Reg[FP] + 16) < 2;		// expression = operand1 op operand2
+	inv27 = Reg[0];		// Loop invariant
+	Reg[0] = (long long)MEM(int, Reg[FP] + 16) + 1;		// expression = operand1 op operand2
+	inv28 = Reg[0];		// Loop invariant
+	Reg[0] = (long long)MEM(int, Reg[FP] + 24) * (long long)MEM(int, Reg[FP] + 16);		// expression = operand1 op operand2
+	inv29 = Reg[0];		// Loop invariant
+	if (iv22 < inv23) {
+	do {
+	Reg[0] = inv24 + iv22;		// expression = operand1 op operand2
+	MEM(int, ptr25) = Reg[0];		// vals + offset = expression
+	if (!(inv27)) goto else1;
+	Reg[0] = inv28;		// operand
+	Reg[1] = inv23;		// operand
+	MEM(int, Reg[FP] - 8) = iv22;
+	Reg[SP] = Reg[SP] - 8;		// Make space on stack for argument
+	MEM(int, Reg[SP]) = Reg[1];		// Move argument to stack
+	Reg[SP] = Reg[SP] - 8;		// Make space on stack for argument
+	MEM(int, Reg[SP]) = Reg[0];		// Move argument to stack
+	Reg[SP] = Reg[SP] - 8;		// Allocate space for return address
+	Reg[0] = (long long)&&postwalk2;
+	MEM(long long, Reg[SP]) = Reg[0];		// save return address
+	Reg[SP] = Reg[SP] - 8;		// Allocate space for FP
+	MEM(long long, Reg[SP]) = Reg[FP];		// Save frame pointer
+	Reg[FP] = Reg[SP];		// Move frame pointer to new position
+	goto walk;		// jump to procedure
+postwalk2:
+	Reg[SP] = Reg[SP] + 8;		// Free input parameter
+	Reg[SP] = Reg[SP] + 8;		// Free input parameter
+	iv22 = MEM(int, Reg[FP] - 8);		// Induction variable
+	inv23 = (long long)MEM(int, Reg[FP] + 24);		// Loop invariant
+	Reg[0] = (long long)MEM(int, Reg[FP] + 16) * 10;		// expression = operand1 op operand2
+	inv24 = Reg[0];		// Loop invariant
+	Reg[0] = iv22 * 4;		// expression = operand1 op operand2
+	Reg[0] = (Reg[FP] - 24) + Reg[0];		// expression = operand1 op operand2
+	ptr25 = Reg[0];		// Address stepped by the loop
+	Reg[0] = (long long)MEM(int, Reg[FP] + 16) < 2;		// expression = operand1 op operand2
+	inv27 = Reg[0];		// Loop invariant
+	Reg[0] = (long long)MEM(int, Reg[FP] + 16) + 1;		// expression = operand1 op operand2
+	inv28 = Reg[0];		// Loop invariant
+	Reg[0] = (long long)MEM(int, Reg[FP] + 24) * (long long)MEM(int, Reg[FP] + 16);		// expression = operand1 op operand2
+	inv29 = Reg[0];		// Loop invariant
+else1:
+	Reg[0] = ptr25;		// operand
+	Reg[0] = MEM(int, Reg[0]);		// Get array operand
+	Reg[0] = (long long)v17 + Reg[0];		// expression = operand1 op operand2
+	Reg[0] = Reg[0] + inv29;		// expression = operand1 op operand2
+	v17 = Reg[0];		// assign static
+	Reg[0] = iv22 + 1;		// expression = operand1 op operand2
+	iv22 = Reg[0];		// assign local variable
+	ptr25 = ptr25 + 4;
+	} while (iv22 < inv23);
+	}
+	MEM(int, Reg[FP] - 8) = iv22;
+	}
+	Reg[SP] = Reg[FP];		// Free local variables
+	Reg[FP] = MEM(long long, Reg[FP]);		// Restore Frame pointer
+	Reg[SP] = Reg[SP] + 8;		// Free space for FP
+	Reg[0] = MEM(long long, Reg[SP]);		// Pop return address off the stack
+	Reg[SP] = Reg[SP] + 8;		// Free return address space
+	goto *(void*)Reg[0];		// Return
+start:
+	init(static_data());		// Static memory is only known once the whole program is parsed
+	long long cse45;
+	Reg[SP] = Reg[FP] - 48;		// Allocate the frame
+	v17 = 0;		// assign static
+	Reg[0] = 0;		// operand
+	Reg[1] = 3;		// operand
+	Reg[SP] = Reg[SP] - 8;		// Make space on stack for argument
+	MEM(int, Reg[SP]) = Reg[1];		// Move argument to stack
+	Reg[SP] = Reg[SP] - 8;		// Make space on stack for argument
+	MEM(int, Reg[SP]) = Reg[0];		// Move argument to stack
+	Reg[SP] = Reg[SP] - 8;		// Allocate space for return address
+	Reg[0] = (long long)&&postwalk3;
+	MEM(long long, Reg[SP]) = Reg[0];		// save return address
+	Reg[SP] = Reg[SP] - 8;		// Allocate space for FP
+	MEM(long long, Reg[SP]) = Reg[FP];		// Save frame pointer
+	Reg[FP] = Reg[SP];		// Move frame pointer to new position
+	goto walk;		// jump to procedure
+postwalk3:
+	Reg[SP] = Reg[SP] + 8;		// Free input parameter
+	Reg[SP] = Reg[SP] + 8;		// Free input parameter
+	Reg[0] = (long long)v17;		// operand
+	lv12 = Reg[0];		// Pass argument
+	ret11 = &&postputinteger4;
+	goto putinteger;		// jump to leaf procedure
+postputinteger4:
+	v18 = 6;		// assign local variable
+	v19 = 0;		// assign local variable
+	{		// Loop invariants
+	long long iv33;
+	long long ptr34;
+	iv33 = v19;		// Induction variable
+	Reg[0] = iv33 * 4;		// expression = operand1 op operand2
+	Reg[0] = (Reg[FP] - 24) + Reg[0];		// expression = operand1 op operand2
+	ptr34 = Reg[0];		// Address stepped by the loop
+	if (iv33 < (long long)v18) {
+	do {
+	MEM(int, ptr34) = 0;		// grid + offset = expression
+	v20 = 0;		// assign local variable
+	{		// Loop invariants
+	long long iv35;
+	long long inv36;
+	iv35 = v20;		// Induction variable
+	Reg[0] = (long long)v18 - iv33;		// expression = operand1 op operand2
+	inv36 = Reg[0];		// Loop invariant
+	if (iv35 < inv36) {
+	do {
+	Reg[0] = ptr34;		// operand
+	Reg[0] = MEM(int, Reg[0]);		// Get array operand
+	Reg[1] = iv35 * (long long)v18;		// expression = operand1 op operand2
+	Reg[0] = Reg[0] + Reg[1];		// expression = operand1 op operand2
+	MEM(int, ptr34) = Reg[0];		// grid + offset = expression
+	Reg[0] = iv35 + 1;		// expression = operand1 op operand2
+	iv35 = Reg[0];		// assign local variable
+	} while (iv35 < inv36);
+	}
+	v20 = iv35;
+	}
+	Reg[0] = iv33 + 1;		// expression = operand1 op operand2
+	iv33 = Reg[0];		// assign local variable
+	ptr34 = ptr34 + 4;
+	} while (iv33 < (long long)v18);
+	}
+	v19 = iv33;
+	}
+	Reg[0] = (long long)v18 - 1;		// expression = operand1 op operand2
+	v19 = Reg[0];		// assign local variable
+	{		// Loop invariants
+	long long iv41;
+	long long ptr42;
+	iv41 = v19;		// Induction variable
+	Reg[0] = iv41 * 4;		// expression = operand1 op operand2
+	Reg[0] = (Reg[FP] - 24) + Reg[0];		// expression = operand1 op operand2
+	ptr42 = Reg[0];		// Address stepped by the loop
+	if (iv41 >= 0) {
+	do {
+	Reg[0] = ptr42;		// operand
+	Reg[0] = MEM(int, Reg[0]);		// Get array operand
+	lv12 = Reg[0];		// Pass argument
+	ret11 = &&postputinteger5;
+	goto putinteger;		// jump to leaf procedure
+postputinteger5:
+	Reg[0] = iv41 - 1;		// expression = operand1 op operand2
+	iv41 = Reg[0];		// assign local variable
+	ptr42 = ptr42 - 4;
+	} while (iv41 >= 0);
+	}
+	v19 = iv41;
+	}
+	v21 = 1.5;		// assign local variable
+	Reg[0] = 0 * 8;		// expression = operand1 op operand2
+	Reg[0] = (Reg[FP] - 48) + Reg[0];		// expression = operand1 op operand2
+	cse45 = Reg[0];		// Value used again
+	*((double*)&Reg[1]) = v21 * 2;		// expression = operand1 op operand2
+	MEM(double, Reg[0]) = *((double*)&Reg[1]);		// g + offset = expression
+	*((double*)&Reg[0]) = v21;		// operand
+	*((double*)&Reg[0]) = - *((double*)&Reg[0]);		// Change sign
+	Reg[1] = 4;		// operand
+	*((double*)&Reg[1]) = (double)Reg[1];	// Conversion
+	*((double*)&Reg[0]) = *((double*)&Reg[0]) + *((double*)&Reg[1]);		// expression = operand1 op operand2
+	Reg[1] = 1 * 8;		// expression = operand1 op operand2
+	Reg[1] = (Reg[FP] - 48) + Reg[1];		// expression = operand1 op operand2
+	MEM(double, Reg[1]) = *((double*)&Reg[0]);		// g + offset = expression
+	Reg[0] = cse45;		// operand
+	*((double*)&Reg[0]) = MEM(double, Reg[0]);		// Get array operand
+	*((double*)&Reg[0]) = *((double*)&Reg[0]) / 4;		// expression = operand1 op operand2
+	Reg[1] = 1;		// operand
+	*((double*)&Reg[1]) = (double)Reg[1];	// Conversion
+	*((double*)&Reg[0]) = *((double*)&Reg[0]) - *((double*)&Reg[1]);		// expression = operand1 op operand2
+	Reg[1] = 2 * 8;		// expression = operand1 op operand2
+	Reg[1] = (Reg[FP] - 48) + Reg[1];		// expression = operand1 op operand2
+	MEM(double, Reg[1]) = *((double*)&Reg[0]);		// g + offset = expression
+	v19 = 0;		// assign local variable
+	{		// Loop invariants
+	long long iv58;
+	long long ptr59;
+	double inv62;
+	iv58 = v19;		// Induction variable
+	Reg[0] = iv58 * 8;		// expression = operand1 op operand2
+	Reg[0] = (Reg[FP] - 48) + Reg[0];		// expression = operand1 op operand2
+	ptr59 = Reg[0];		// Address stepped by the loop
+	*((double*)&Reg[0]) = 0.5;		// operand
+	*((double*)&Reg[0]) = - *((double*)&Reg[0]);		// Change sign
+	inv62 = *((double*)&Reg[0]);		// Loop invariant
+	if (iv58 < 3) {
+	do {
+	Reg[0] = ptr59;		// operand
+	*((double*)&Reg[0]) = MEM(double, Reg[0]);		// Get array operand
+	*((double*)&Reg[0]) = *((double*)&Reg[0]) * v21;		// expression = operand1 op operand2
+	lv14 = *((double*)&Reg[0]);		// Pass argument
+	ret13 = &&postputfloat6;
+	goto putfloat;		// jump to leaf procedure
+postputfloat6:
+	Reg[0] = ptr59;		// operand
+	*((double*)&Reg[0]) = MEM(double, Reg[0]);		// Get array operand
+	if (!(*((double*)&Reg[0]) < inv62)) goto else7;
+	Reg[0] = (long long)&MEM(char, 0);		// operand
+	lv16 = Reg[0];		// Pass argument
+	ret15 = &&postputstring8;
+	goto putstring;		// jump to leaf procedure
+postputstring8:
+else7:
+	Reg[0] = iv58 + 1;		// expression = operand1 op operand2
+	iv58 = Reg[0];		// assign local variable
+	ptr59 = ptr59 + 8;
+	} while (iv58 < 3);
+	}
+	v19 = iv58;
+	}
+	if ((v21 > 2)) goto else9;
+	Reg[0] = (long long)&MEM(char, 4);		// operand
+	lv16 = Reg[0];		// Pass argument
+	ret15 = &&postputstring10;
+	goto putstring;		// jump to leaf procedure
+postputstring10:
+else9:
+	return 0;
+}
+
+long long static_data()
+{
+	strcpy(&MEM(char, 0), "neg");
+	strcpy(&MEM(char, 4), "ok");
+	return 7;
+}
@@ -0,0 +1,150 @@
+#include "runtime.h"
+
+extern long long module_counter_data;
+void module_counter(int entry);
+void module_counter_init();
+
+extern long long module_mathlib_data;
+void module_mathlib(int entry);
+void module_mathlib_init();
+
+long long static_data();
+
+int main() {
+	goto start;
+	void* ret1;		// Return address of getbool
+	bool lv2;		// getbool bb
+	long long lv2_address;
+getbool:
+	lv2 = getBool();
+	goto *ret1;
+	void* ret3;		// Return address of getinteger
+	int lv4;		// getinteger ii
+	long long lv4_address;
+getinteger:
+	lv4 = getInteger();
+	goto *ret3;
+	void* ret5;		// Return address of getfloat
+	double lv6;		// getfloat ff
+	long long lv6_address;
+getfloat:
+	lv6 = getFloat();
+	goto *ret5;
+	void* ret7;		// Return address of getstring
+	long long lv8;		// getstring ss
+	long long lv8_address;
+getstring:
+	lv8 = (long long)getString();
+	goto *ret7;
+	void* ret9;		// Return address of putbool
+	bool lv10;		// putbool b
+putbool:
+	putBool(lv10);
+	goto *ret9;
+	void* ret11;		// Return address of putinteger
+	int lv12;		// putinteger i
+putinteger:
+	putInteger(lv12);
+	goto *ret11;
+	void* ret13;		// Return address of putfloat
+	double lv14;		// putfloat f
+putfloat:
+	putFloat(lv14);
+	goto *ret13;
+	void* ret15;		// Return address of putstring
+	long long lv16;		// putstring s
+putstring:
+	putString((char*)lv16);
+	goto *ret15;
+start:
+	init(static_data());		// Static memory is only known once the whole program is parsed
+	module_counter_init();
+	module_mathlib_init();
+	Reg[SP] = Reg[FP] - 24;		// Allocate the frame
+	Reg[0] = 7;		// operand
+	Reg[1] = (Reg[FP] - 8);		// operand
+	Reg[2] = MEM(int, Reg[1]);		// Value of out argument
+	Reg[SP] = Reg[SP] - 8;		// Make space on stack for argument
+	MEM(int, Reg[SP]) = Reg[2];		// Move argument to stack
+	Reg[SP] = Reg[SP] - 8;		// Allocate space for out param address
+	MEM(long long, Reg[SP]) = Reg[1];		// Push address for out parameter onto stack
+	Reg[SP] = Reg[SP] - 8;		// Make space on stack for argument
+	MEM(int, Reg[SP]) = Reg[0];		// Move argument to stack
+	module_mathlib(0);		// call square in another function
+	Reg[SP] = Reg[SP] + 8;		// Free input parameter
+	Reg[0] = MEM(long long, Reg[SP]);		// Get address of out param off stack
+	Reg[SP] = Reg[SP] + 8;
+	MEM(int, Reg[0]) = MEM(int, Reg[SP]);		// Get out param off stack
+	Reg[SP] = Reg[SP] + 8;		// Free output parameter
+	Reg[0] = (long long)MEM(int, Reg[FP] - 8);		// operand
+	lv12 = Reg[0];		// Pass argument
+	ret11 = &&postputinteger1;
+	goto putinteger;		// jump to leaf procedure
+postputinteger1:
+	Reg[0] = 0 * 4;		// expression = operand1 op operand2
+	Reg[0] = (Reg[FP] - 24) + Reg[0];		// expression = operand1 op operand2
+	MEM(int, Reg[0]) = 1;		// v + offset = expression
+	Reg[0] = 1 * 4;		// expression = operand1 op operand2
+	Reg[0] = (Reg[FP] - 24) + Reg[0];		// expression = operand1 op operand2
+	MEM(int, Reg[0]) = 2;		// v + offset = expression
+	Reg[0] = 2 * 4;		// expression = operand1 op operand2
+	Reg[0] = (Reg[FP] - 24) + Reg[0];		// expression = operand1 op operand2
+	MEM(int, Reg[0]) = 3;		// v + offset = expression
+	Reg[0] = 3 * 4;		// expression = operand1 op operand2
+	Reg[0] = (Reg[FP] - 24) + Reg[0];		// expression = operand1 op operand2
+	MEM(int, Reg[0]) = 4;		// v + offset = expression
+	Reg[0] = (Reg[FP] - 24);		// operand
+	Reg[1] = (Reg[FP] - 8);		// operand
+	Reg[2] = MEM(int, Reg[1]);		// Value of out argument
+	Reg[SP] = Reg[SP] - 24;		// Copy array argument
+	memcpy(&MEM(char, Reg[SP]), &MEM(char, Reg[0]), 16);
+	MEM(long long, Reg[SP] + 16) = Reg[0];
+	Reg[0] = Reg[SP];
+	Reg[SP] = Reg[SP] - 8;		// Make space on stack for argument
+	MEM(int, Reg[SP]) = Reg[2];		// Move argument to stack
+	Reg[SP] = Reg[SP] - 8;		// Allocate space for out param address
+	MEM(long long, Reg[SP]) = Reg[1];		// Push address for out parameter onto stack
+	Reg[SP] = Reg[SP] - 8;
+	MEM(long long, Reg[SP]) = Reg[0];		// Pass array by reference
+	module_mathlib(1);		// call sum in another function
+	Reg[SP] = Reg[SP] + 8;		// Free array reference
+	Reg[0] = MEM(long long, Reg[SP]);		// Get address of out param off stack
+	Reg[SP] = Reg[SP] + 8;
+	MEM(int, Reg[0]) = MEM(int, Reg[SP]);		// Get out param off stack
+	Reg[SP] = Reg[SP] + 8;		// Free output parameter
+	Reg[SP] = Reg[SP] + 24;		// Free array copies
+	Reg[0] = (long long)MEM(int, Reg[FP] - 8);		// operand
+	lv12 = Reg[0];		// Pass argument
+	ret11 = &&postputinteger2;
+	goto putinteger;		// jump to leaf procedure
+postputinteger2:
+	Reg[0] = (long long)&MEM(char, 0);		// operand
+	Reg[SP] = Reg[SP] - 8;		// Make space on stack for argument
+	MEM(long long, Reg[SP]) = Reg[0];		// Move argument to stack
+	module_mathlib(2);		// call greet in another function
+	Reg[SP] = Reg[SP] + 8;		// Free input parameter
+	Reg[0] = (long long)MEM(int, (module_counter_data + 0));		// operand
+	lv12 = Reg[0];		// Pass argument
+	ret11 = &&postputinteger3;
+	goto putinteger;		// jump to leaf procedure
+postputinteger3:
+	Reg[0] = (long long)MEM(int, (module_mathlib_data + 0));		// operand
+	lv12 = Reg[0];		// Pass argument
+	ret11 = &&postputinteger4;
+	goto putinteger;		// jump to leaf procedure
+postputinteger4:
+	Reg[0] = 1 * 4;		// expression = operand1 op operand2
+	Reg[0] = (module_counter_data + 4) + Reg[0];		// expression = operand1 op operand2
+	Reg[0] = MEM(int, Reg[0]);		// Get array operand
+	lv12 = Reg[0];		// Pass argument
+	ret11 = &&postputinteger5;
+	goto putinteger;		// jump to leaf procedure
+postputinteger5:
+	return 0;
+}
+
+long long static_data()
+{
+	strcpy(&MEM(char, 0), "modules");
+	return 8;
+}
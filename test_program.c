@@ -0,0 +1,173 @@
+#include "runtime.h"
+
+long long static_data();
+
+int main() {
+	goto start;
+	void* ret1;		// Return address of getbool
+	bool lv2;		// getbool bb
+	long long lv2_address;
+getbool:
+	lv2 = getBool();
+	goto *ret1;
+	void* ret3;		// Return address of getinteger
+	int lv4;		// getinteger ii
+	long long lv4_address;
+getinteger:
+	lv4 = getInteger();
+	goto *ret3;
+	void* ret5;		// Return address of getfloat
+	double lv6;		// getfloat ff
+	long long lv6_address;
+getfloat:
+	lv6 = getFloat();
+	goto *ret5;
+	void* ret7;		// Return address of getstring
+	long long lv8;		// getstring ss
+	long long lv8_address;
+getstring:
+	lv8 = (long long)getString();
+	goto *ret7;
+	void* ret9;		// Return address of putbool
+	bool lv10;		// putbool b
+putbool:
+	putBool(lv10);
+	goto *ret9;
+	void* ret11;		// Return address of putinteger
+	int lv12;		// putinteger i
+putinteger:
+	putInteger(lv12);
+	goto *ret11;
+	void* ret13;		// Return address of putfloat
+	double lv14;		// putfloat f
+putfloat:
+	putFloat(lv14);
+	goto *ret13;
+	void* ret15;		// Return address of putstring
+	long long lv16;		// putstring s
+putstring:
+	putString((char*)lv16);
+	goto *ret15;
+fibb:
+	Reg[SP] = Reg[FP] - 16;		// Allocate the frame
+	if (!((long long)MEM(int, Reg[FP] + 16) < 0)) goto else1;
+	Reg[0] = 1;		// operand
+	Reg[0] = - Reg[0];		// Change sign
+	MEM(int, Reg[FP] + 32) = Reg[0];		// assign parameter
+	Reg[SP] = Reg[FP];		// Free local variables
+	Reg[FP] = MEM(long long, Reg[FP]);		// Restore Frame pointer
+	Reg[SP] = Reg[SP] + 8;		// Free space for FP
+	Reg[0] = MEM(long long, Reg[SP]);		// Pop return address off the stack
+	Reg[SP] = Reg[SP] + 8;		// Free return address space
+	goto *(void*)Reg[0];		// Return
+else1:
+	if (!((long long)MEM(int, Reg[FP] + 16) == 0)) goto else2;
+	MEM(int, Reg[FP] + 32) = 0;		// assign parameter
+	Reg[SP] = Reg[FP];		// Free local variables
+	Reg[FP] = MEM(long long, Reg[FP]);		// Restore Frame pointer
+	Reg[SP] = Reg[SP] + 8;		// Free space for FP
+	Reg[0] = MEM(long long, Reg[SP]);		// Pop return address off the stack
+	Reg[SP] = Reg[SP] + 8;		// Free return address space
+	goto *(void*)Reg[0];		// Return
+else2:
+	if (!((long long)MEM(int, Reg[FP] + 16) == 1)) goto else3;
+	MEM(int, Reg[FP] + 32) = 1;		// assign parameter
+	Reg[SP] = Reg[FP];		// Free local variables
+	Reg[FP] = MEM(long long, Reg[FP]);		// Restore Frame pointer
+	Reg[SP] = Reg[SP] + 8;		// Free space for FP
+	Reg[0] = MEM(long long, Reg[SP]);		// Pop return address off the stack
+	Reg[SP] = Reg[SP] + 8;		// Free return address space
+	goto *(void*)Reg[0];		// Return
+else3:
+	Reg[0] = (long long)MEM(int, Reg[FP] + 16) - 1;		// expression = operand1 op operand2
+	Reg[1] = (Reg[FP] - 8);		// operand
+	Reg[2] = MEM(int, Reg[1]);		// Value of out argument
+	Reg[SP] = Reg[SP] - 8;		// Make space on stack for argument
+	MEM(int, Reg[SP]) = Reg[2];		// Move argument to stack
+	Reg[SP] = Reg[SP] - 8;		// Allocate space for out param address
+	MEM(long long, Reg[SP]) = Reg[1];		// Push address for out parameter onto stack
+	Reg[SP] = Reg[SP] - 8;		// Make space on stack for argument
+	MEM(int, Reg[SP]) = Reg[0];		// Move argument to stack
+	Reg[SP] = Reg[SP] - 8;		// Allocate space for return address
+	Reg[0] = (long long)&&postfibb4;
+	MEM(long long, Reg[SP]) = Reg[0];		// save return address
+	Reg[SP] = Reg[SP] - 8;		// Allocate space for FP
+	MEM(long long, Reg[SP]) = Reg[FP];		// Save frame pointer
+	Reg[FP] = Reg[SP];		// Move frame pointer to new position
+	goto fibb;		// jump to procedure
+postfibb4:
+	Reg[SP] = Reg[SP] + 8;		// Free input parameter
+	Reg[0] = MEM(long long, Reg[SP]);		// Get address of out param off stack
+	Reg[SP] = Reg[SP] + 8;
+	MEM(int, Reg[0]) = MEM(int, Reg[SP]);		// Get out param off stack
+	Reg[SP] = Reg[SP] + 8;		// Free output parameter
+	Reg[0] = (long long)MEM(int, Reg[FP] + 16) - 2;		// expression = operand1 op operand2
+	Reg[1] = (Reg[FP] - 16);		// operand
+	Reg[2] = MEM(int, Reg[1]);		// Value of out argument
+	Reg[SP] = Reg[SP] - 8;		// Make space on stack for argument
+	MEM(int, Reg[SP]) = Reg[2];		// Move argument to stack
+	Reg[SP] = Reg[SP] - 8;		// Allocate space for out param address
+	MEM(long long, Reg[SP]) = Reg[1];		// Push address for out parameter onto stack
+	Reg[SP] = Reg[SP] - 8;		// Make space on stack for argument
+	MEM(int, Reg[SP]) = Reg[0];		// Move argument to stack
+	Reg[SP] = Reg[SP] - 8;		// Allocate space for return address
+	Reg[0] = (long long)&&postfibb5;
+	MEM(long long, Reg[SP]) = Reg[0];		// save return address
+	Reg[SP] = Reg[SP] - 8;		// Allocate space for FP
+	MEM(long long, Reg[SP]) = Reg[FP];		// Save frame pointer
+	Reg[FP] = Reg[SP];		// Move frame pointer to new position
+	goto fibb;		// jump to procedure
+postfibb5:
+	Reg[SP] = Reg[SP] + 8;		// Free input parameter
+	Reg[0] = MEM(long long, Reg[SP]);		// Get address of out param off stack
+	Reg[SP] = Reg[SP] + 8;
+	MEM(int, Reg[0]) = MEM(int, Reg[SP]);		// Get out param off stack
+	Reg[SP] = Reg[SP] + 8;		// Free output parameter
+	Reg[0] = (long long)MEM(int, Reg[FP] - 8) + (long long)MEM(int, Reg[FP] - 16);		// expression = operand1 op operand2
+	MEM(int, Reg[FP] + 32) = Reg[0];		// assign parameter
+	Reg[SP] = Reg[FP];		// Free local variables
+	Reg[FP] = MEM(long long, Reg[FP]);		// Restore Frame pointer
+	Reg[SP] = Reg[SP] + 8;		// Free space for FP
+	Reg[0] = MEM(long long, Reg[SP]);		// Pop return address off the stack
+	Reg[SP] = Reg[SP] + 8;		// Free return address space
+	goto *(void*)Reg[0];		// Return
+start:
+	init(static_data());		// Static memory is only known once the whole program is parsed
+	Reg[SP] = Reg[FP] - 8;		// Allocate the frame
+	Reg[0] = 1234;		// operand
+	Reg[0] = - Reg[0];		// Change sign
+	MEM(int, Reg[FP] - 8) = Reg[0];		// assign local variable
+	Reg[0] = 12;		// operand
+	Reg[1] = (Reg[FP] - 8);		// operand
+	Reg[2] = MEM(int, Reg[1]);		// Value of out argument
+	Reg[SP] = Reg[SP] - 8;		// Make space on stack for argument
+	MEM(int, Reg[SP]) = Reg[2];		// Move argument to stack
+	Reg[SP] = Reg[SP] - 8;		// Allocate space for out param address
+	MEM(long long, Reg[SP]) = Reg[1];		// Push address for out parameter onto stack
+	Reg[SP] = Reg[SP] - 8;		// Make space on stack for argument
+	MEM(int, Reg[SP]) = Reg[0];		// Move argument to stack
+	Reg[SP] = Reg[SP] - 8;		// Allocate space for return address
+	Reg[0] = (long long)&&postfibb6;
+	MEM(long long, Reg[SP]) = Reg[0];		// save return address
+	Reg[SP] = Reg[SP] - 8;		// Allocate space for FP
+	MEM(long long, Reg[SP]) = Reg[FP];		// Save frame pointer
+	Reg[FP] = Reg[SP];		// Move frame pointer to new position
+	goto fibb;		// jump to procedure
+postfibb6:
+	Reg[SP] = Reg[SP] + 8;		// Free input parameter
+	Reg[0] = MEM(long long, Reg[SP]);		// Get address of out param off stack
+	Reg[SP] = Reg[SP] + 8;
+	MEM(int, Reg[0]) = MEM(int, Reg[SP]);		// Get out param off stack
+	Reg[SP] = Reg[SP] + 8;		// Free output parameter
+	Reg[0] = (long long)MEM(int, Reg[FP] - 8);		// operand
+	lv12 = Reg[0];		// Pass argument
+	ret11 = &&postputinteger7;
+	goto putinteger;		// jump to leaf procedure
+postputinteger7:
+	return 0;
+}
+
+long long static_data()
+{
+	return 0;
+}
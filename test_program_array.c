@@ -0,0 +1,150 @@
+#include "runtime.h"
+
+long long static_data();
+
+int main() {
+	goto start;
+	void* ret1;		// Return address of getbool
+	bool lv2;		// getbool bb
+	long long lv2_address;
+getbool:
+	lv2 = getBool();
+	goto *ret1;
+	void* ret3;		// Return address of getinteger
+	int lv4;		// getinteger ii
+	long long lv4_address;
+getinteger:
+	lv4 = getInteger();
+	goto *ret3;
+	void* ret5;		// Return address of getfloat
+	double lv6;		// getfloat ff
+	long long lv6_address;
+getfloat:
+	lv6 = getFloat();
+	goto *ret5;
+	void* ret7;		// Return address of getstring
+	long long lv8;		// getstring ss
+	long long lv8_address;
+getstring:
+	lv8 = (long long)getString();
+	goto *ret7;
+	void* ret9;		// Return address of putbool
+	bool lv10;		// putbool b
+putbool:
+	putBool(lv10);
+	goto *ret9;
+	void* ret11;		// Return address of putinteger
+	int lv12;		// putinteger i
+putinteger:
+	putInteger(lv12);
+	goto *ret11;
+	void* ret13;		// Return address of putfloat
+	double lv14;		// putfloat f
+putfloat:
+	putFloat(lv14);
+	goto *ret13;
+	void* ret15;		// Return address of putstring
+	long long lv16;		// putstring s
+putstring:
+	putString((char*)lv16);
+	goto *ret15;
+	static int v17;		// i
+	void* ret18;		// Return address of square_array
+	long long lv19;		// square_array array
+	long long lv20;		// square_array result
+	int lv21;		// square_array i
+	long long cse25;
+square_array:
+	lv21 = 0;		// assign local variable
+	{		// Loop invariants
+	long long iv22;
+	long long ptr23;
+	long long ptr24;
+	iv22 = lv21;		// Induction variable
+	Reg[0] = iv22 * 4;		// expression = operand1 op operand2
+	Reg[0] = (lv19) + Reg[0];		// expression = operand1 op operand2
+	ptr23 = Reg[0];		// Address stepped by the loop
+	Reg[0] = iv22 * 4;		// expression = operand1 op operand2
+	Reg[0] = (lv20) + Reg[0];		// expression = operand1 op operand2
+	ptr24 = Reg[0];		// Address stepped by the loop
+	if (iv22 < 10) {
+	do {
+	Reg[0] = ptr23;		// operand
+	Reg[0] = MEM(int, Reg[0]);		// Get array operand
+	cse25 = Reg[0];		// Value used again
+	Reg[1] = cse25;		// operand
+	Reg[0] = Reg[0] * Reg[1];		// expression = operand1 op operand2
+	MEM(int, ptr24) = Reg[0];		// result + offset = expression
+	Reg[0] = iv22 + 1;		// expression = operand1 op operand2
+	iv22 = Reg[0];		// assign local variable
+	ptr23 = ptr23 + 4;
+	ptr24 = ptr24 + 4;
+	} while (iv22 < 10);
+	}
+	lv21 = iv22;
+	}
+	goto *ret18;		// Return from leaf
+start:
+	init(static_data());		// Static memory is only known once the whole program is parsed
+	Reg[SP] = Reg[FP] - 80;		// Allocate the frame
+	v17 = 0;		// assign local variable
+	{		// Loop invariants
+	long long iv27;
+	long long ptr28;
+	iv27 = v17;		// Induction variable
+	Reg[0] = iv27 * 4;		// expression = operand1 op operand2
+	Reg[0] = (Reg[FP] - 40) + Reg[0];		// expression = operand1 op operand2
+	ptr28 = Reg[0];		// Address stepped by the loop
+	if (iv27 < 10) {
+	do {
+	MEM(int, ptr28) = iv27;		// numbers + offset = expression
+	Reg[0] = iv27 + 1;		// expression = operand1 op operand2
+	iv27 = Reg[0];		// assign local variable
+	ptr28 = ptr28 + 4;
+	} while (iv27 < 10);
+	}
+	v17 = iv27;
+	}
+	Reg[0] = (Reg[FP] - 40);		// operand
+	Reg[1] = (Reg[FP] - 80);		// operand
+	lv20 = Reg[1];		// Pass array by reference
+	lv19 = Reg[0];		// Pass array by reference
+	ret18 = &&postsquare_array1;
+	goto square_array;		// jump to leaf procedure
+postsquare_array1:
+	v17 = 0;		// assign local variable
+	{		// Loop invariants
+	long long iv29;
+	long long ptr30;
+	iv29 = v17;		// Induction variable
+	Reg[0] = iv29 * 4;		// expression = operand1 op operand2
+	Reg[0] = (Reg[FP] - 80) + Reg[0];		// expression = operand1 op operand2
+	ptr30 = Reg[0];		// Address stepped by the loop
+	if (iv29 < 10) {
+	do {
+	Reg[0] = ptr30;		// operand
+	Reg[0] = MEM(int, Reg[0]);		// Get array operand
+	lv12 = Reg[0];		// Pass argument
+	ret11 = &&postputinteger2;
+	goto putinteger;		// jump to leaf procedure
+postputinteger2:
+	Reg[0] = (long long)&MEM(char, 0);		// operand
+	lv16 = Reg[0];		// Pass argument
+	ret15 = &&postputstring3;
+	goto putstring;		// jump to leaf procedure
+postputstring3:
+	Reg[0] = iv29 + 1;		// expression = operand1 op operand2
+	iv29 = Reg[0];		// assign local variable
+	ptr30 = ptr30 + 4;
+	} while (iv29 < 10);
+	}
+	v17 = iv29;
+	}
+	return 0;
+}
+
+long long static_data()
+{
+	strcpy(&MEM(char, 0), " ");
+	return 2;
+}
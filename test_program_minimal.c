@@ -0,0 +1,85 @@
+#include "runtime.h"
+
+long long static_data();
+
+int main() {
+	goto start;
+	void* ret1;		// Return address of getbool
+	bool lv2;		// getbool bb
+	long long lv2_address;
+getbool:
+	lv2 = getBool();
+	goto *ret1;
+	void* ret3;		// Return address of getinteger
+	int lv4;		// getinteger ii
+	long long lv4_address;
+getinteger:
+	lv4 = getInteger();
+	goto *ret3;
+	void* ret5;		// Return address of getfloat
+	double lv6;		// getfloat ff
+	long long lv6_address;
+getfloat:
+	lv6 = getFloat();
+	goto *ret5;
+	void* ret7;		// Return address of getstring
+	long long lv8;		// getstring ss
+	long long lv8_address;
+getstring:
+	lv8 = (long long)getString();
+	goto *ret7;
+	void* ret9;		// Return address of putbool
+	bool lv10;		// putbool b
+putbool:
+	putBool(lv10);
+	goto *ret9;
+	void* ret11;		// Return address of putinteger
+	int lv12;		// putinteger i
+putinteger:
+	putInteger(lv12);
+	goto *ret11;
+	void* ret13;		// Return address of putfloat
+	double lv14;		// putfloat f
+putfloat:
+	putFloat(lv14);
+	goto *ret13;
+	void* ret15;		// Return address of putstring
+	long long lv16;		// putstring s
+putstring:
+	putString((char*)lv16);
+	goto *ret15;
+	void* ret17;		// Return address of f
+	int lv18;		// f x
+	int lv19;		// f y
+	long long lv19_address;
+	int lv20;		// f b
+f:
+	lv20 = 3;		// assign local variable
+	lv19 = (long long)lv20;		// assign parameter
+	goto *ret17;		// Return from leaf
+start:
+	init(static_data());		// Static memory is only known once the whole program is parsed
+	Reg[SP] = Reg[FP] - 8;		// Allocate the frame
+	MEM(int, Reg[FP] - 8) = 3;		// assign local variable
+	Reg[0] = 3;		// operand
+	Reg[1] = (Reg[FP] - 8);		// operand
+	Reg[2] = MEM(int, Reg[1]);		// Value of out argument
+	lv19 = Reg[2];		// Pass argument
+	lv19_address = Reg[1];
+	lv18 = Reg[0];		// Pass argument
+	ret17 = &&postf1;
+	goto f;		// jump to leaf procedure
+postf1:
+	MEM(int, lv19_address) = lv19;		// Store out argument
+	Reg[0] = (long long)MEM(int, Reg[FP] - 8);		// operand
+	lv12 = Reg[0];		// Pass argument
+	ret11 = &&postputinteger2;
+	goto putinteger;		// jump to leaf procedure
+postputinteger2:
+	return 0;
+}
+
+long long static_data()
+{
+	return 0;
+}
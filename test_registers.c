@@ -0,0 +1,511 @@
+#include "runtime.h"
+
+long long static_data();
+
+int main() {
+	goto start;
+	void* ret1;		// Return address of getbool
+	bool lv2;		// getbool bb
+	long long lv2_address;
+getbool:
+	lv2 = getBool();
+	goto *ret1;
+	void* ret3;		// Return address of getinteger
+	int lv4;		// getinteger ii
+	long long lv4_address;
+getinteger:
+	lv4 = getInteger();
+	goto *ret3;
+	void* ret5;		// Return address of getfloat
+	double lv6;		// getfloat ff
+	long long lv6_address;
+getfloat:
+	lv6 = getFloat();
+	goto *ret5;
+	void* ret7;		// Return address of getstring
+	long long lv8;		// getstring ss
+	long long lv8_address;
+getstring:
+	lv8 = (long long)getString();
+	goto *ret7;
+	void* ret9;		// Return address of putbool
+	bool lv10;		// putbool b
+putbool:
+	putBool(lv10);
+	goto *ret9;
+	void* ret11;		// Return address of putinteger
+	int lv12;		// putinteger i
+putinteger:
+	putInteger(lv12);
+	goto *ret11;
+	void* ret13;		// Return address of putfloat
+	double lv14;		// putfloat f
+putfloat:
+	putFloat(lv14);
+	goto *ret13;
+	void* ret15;		// Return address of putstring
+	long long lv16;		// putstring s
+putstring:
+	putString((char*)lv16);
+	goto *ret15;
+	static int v17;		// a
+	static int v18;		// b
+	static int v19;		// c
+	static double v20;		// f
+wide:
+	Reg[0] = (long long)MEM(int, Reg[FP] + 16) + (long long)MEM(int, Reg[FP] + 24);		// expression = operand1 op operand2
+	Reg[0] = Reg[0] + (long long)MEM(int, Reg[FP] + 32);		// expression = operand1 op operand2
+	Reg[0] = Reg[0] + (long long)MEM(int, Reg[FP] + 40);		// expression = operand1 op operand2
+	Reg[0] = Reg[0] + (long long)MEM(int, Reg[FP] + 48);		// expression = operand1 op operand2
+	Reg[0] = Reg[0] + (long long)MEM(int, Reg[FP] + 56);		// expression = operand1 op operand2
+	Reg[0] = Reg[0] + (long long)MEM(int, Reg[FP] + 64);		// expression = operand1 op operand2
+	Reg[0] = Reg[0] + (long long)MEM(int, Reg[FP] + 72);		// expression = operand1 op operand2
+	Reg[0] = Reg[0] + (long long)MEM(int, Reg[FP] + 80);		// expression = operand1 op operand2
+	Reg[0] = Reg[0] + (long long)MEM(int, Reg[FP] + 88);		// expression = operand1 op operand2
+	Reg[0] = Reg[0] + (long long)MEM(int, Reg[FP] + 96);		// expression = operand1 op operand2
+	Reg[0] = Reg[0] + (long long)MEM(int, Reg[FP] + 104);		// expression = operand1 op operand2
+	Reg[0] = Reg[0] + (long long)MEM(int, Reg[FP] + 112);		// expression = operand1 op operand2
+	Reg[0] = Reg[0] + (long long)MEM(int, Reg[FP] + 120);		// expression = operand1 op operand2
+	Reg[0] = Reg[0] + (long long)MEM(int, Reg[FP] + 128);		// expression = operand1 op operand2
+	Reg[0] = Reg[0] + (long long)MEM(int, Reg[FP] + 136);		// expression = operand1 op operand2
+	Reg[0] = Reg[0] + (long long)MEM(int, Reg[FP] + 144);		// expression = operand1 op operand2
+	Reg[0] = Reg[0] + (long long)MEM(int, Reg[FP] + 152);		// expression = operand1 op operand2
+	Reg[0] = Reg[0] + (long long)MEM(int, Reg[FP] + 160);		// expression = operand1 op operand2
+	Reg[0] = Reg[0] + (long long)MEM(int, Reg[FP] + 168);		// expression = operand1 op operand2
+	Reg[0] = Reg[0] + (long long)MEM(int, Reg[FP] + 176);		// expression = operand1 op operand2
+	Reg[0] = Reg[0] + (long long)MEM(int, Reg[FP] + 184);		// expression = operand1 op operand2
+	Reg[0] = Reg[0] + (long long)MEM(int, Reg[FP] + 192);		// expression = operand1 op operand2
+	Reg[0] = Reg[0] + (long long)MEM(int, Reg[FP] + 200);		// expression = operand1 op operand2
+	Reg[0] = Reg[0] + (long long)MEM(int, Reg[FP] + 208);		// expression = operand1 op operand2
+	Reg[0] = Reg[0] + (long long)MEM(int, Reg[FP] + 216);		// expression = operand1 op operand2
+	MEM(int, Reg[FP] + 240) = Reg[0];		// assign parameter
+	*((double*)&Reg[0]) = MEM(double, Reg[FP] + 224);		// operand
+	lv14 = *((double*)&Reg[0]);		// Pass argument
+	ret13 = &&postputfloat1;
+	goto putfloat;		// jump to leaf procedure
+postputfloat1:
+	Reg[SP] = Reg[FP];		// Free local variables
+	Reg[FP] = MEM(long long, Reg[FP]);		// Restore Frame pointer
+	Reg[SP] = Reg[SP] + 8;		// Free space for FP
+	Reg[0] = MEM(long long, Reg[SP]);		// Pop return address off the stack
+	Reg[SP] = Reg[SP] + 8;		// Free return address space
+	goto *(void*)Reg[0];		// Return
+start:
+	init(static_data());		// Static memory is only known once the whole program is parsed
+	long long cse46;
+	double cse288;
+	double cse291;
+	double cse290;
+	double cse295;
+	double cse294;
+	double cse293;
+	double cse287;
+	double cse299;
+	double cse298;
+	double cse297;
+	double cse289;
+	Reg[SP] = Reg[FP] - 256;		// Allocate the frame
+	v17 = 2;		// assign local variable
+	v18 = 3;		// assign local variable
+	v19 = 5;		// assign local variable
+	v20 = 0.5;		// assign local variable
+	Reg[0] = (long long)v17 * (long long)v18;		// expression = operand1 op operand2
+	cse46 = Reg[0];		// Value used again
+	Reg[1] = cse46 + 1;		// expression = operand1 op operand2
+	Reg[1] = (long long)v17 * Reg[1];		// expression = operand1 op operand2
+	Reg[1] = (long long)v19 - Reg[1];		// expression = operand1 op operand2
+	Reg[0] = Reg[0] + Reg[1];		// expression = operand1 op operand2
+	Reg[0] = (long long)v17 * Reg[0];		// expression = operand1 op operand2
+	Reg[0] = (long long)v19 - Reg[0];		// expression = operand1 op operand2
+	Reg[1] = cse46;		// operand
+	Reg[0] = Reg[1] + Reg[0];		// expression = operand1 op operand2
+	Reg[0] = (long long)v17 * Reg[0];		// expression = operand1 op operand2
+	Reg[0] = (long long)v19 - Reg[0];		// expression = operand1 op operand2
+	Reg[1] = cse46;		// operand
+	Reg[0] = Reg[1] + Reg[0];		// expression = operand1 op operand2
+	Reg[0] = (long long)v17 * Reg[0];		// expression = operand1 op operand2
+	Reg[0] = (long long)v19 - Reg[0];		// expression = operand1 op operand2
+	Reg[1] = cse46;		// operand
+	Reg[0] = Reg[1] + Reg[0];		// expression = operand1 op operand2
+	Reg[0] = (long long)v17 * Reg[0];		// expression = operand1 op operand2
+	Reg[0] = (long long)v19 - Reg[0];		// expression = operand1 op operand2
+	Reg[1] = cse46;		// operand
+	Reg[0] = Reg[1] + Reg[0];		// expression = operand1 op operand2
+	Reg[0] = (long long)v17 * Reg[0];		// expression = operand1 op operand2
+	Reg[0] = (long long)v19 - Reg[0];		// expression = operand1 op operand2
+	Reg[1] = cse46;		// operand
+	Reg[0] = Reg[1] + Reg[0];		// expression = operand1 op operand2
+	Reg[0] = (long long)v17 * Reg[0];		// expression = operand1 op operand2
+	Reg[0] = (long long)v19 - Reg[0];		// expression = operand1 op operand2
+	Reg[1] = cse46;		// operand
+	Reg[0] = Reg[1] + Reg[0];		// expression = operand1 op operand2
+	Reg[0] = (long long)v17 * Reg[0];		// expression = operand1 op operand2
+	Reg[0] = (long long)v19 - Reg[0];		// expression = operand1 op operand2
+	Reg[1] = cse46;		// operand
+	Reg[0] = Reg[1] + Reg[0];		// expression = operand1 op operand2
+	Reg[0] = (long long)v17 * Reg[0];		// expression = operand1 op operand2
+	Reg[0] = (long long)v19 - Reg[0];		// expression = operand1 op operand2
+	Reg[1] = cse46;		// operand
+	Reg[0] = Reg[1] + Reg[0];		// expression = operand1 op operand2
+	Reg[0] = (long long)v17 * Reg[0];		// expression = operand1 op operand2
+	Reg[0] = (long long)v19 - Reg[0];		// expression = operand1 op operand2
+	Reg[1] = cse46;		// operand
+	Reg[0] = Reg[1] + Reg[0];		// expression = operand1 op operand2
+	Reg[0] = (long long)v17 * Reg[0];		// expression = operand1 op operand2
+	Reg[0] = (long long)v19 - Reg[0];		// expression = operand1 op operand2
+	Reg[1] = cse46;		// operand
+	Reg[0] = Reg[1] + Reg[0];		// expression = operand1 op operand2
+	Reg[0] = (long long)v17 * Reg[0];		// expression = operand1 op operand2
+	Reg[0] = (long long)v19 - Reg[0];		// expression = operand1 op operand2
+	Reg[1] = cse46;		// operand
+	Reg[0] = Reg[1] + Reg[0];		// expression = operand1 op operand2
+	Reg[0] = (long long)v17 * Reg[0];		// expression = operand1 op operand2
+	Reg[0] = (long long)v19 - Reg[0];		// expression = operand1 op operand2
+	Reg[1] = cse46;		// operand
+	Reg[0] = Reg[1] + Reg[0];		// expression = operand1 op operand2
+	Reg[0] = (long long)v17 * Reg[0];		// expression = operand1 op operand2
+	Reg[0] = (long long)v19 - Reg[0];		// expression = operand1 op operand2
+	Reg[1] = cse46;		// operand
+	Reg[0] = Reg[1] + Reg[0];		// expression = operand1 op operand2
+	Reg[0] = (long long)v17 * Reg[0];		// expression = operand1 op operand2
+	Reg[0] = (long long)v19 - Reg[0];		// expression = operand1 op operand2
+	Reg[1] = cse46;		// operand
+	Reg[0] = Reg[1] + Reg[0];		// expression = operand1 op operand2
+	Reg[0] = (long long)v17 * Reg[0];		// expression = operand1 op operand2
+	Reg[0] = (long long)v19 - Reg[0];		// expression = operand1 op operand2
+	Reg[1] = cse46;		// operand
+	Reg[0] = Reg[1] + Reg[0];		// expression = operand1 op operand2
+	Reg[0] = (long long)v17 * Reg[0];		// expression = operand1 op operand2
+	Reg[0] = (long long)v19 - Reg[0];		// expression = operand1 op operand2
+	Reg[1] = cse46;		// operand
+	Reg[0] = Reg[1] + Reg[0];		// expression = operand1 op operand2
+	Reg[0] = (long long)v17 * Reg[0];		// expression = operand1 op operand2
+	Reg[0] = (long long)v19 - Reg[0];		// expression = operand1 op operand2
+	Reg[1] = cse46;		// operand
+	Reg[0] = Reg[1] + Reg[0];		// expression = operand1 op operand2
+	Reg[0] = (long long)v17 * Reg[0];		// expression = operand1 op operand2
+	Reg[0] = (long long)v19 - Reg[0];		// expression = operand1 op operand2
+	Reg[1] = cse46;		// operand
+	Reg[0] = Reg[1] + Reg[0];		// expression = operand1 op operand2
+	Reg[0] = (long long)v17 * Reg[0];		// expression = operand1 op operand2
+	Reg[0] = (long long)v19 - Reg[0];		// expression = operand1 op operand2
+	MEM(int, Reg[FP] - 8) = Reg[0];		// assign local variable
+	Reg[0] = (long long)MEM(int, Reg[FP] - 8);		// operand
+	lv12 = Reg[0];		// Pass argument
+	ret11 = &&postputinteger2;
+	goto putinteger;		// jump to leaf procedure
+postputinteger2:
+	Reg[0] = (long long)v17 * (long long)v18;		// expression = operand1 op operand2
+	Reg[1] = (long long)v19 - 4;		// expression = operand1 op operand2
+	Reg[1] = (long long)v18 - Reg[1];		// expression = operand1 op operand2
+	Reg[1] = (long long)v17 - Reg[1];		// expression = operand1 op operand2
+	Reg[1] = (long long)v19 - Reg[1];		// expression = operand1 op operand2
+	Reg[0] = Reg[0] - Reg[1];		// expression = operand1 op operand2
+	Reg[0] = Reg[0] * 4;		// expression = operand1 op operand2
+	Reg[0] = (Reg[FP] - 24) + Reg[0];		// expression = operand1 op operand2
+	Reg[1] = (long long)v17 + (long long)v19;		// expression = operand1 op operand2
+	Reg[2] = (long long)v19 - (long long)v17;		// expression = operand1 op operand2
+	Reg[2] = (long long)v18 - Reg[2];		// expression = operand1 op operand2
+	Reg[1] = Reg[1] * Reg[2];		// expression = operand1 op operand2
+	Reg[2] = (long long)v17 + (long long)v18;		// expression = operand1 op operand2
+	Reg[2] = (long long)v19 * Reg[2];		// expression = operand1 op operand2
+	Reg[2] = (long long)v18 * Reg[2];		// expression = operand1 op operand2
+	Reg[2] = (long long)v17 * Reg[2];		// expression = operand1 op operand2
+	Reg[1] = Reg[2] + Reg[1];		// expression = operand1 op operand2
+	MEM(int, Reg[0]) = Reg[1];		// v + offset = expression
+	Reg[0] = 1 * 4;		// expression = operand1 op operand2
+	Reg[0] = (Reg[FP] - 24) + Reg[0];		// expression = operand1 op operand2
+	Reg[0] = MEM(int, Reg[0]);		// Get array operand
+	lv12 = Reg[0];		// Pass argument
+	ret11 = &&postputinteger3;
+	goto putinteger;		// jump to leaf procedure
+postputinteger3:
+	Reg[0] = (long long)v19 - (long long)v17;		// expression = operand1 op operand2
+	Reg[1] = (long long)v17 * (long long)v19;		// expression = operand1 op operand2
+	Reg[1] = (long long)v18 + Reg[1];		// expression = operand1 op operand2
+	Reg[0] = Reg[0] * Reg[1];		// expression = operand1 op operand2
+	Reg[1] = (long long)v17 + (long long)v18;		// expression = operand1 op operand2
+	Reg[1] = (long long)v19 * Reg[1];		// expression = operand1 op operand2
+	Reg[1] = (long long)v18 + Reg[1];		// expression = operand1 op operand2
+	Reg[1] = (long long)v17 * Reg[1];		// expression = operand1 op operand2
+	if (!(Reg[1] > Reg[0])) goto else4;
+	Reg[0] = (long long)&MEM(char, 0);		// operand
+	lv16 = Reg[0];		// Pass argument
+	ret15 = &&postputstring5;
+	goto putstring;		// jump to leaf procedure
+postputstring5:
+else4:
+	Reg[0] = (long long)v17 + 0;		// expression = operand1 op operand2
+	Reg[1] = (long long)v17 + 1;		// expression = operand1 op operand2
+	Reg[2] = (long long)v17 + 2;		// expression = operand1 op operand2
+	Reg[3] = (long long)v17 + 3;		// expression = operand1 op operand2
+	Reg[4] = (long long)v17 + 4;		// expression = operand1 op operand2
+	Reg[5] = (long long)v17 + 5;		// expression = operand1 op operand2
+	Reg[6] = (long long)v17 + 6;		// expression = operand1 op operand2
+	Reg[7] = (long long)v17 + 7;		// expression = operand1 op operand2
+	Reg[8] = (long long)v17 + 8;		// expression = operand1 op operand2
+	Reg[9] = (long long)v17 + 9;		// expression = operand1 op operand2
+	Reg[10] = (long long)v17 + 10;		// expression = operand1 op operand2
+	Reg[11] = (long long)v17 + 11;		// expression = operand1 op operand2
+	Reg[12] = (long long)v17 + 12;		// expression = operand1 op operand2
+	Reg[13] = (long long)v17 + 13;		// expression = operand1 op operand2
+	Reg[14] = (long long)v17 + 14;		// expression = operand1 op operand2
+	Reg[15] = (long long)v17 + 15;		// expression = operand1 op operand2
+	Reg[16] = (long long)v17 + 16;		// expression = operand1 op operand2
+	Reg[17] = (long long)v17 + 17;		// expression = operand1 op operand2
+	Reg[18] = (long long)v17 + 18;		// expression = operand1 op operand2
+	Reg[19] = (long long)v17 + 19;		// expression = operand1 op operand2
+	Reg[20] = (long long)v17 + 20;		// expression = operand1 op operand2
+	Reg[21] = (long long)v17 + 21;		// expression = operand1 op operand2
+	Reg[22] = (long long)v17 + 22;		// expression = operand1 op operand2
+	Reg[23] = (long long)v17 + 23;		// expression = operand1 op operand2
+	Reg[24] = (long long)v17 + 24;		// expression = operand1 op operand2
+	Reg[SP] = Reg[SP] - 8;
+	MEM(long long, Reg[SP]) = Reg[24];		// Pass argument on the stack, registers are full
+	Reg[24] = (long long)v17 - 1;		// expression = operand1 op operand2
+	Reg[25] = (long long)v18 + 2;		// expression = operand1 op operand2
+	Reg[24] = Reg[24] + Reg[25];		// expression = operand1 op operand2
+	Reg[25] = (long long)v19 * 3;		// expression = operand1 op operand2
+	Reg[26] = (long long)v17 - 4;		// expression = operand1 op operand2
+	Reg[25] = Reg[25] - Reg[26];		// expression = operand1 op operand2
+	Reg[24] = Reg[24] - Reg[25];		// expression = operand1 op operand2
+	Reg[25] = (long long)v18 + 5;		// expression = operand1 op operand2
+	Reg[26] = (long long)v19 * 6;		// expression = operand1 op operand2
+	Reg[25] = Reg[25] + Reg[26];		// expression = operand1 op operand2
+	Reg[26] = (long long)v17 - 7;		// expression = operand1 op operand2
+	Reg[27] = (long long)v18 + 8;		// expression = operand1 op operand2
+	Reg[26] = Reg[26] - Reg[27];		// expression = operand1 op operand2
+	Reg[25] = Reg[25] + Reg[26];		// expression = operand1 op operand2
+	Reg[24] = Reg[24] + Reg[25];		// expression = operand1 op operand2
+	Reg[25] = (long long)v19 * 9;		// expression = operand1 op operand2
+	Reg[26] = (long long)v17 - 10;		// expression = operand1 op operand2
+	Reg[25] = Reg[25] + Reg[26];		// expression = operand1 op operand2
+	Reg[26] = (long long)v18 + 11;		// expression = operand1 op operand2
+	Reg[27] = (long long)v19 * 12;		// expression = operand1 op operand2
+	Reg[26] = Reg[26] - Reg[27];		// expression = operand1 op operand2
+	Reg[25] = Reg[25] - Reg[26];		// expression = operand1 op operand2
+	Reg[26] = (long long)v17 - 13;		// expression = operand1 op operand2
+	Reg[27] = (long long)v18 + 14;		// expression = operand1 op operand2
+	Reg[26] = Reg[26] + Reg[27];		// expression = operand1 op operand2
+	Reg[27] = (long long)v19 * 15;		// expression = operand1 op operand2
+	Reg[28] = (long long)v17 - 16;		// expression = operand1 op operand2
+	Reg[27] = Reg[27] - Reg[28];		// expression = operand1 op operand2
+	Reg[26] = Reg[26] + Reg[27];		// expression = operand1 op operand2
+	Reg[25] = Reg[25] - Reg[26];		// expression = operand1 op operand2
+	Reg[24] = Reg[24] - Reg[25];		// expression = operand1 op operand2
+	Reg[25] = (long long)v18 + 17;		// expression = operand1 op operand2
+	Reg[26] = (long long)v19 * 18;		// expression = operand1 op operand2
+	Reg[25] = Reg[25] + Reg[26];		// expression = operand1 op operand2
+	Reg[26] = (long long)v17 - 19;		// expression = operand1 op operand2
+	Reg[27] = (long long)v18 + 20;		// expression = operand1 op operand2
+	Reg[26] = Reg[26] - Reg[27];		// expression = operand1 op operand2
+	Reg[25] = Reg[25] - Reg[26];		// expression = operand1 op operand2
+	Reg[26] = (long long)v19 * 21;		// expression = operand1 op operand2
+	Reg[27] = (long long)v17 - 22;		// expression = operand1 op operand2
+	Reg[26] = Reg[26] + Reg[27];		// expression = operand1 op operand2
+	Reg[27] = (long long)v18 + 23;		// expression = operand1 op operand2
+	Reg[28] = (long long)v19 * 24;		// expression = operand1 op operand2
+	Reg[27] = Reg[27] - Reg[28];		// expression = operand1 op operand2
+	Reg[26] = Reg[26] + Reg[27];		// expression = operand1 op operand2
+	Reg[25] = Reg[25] + Reg[26];		// expression = operand1 op operand2
+	Reg[26] = (long long)v17 - 25;		// expression = operand1 op operand2
+	Reg[27] = (long long)v18 + 26;		// expression = operand1 op operand2
+	Reg[26] = Reg[26] + Reg[27];		// expression = operand1 op operand2
+	Reg[27] = (long long)v19 * 27;		// expression = operand1 op operand2
+	Reg[28] = (long long)v17 - 28;		// expression = operand1 op operand2
+	Reg[27] = Reg[27] - Reg[28];		// expression = operand1 op operand2
+	Reg[26] = Reg[26] - Reg[27];		// expression = operand1 op operand2
+	Reg[27] = (long long)v18 + 29;		// expression = operand1 op operand2
+	Reg[28] = (long long)v19 * 30;		// expression = operand1 op operand2
+	Reg[27] = Reg[27] + Reg[28];		// expression = operand1 op operand2
+	Reg[28] = (long long)v17 - 31;		// expression = operand1 op operand2
+	Reg[29] = (long long)v18 + 32;		// expression = operand1 op operand2
+	Reg[28] = Reg[28] - Reg[29];		// expression = operand1 op operand2
+	Reg[27] = Reg[27] + Reg[28];		// expression = operand1 op operand2
+	Reg[26] = Reg[26] - Reg[27];		// expression = operand1 op operand2
+	Reg[25] = Reg[25] + Reg[26];		// expression = operand1 op operand2
+	Reg[24] = Reg[24] + Reg[25];		// expression = operand1 op operand2
+	Reg[SP] = Reg[SP] - 8;
+	MEM(long long, Reg[SP]) = Reg[24];		// Spill operand, registers are full
+	Reg[24] = (long long)v19 * 33;		// expression = operand1 op operand2
+	Reg[25] = (long long)v17 - 34;		// expression = operand1 op operand2
+	Reg[24] = Reg[24] + Reg[25];		// expression = operand1 op operand2
+	Reg[25] = (long long)v18 + 35;		// expression = operand1 op operand2
+	Reg[26] = (long long)v19 * 36;		// expression = operand1 op operand2
+	Reg[25] = Reg[25] - Reg[26];		// expression = operand1 op operand2
+	Reg[24] = Reg[24] - Reg[25];		// expression = operand1 op operand2
+	Reg[25] = (long long)v17 - 37;		// expression = operand1 op operand2
+	Reg[26] = (long long)v18 + 38;		// expression = operand1 op operand2
+	Reg[25] = Reg[25] + Reg[26];		// expression = operand1 op operand2
+	Reg[26] = (long long)v19 * 39;		// expression = operand1 op operand2
+	Reg[27] = (long long)v17 - 40;		// expression = operand1 op operand2
+	Reg[26] = Reg[26] - Reg[27];		// expression = operand1 op operand2
+	Reg[25] = Reg[25] + Reg[26];		// expression = operand1 op operand2
+	Reg[24] = Reg[24] + Reg[25];		// expression = operand1 op operand2
+	Reg[25] = (long long)v18 + 41;		// expression = operand1 op operand2
+	Reg[26] = (long long)v19 * 42;		// expression = operand1 op operand2
+	Reg[25] = Reg[25] + Reg[26];		// expression = operand1 op operand2
+	Reg[26] = (long long)v17 - 43;		// expression = operand1 op operand2
+	Reg[27] = (long long)v18 + 44;		// expression = operand1 op operand2
+	Reg[26] = Reg[26] - Reg[27];		// expression = operand1 op operand2
+	Reg[25] = Reg[25] - Reg[26];		// expression = operand1 op operand2
+	Reg[26] = (long long)v19 * 45;		// expression = operand1 op operand2
+	Reg[27] = (long long)v17 - 46;		// expression = operand1 op operand2
+	Reg[26] = Reg[26] + Reg[27];		// expression = operand1 op operand2
+	Reg[27] = (long long)v18 + 47;		// expression = operand1 op operand2
+	Reg[28] = (long long)v19 * 48;		// expression = operand1 op operand2
+	Reg[27] = Reg[27] - Reg[28];		// expression = operand1 op operand2
+	Reg[26] = Reg[26] + Reg[27];		// expression = operand1 op operand2
+	Reg[25] = Reg[25] - Reg[26];		// expression = operand1 op operand2
+	Reg[24] = Reg[24] - Reg[25];		// expression = operand1 op operand2
+	Reg[25] = (long long)v17 - 49;		// expression = operand1 op operand2
+	Reg[26] = (long long)v18 + 50;		// expression = operand1 op operand2
+	Reg[25] = Reg[25] + Reg[26];		// expression = operand1 op operand2
+	Reg[26] = (long long)v19 * 51;		// expression = operand1 op operand2
+	Reg[27] = (long long)v17 - 52;		// expression = operand1 op operand2
+	Reg[26] = Reg[26] - Reg[27];		// expression = operand1 op operand2
+	Reg[25] = Reg[25] - Reg[26];		// expression = operand1 op operand2
+	Reg[26] = (long long)v18 + 53;		// expression = operand1 op operand2
+	Reg[27] = (long long)v19 * 54;		// expression = operand1 op operand2
+	Reg[26] = Reg[26] + Reg[27];		// expression = operand1 op operand2
+	Reg[27] = (long long)v17 - 55;		// expression = operand1 op operand2
+	Reg[28] = (long long)v18 + 56;		// expression = operand1 op operand2
+	Reg[27] = Reg[27] - Reg[28];		// expression = operand1 op operand2
+	Reg[26] = Reg[26] + Reg[27];		// expression = operand1 op operand2
+	Reg[25] = Reg[25] + Reg[26];		// expression = operand1 op operand2
+	Reg[26] = (long long)v19 * 57;		// expression = operand1 op operand2
+	Reg[27] = (long long)v17 - 58;		// expression = operand1 op operand2
+	Reg[26] = Reg[26] + Reg[27];		// expression = operand1 op operand2
+	Reg[27] = (long long)v18 + 59;		// expression = operand1 op operand2
+	Reg[28] = (long long)v19 * 60;		// expression = operand1 op operand2
+	Reg[27] = Reg[27] - Reg[28];		// expression = operand1 op operand2
+	Reg[26] = Reg[26] - Reg[27];		// expression = operand1 op operand2
+	Reg[27] = (long long)v17 - 61;		// expression = operand1 op operand2
+	Reg[28] = (long long)v18 + 62;		// expression = operand1 op operand2
+	Reg[27] = Reg[27] + Reg[28];		// expression = operand1 op operand2
+	Reg[28] = (long long)v19 * 63;		// expression = operand1 op operand2
+	Reg[29] = (long long)v17 - 64;		// expression = operand1 op operand2
+	Reg[28] = Reg[28] - Reg[29];		// expression = operand1 op operand2
+	Reg[27] = Reg[27] + Reg[28];		// expression = operand1 op operand2
+	Reg[26] = Reg[26] - Reg[27];		// expression = operand1 op operand2
+	Reg[25] = Reg[25] + Reg[26];		// expression = operand1 op operand2
+	Reg[24] = Reg[24] - Reg[25];		// expression = operand1 op operand2
+	Reg[24] = MEM(long long, Reg[SP]) - Reg[24];		// expression = operand1 op operand2
+	Reg[SP] = Reg[SP] + 8;		// Free spilled operand
+	Reg[SP] = Reg[SP] - 8;
+	MEM(long long, Reg[SP]) = Reg[24];		// Pass argument on the stack, registers are full
+	*((double*)&Reg[24]) = v20 + 1.5;		// expression = operand1 op operand2
+	cse287 = *((double*)&Reg[24]);		// Value used again
+	*((double*)&Reg[25]) = v20 * 0.5;		// expression = operand1 op operand2
+	cse288 = *((double*)&Reg[25]);		// Value used again
+	*((double*)&Reg[24]) = *((double*)&Reg[24]) + *((double*)&Reg[25]);		// expression = operand1 op operand2
+	cse289 = *((double*)&Reg[24]);		// Value used again
+	*((double*)&Reg[25]) = v20 - 0.25;		// expression = operand1 op operand2
+	cse290 = *((double*)&Reg[25]);		// Value used again
+	*((double*)&Reg[25]) = cse288 + *((double*)&Reg[25]);		// expression = operand1 op operand2
+	cse291 = *((double*)&Reg[25]);		// Value used again
+	*((double*)&Reg[24]) = *((double*)&Reg[24]) * *((double*)&Reg[25]);		// expression = operand1 op operand2
+	*((double*)&Reg[25]) = 0.75 + v20;		// expression = operand1 op operand2
+	cse293 = *((double*)&Reg[25]);		// Value used again
+	*((double*)&Reg[25]) = cse290 + *((double*)&Reg[25]);		// expression = operand1 op operand2
+	cse294 = *((double*)&Reg[25]);		// Value used again
+	*((double*)&Reg[25]) = cse291 * *((double*)&Reg[25]);		// expression = operand1 op operand2
+	cse295 = *((double*)&Reg[25]);		// Value used again
+	*((double*)&Reg[24]) = *((double*)&Reg[24]) + *((double*)&Reg[25]);		// expression = operand1 op operand2
+	*((double*)&Reg[25]) = cse293 + cse287;		// expression = operand1 op operand2
+	cse297 = *((double*)&Reg[25]);		// Value used again
+	*((double*)&Reg[25]) = cse294 * *((double*)&Reg[25]);		// expression = operand1 op operand2
+	cse298 = *((double*)&Reg[25]);		// Value used again
+	*((double*)&Reg[25]) = cse295 + *((double*)&Reg[25]);		// expression = operand1 op operand2
+	cse299 = *((double*)&Reg[25]);		// Value used again
+	*((double*)&Reg[24]) = *((double*)&Reg[24]) * *((double*)&Reg[25]);		// expression = operand1 op operand2
+	*((double*)&Reg[25]) = cse297 * cse289;		// expression = operand1 op operand2
+	*((double*)&Reg[25]) = cse298 + *((double*)&Reg[25]);		// expression = operand1 op operand2
+	*((double*)&Reg[25]) = cse299 * *((double*)&Reg[25]);		// expression = operand1 op operand2
+	*((double*)&Reg[24]) = *((double*)&Reg[24]) + *((double*)&Reg[25]);		// expression = operand1 op operand2
+	Reg[SP] = Reg[SP] - 8;
+	MEM(long long, Reg[SP]) = Reg[24];		// Pass argument on the stack, registers are full
+	Reg[24] = (Reg[FP] - 8);		// operand
+	Reg[25] = MEM(int, Reg[24]);		// Value of out argument
+	Reg[SP] = Reg[SP] - 8;
+	MEM(long long, Reg[SP]) = Reg[24];		// Pass argument on the stack, registers are full
+	Reg[SP] = Reg[SP] - 8;
+	MEM(long long, Reg[SP]) = Reg[25];		// Pass argument on the stack, registers are full
+	Reg[24] = Reg[SP];		// Arguments passed on the stack
+	MEM(int, Reg[FP] - 32) = Reg[0];		// Move argument into inlined frame
+	MEM(int, Reg[FP] - 40) = Reg[1];		// Move argument into inlined frame
+	MEM(int, Reg[FP] - 48) = Reg[2];		// Move argument into inlined frame
+	MEM(int, Reg[FP] - 56) = Reg[3];		// Move argument into inlined frame
+	MEM(int, Reg[FP] - 64) = Reg[4];		// Move argument into inlined frame
+	MEM(int, Reg[FP] - 72) = Reg[5];		// Move argument into inlined frame
+	MEM(int, Reg[FP] - 80) = Reg[6];		// Move argument into inlined frame
+	MEM(int, Reg[FP] - 88) = Reg[7];		// Move argument into inlined frame
+	MEM(int, Reg[FP] - 96) = Reg[8];		// Move argument into inlined frame
+	MEM(int, Reg[FP] - 104) = Reg[9];		// Move argument into inlined frame
+	MEM(int, Reg[FP] - 112) = Reg[10];		// Move argument into inlined frame
+	MEM(int, Reg[FP] - 120) = Reg[11];		// Move argument into inlined frame
+	MEM(int, Reg[FP] - 128) = Reg[12];		// Move argument into inlined frame
+	MEM(int, Reg[FP] - 136) = Reg[13];		// Move argument into inlined frame
+	MEM(int, Reg[FP] - 144) = Reg[14];		// Move argument into inlined frame
+	MEM(int, Reg[FP] - 152) = Reg[15];		// Move argument into inlined frame
+	MEM(int, Reg[FP] - 160) = Reg[16];		// Move argument into inlined frame
+	MEM(int, Reg[FP] - 168) = Reg[17];		// Move argument into inlined frame
+	MEM(int, Reg[FP] - 176) = Reg[18];		// Move argument into inlined frame
+	MEM(int, Reg[FP] - 184) = Reg[19];		// Move argument into inlined frame
+	MEM(int, Reg[FP] - 192) = Reg[20];		// Move argument into inlined frame
+	MEM(int, Reg[FP] - 200) = Reg[21];		// Move argument into inlined frame
+	MEM(int, Reg[FP] - 208) = Reg[22];		// Move argument into inlined frame
+	MEM(int, Reg[FP] - 216) = Reg[23];		// Move argument into inlined frame
+	MEM(int, Reg[FP] - 224) = MEM(long long, Reg[24] + 32);		// Move argument into inlined frame
+	MEM(int, Reg[FP] - 232) = MEM(long long, Reg[24] + 24);		// Move argument into inlined frame
+	MEM(double, Reg[FP] - 240) = MEM(double, Reg[24] + 16);		// Move argument into inlined frame
+	MEM(long long, Reg[FP] - 248) = MEM(long long, Reg[24] + 8);		// Move argument into inlined frame
+	MEM(int, Reg[FP] - 256) = MEM(long long, Reg[24] + 0);		// Move argument into inlined frame
+	Reg[SP] = Reg[SP] + 40;		// Free arguments passed on the stack
+	Reg[0] = (long long)MEM(int, Reg[FP] - 32) + (long long)MEM(int, Reg[FP] - 40);		// expression = operand1 op operand2
+	Reg[0] = Reg[0] + (long long)MEM(int, Reg[FP] - 48);		// expression = operand1 op operand2
+	Reg[0] = Reg[0] + (long long)MEM(int, Reg[FP] - 56);		// expression = operand1 op operand2
+	Reg[0] = Reg[0] + (long long)MEM(int, Reg[FP] - 64);		// expression = operand1 op operand2
+	Reg[0] = Reg[0] + (long long)MEM(int, Reg[FP] - 72);		// expression = operand1 op operand2
+	Reg[0] = Reg[0] + (long long)MEM(int, Reg[FP] - 80);		// expression = operand1 op operand2
+	Reg[0] = Reg[0] + (long long)MEM(int, Reg[FP] - 88);		// expression = operand1 op operand2
+	Reg[0] = Reg[0] + (long long)MEM(int, Reg[FP] - 96);		// expression = operand1 op operand2
+	Reg[0] = Reg[0] + (long long)MEM(int, Reg[FP] - 104);		// expression = operand1 op operand2
+	Reg[0] = Reg[0] + (long long)MEM(int, Reg[FP] - 112);		// expression = operand1 op operand2
+	Reg[0] = Reg[0] + (long long)MEM(int, Reg[FP] - 120);		// expression = operand1 op operand2
+	Reg[0] = Reg[0] + (long long)MEM(int, Reg[FP] - 128);		// expression = operand1 op operand2
+	Reg[0] = Reg[0] + (long long)MEM(int, Reg[FP] - 136);		// expression = operand1 op operand2
+	Reg[0] = Reg[0] + (long long)MEM(int, Reg[FP] - 144);		// expression = operand1 op operand2
+	Reg[0] = Reg[0] + (long long)MEM(int, Reg[FP] - 152);		// expression = operand1 op operand2
+	Reg[0] = Reg[0] + (long long)MEM(int, Reg[FP] - 160);		// expression = operand1 op operand2
+	Reg[0] = Reg[0] + (long long)MEM(int, Reg[FP] - 168);		// expression = operand1 op operand2
+	Reg[0] = Reg[0] + (long long)MEM(int, Reg[FP] - 176);		// expression = operand1 op operand2
+	Reg[0] = Reg[0] + (long long)MEM(int, Reg[FP] - 184);		// expression = operand1 op operand2
+	Reg[0] = Reg[0] + (long long)MEM(int, Reg[FP] - 192);		// expression = operand1 op operand2
+	Reg[0] = Reg[0] + (long long)MEM(int, Reg[FP] - 200);		// expression = operand1 op operand2
+	Reg[0] = Reg[0] + (long long)MEM(int, Reg[FP] - 208);		// expression = operand1 op operand2
+	Reg[0] = Reg[0] + (long long)MEM(int, Reg[FP] - 216);		// expression = operand1 op operand2
+	Reg[0] = Reg[0] + (long long)MEM(int, Reg[FP] - 224);		// expression = operand1 op operand2
+	Reg[0] = Reg[0] + (long long)MEM(int, Reg[FP] - 232);		// expression = operand1 op operand2
+	MEM(int, Reg[FP] - 256) = Reg[0];		// assign local variable
+	*((double*)&Reg[0]) = MEM(double, Reg[FP] - 240);		// operand
+	lv14 = *((double*)&Reg[0]);		// Pass argument
+	ret13 = &&postputfloat7;
+	goto putfloat;		// jump to leaf procedure
+postputfloat7:
+postinline6:
+	Reg[0] = MEM(long long, Reg[FP] - 248);		// Get address of out param
+	MEM(int, Reg[0]) = MEM(int, Reg[FP] - 256);		// Copy out param
+	Reg[0] = (long long)MEM(int, Reg[FP] - 8);		// operand
+	lv12 = Reg[0];		// Pass argument
+	ret11 = &&postputinteger8;
+	goto putinteger;		// jump to leaf procedure
+postputinteger8:
+	return 0;
+}
+
+long long static_data()
+{
+	strcpy(&MEM(char, 0), "gt");
+	return 3;
+}
@@ -0,0 +1,172 @@
+#include "runtime.h"
+
+long long static_data();
+
+int main() {
+	goto start;
+	void* ret1;		// Return address of getbool
+	bool lv2;		// getbool bb
+	long long lv2_address;
+getbool:
+	lv2 = getBool();
+	goto *ret1;
+	void* ret3;		// Return address of getinteger
+	int lv4;		// getinteger ii
+	long long lv4_address;
+getinteger:
+	lv4 = getInteger();
+	goto *ret3;
+	void* ret5;		// Return address of getfloat
+	double lv6;		// getfloat ff
+	long long lv6_address;
+getfloat:
+	lv6 = getFloat();
+	goto *ret5;
+	void* ret7;		// Return address of getstring
+	long long lv8;		// getstring ss
+	long long lv8_address;
+getstring:
+	lv8 = (long long)getString();
+	goto *ret7;
+	void* ret9;		// Return address of putbool
+	bool lv10;		// putbool b
+putbool:
+	putBool(lv10);
+	goto *ret9;
+	void* ret11;		// Return address of putinteger
+	int lv12;		// putinteger i
+putinteger:
+	putInteger(lv12);
+	goto *ret11;
+	void* ret13;		// Return address of putfloat
+	double lv14;		// putfloat f
+putfloat:
+	putFloat(lv14);
+	goto *ret13;
+	void* ret15;		// Return address of putstring
+	long long lv16;		// putstring s
+putstring:
+	putString((char*)lv16);
+	goto *ret15;
+	static int v17;		// i
+	static int v18;		// j
+	static int v19;		// k
+	static int v20;		// total
+	void* ret21;		// Return address of bump
+	int lv22;		// bump x
+	long long lv22_address;
+bump:
+	Reg[0] = (long long)lv22 + 100;		// expression = operand1 op operand2
+	lv22 = Reg[0];		// assign parameter
+	goto *ret21;		// Return from leaf
+start:
+	init(static_data());		// Static memory is only known once the whole program is parsed
+	long long cse34;
+	long long cse30;
+	long long cse38;
+	long long cse37;
+	long long cse46;
+	long long cse51;
+	Reg[SP] = Reg[FP] - 32;		// Allocate the frame
+	v17 = 0;		// assign local variable
+	{		// Loop invariants
+	long long iv24;
+	long long ptr25;
+	iv24 = v17;		// Induction variable
+	Reg[0] = iv24 * 4;		// expression = operand1 op operand2
+	Reg[0] = (Reg[FP] - 32) + Reg[0];		// expression = operand1 op operand2
+	ptr25 = Reg[0];		// Address stepped by the loop
+	if (iv24 < 8) {
+	do {
+	Reg[0] = iv24 * 3;		// expression = operand1 op operand2
+	MEM(int, ptr25) = Reg[0];		// a + offset = expression
+	Reg[0] = iv24 + 1;		// expression = operand1 op operand2
+	iv24 = Reg[0];		// assign local variable
+	ptr25 = ptr25 + 4;
+	} while (iv24 < 8);
+	}
+	v17 = iv24;
+	}
+	v20 = 0;		// assign local variable
+	v18 = 2;		// assign local variable
+	Reg[0] = (long long)v18 * 4;		// expression = operand1 op operand2
+	Reg[0] = (Reg[FP] - 32) + Reg[0];		// expression = operand1 op operand2
+	Reg[0] = MEM(int, Reg[0]);		// Get array operand
+	Reg[1] = (long long)v18 + 1;		// expression = operand1 op operand2
+	cse30 = Reg[1];		// Value used again
+	Reg[1] = Reg[1] * 4;		// expression = operand1 op operand2
+	Reg[1] = (Reg[FP] - 32) + Reg[1];		// expression = operand1 op operand2
+	Reg[1] = MEM(int, Reg[1]);		// Get array operand
+	Reg[0] = Reg[0] + Reg[1];		// expression = operand1 op operand2
+	cse34 = Reg[0];		// Value used again
+	if (!(Reg[0] > 10)) goto else1;
+	v20 = cse34;		// assign local variable
+	v18 = cse30;		// assign local variable
+	goto next2;
+else1:
+	Reg[0] = 0 - cse34;		// expression = operand1 op operand2
+	v20 = Reg[0];		// assign local variable
+next2:
+	Reg[0] = (long long)v18 * 4;		// expression = operand1 op operand2
+	Reg[0] = (Reg[FP] - 32) + Reg[0];		// expression = operand1 op operand2
+	cse37 = Reg[0];		// Value used again
+	Reg[0] = MEM(int, Reg[0]);		// Get array operand
+	cse38 = Reg[0];		// Value used again
+	Reg[1] = (long long)v18 + 1;		// expression = operand1 op operand2
+	Reg[1] = Reg[1] * 4;		// expression = operand1 op operand2
+	Reg[1] = (Reg[FP] - 32) + Reg[1];		// expression = operand1 op operand2
+	Reg[1] = MEM(int, Reg[1]);		// Get array operand
+	Reg[0] = Reg[0] + Reg[1];		// expression = operand1 op operand2
+	Reg[0] = (long long)v20 + Reg[0];		// expression = operand1 op operand2
+	v20 = Reg[0];		// assign local variable
+	Reg[0] = cse38 * 2;		// expression = operand1 op operand2
+	MEM(int, cse37) = Reg[0];		// a + offset = expression
+	Reg[0] = cse37;		// operand
+	Reg[0] = MEM(int, Reg[0]);		// Get array operand
+	cse46 = Reg[0];		// Value used again
+	Reg[0] = (long long)v20 + Reg[0];		// expression = operand1 op operand2
+	v20 = Reg[0];		// assign local variable
+	Reg[0] = cse37;		// operand
+	Reg[1] = cse46;		// Value of out argument
+	lv22 = Reg[1];		// Pass argument
+	lv22_address = Reg[0];
+	ret21 = &&postbump3;
+	goto bump;		// jump to leaf procedure
+postbump3:
+	MEM(int, lv22_address) = lv22;		// Store out argument
+	Reg[0] = (long long)v18 * 4;		// expression = operand1 op operand2
+	Reg[0] = (Reg[FP] - 32) + Reg[0];		// expression = operand1 op operand2
+	Reg[0] = MEM(int, Reg[0]);		// Get array operand
+	cse51 = Reg[0];		// Value used again
+	Reg[0] = (long long)v20 + Reg[0];		// expression = operand1 op operand2
+	v20 = Reg[0];		// assign local variable
+	Reg[0] = cse51 * cse51;		// expression = operand1 op operand2
+	v19 = Reg[0];		// assign local variable
+	Reg[0] = (long long)v20;		// operand
+	lv12 = Reg[0];		// Pass argument
+	ret11 = &&postputinteger4;
+	goto putinteger;		// jump to leaf procedure
+postputinteger4:
+	Reg[0] = (long long)&MEM(char, 0);		// operand
+	lv16 = Reg[0];		// Pass argument
+	ret15 = &&postputstring5;
+	goto putstring;		// jump to leaf procedure
+postputstring5:
+	Reg[0] = (long long)v19;		// operand
+	lv12 = Reg[0];		// Pass argument
+	ret11 = &&postputinteger6;
+	goto putinteger;		// jump to leaf procedure
+postputinteger6:
+	Reg[0] = (long long)&MEM(char, 0);		// operand
+	lv16 = Reg[0];		// Pass argument
+	ret15 = &&postputstring7;
+	goto putstring;		// jump to leaf procedure
+postputstring7:
+	return 0;
+}
+
+long long static_data()
+{
+	strcpy(&MEM(char, 0), "\n");
+	return 3;
+}